@@ -0,0 +1,151 @@
+/*************************************************************************\
+* Copyright (c) 2002 The University of Chicago, as Operator of Argonne
+*     National Laboratory.
+* Copyright (c) 2002 The Regents of the University of California, as
+*     Operator of Los Alamos National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* dbLock.h */
+/*      Author: Marty Kraimer   Date: 12MAR96   */
+
+#ifndef INCdbLockh
+#define INCdbLockh
+
+#include <stddef.h>
+
+#include "ellLib.h"
+#include "epicsTypes.h"
+#include "dbCoreAPI.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct dbCommon;
+struct dbBase;
+/** @brief Lock multiple records.
+ *
+ * A dbLocker allows a caller to simultaneously lock multiple records.
+ * The list of records is provided to dbLockerAlloc().
+ * And the resulting dbLocker can be locked/unlocked repeatedly.
+ *
+ * Each thread can only lock one dbLocker at a time.
+ * While locked, dbScanLock() may be called only on those records
+ * included in the dbLocker.
+ *
+ * A dbLocker keeps the order in which to take the lock sets of its
+ * records, each lock set once.  The order is only checked again when lock
+ * sets have been merged or split, so code which locks the same records
+ * repeatedly should keep its dbLocker rather than allocate a new one each
+ * time.
+ *
+ * @since 3.16.0.1
+ */
+struct dbLocker;
+typedef struct dbLocker dbLocker;
+
+/** @brief Lock a record for modification.
+ *
+ *  While locked, caller may access record using eg. dbGet() or dbPut(),
+ *  but not dbGetField() or dbPutField().
+ *  The caller must later call dbScanUnlock().
+ *  dbScanLock() may be called again as the record lock behaves as a recursive mutex.
+ */
+DBCORE_API void dbScanLock(struct dbCommon *precord);
+/** @brief Unlock a record.
+ *
+ *  Reverse the action of dbScanLock()
+ */
+DBCORE_API void dbScanUnlock(struct dbCommon *precord);
+
+/** @brief Prepare to lock a set of records.
+ * @param precs Array of nrecs dbCommon pointers.
+ * @param nrecs Length of precs array
+ * @param flags Set to 0
+ * @return NULL on error
+ * @since 3.16.0.1
+ */
+DBCORE_API dbLocker *dbLockerAlloc(struct dbCommon * const *precs,
+                                       size_t nrecs,
+                                       unsigned int flags);
+
+/** @brief Free dbLocker allocated by dbLockerAlloc()
+ * @param plocker Must not be NULL
+ * @since 3.16.0.1
+ */
+DBCORE_API void dbLockerFree(dbLocker *plocker);
+
+/** @brief Lock all records of dbLocker
+ *
+ * While locked, caller may access any associated record passed to dbLockerAlloc() .
+ * dbScanLockMany() may not be called again (multi-lock is not recursive).
+ * dbScanLock()/dbScanUnlock() may be called on individual record.
+ * The caller must later call dbScanUnlockMany().
+ * @since 3.16.0.1
+ */
+DBCORE_API void dbScanLockMany(dbLocker*);
+/** @brief Unlock all records of dbLocker
+ * @since 3.16.0.1
+ */
+DBCORE_API void dbScanUnlockMany(dbLocker*);
+
+DBCORE_API unsigned long dbLockGetLockId(
+    struct dbCommon *precord);
+
+DBCORE_API void dbLockInitRecords(struct dbBase *pdbbase);
+DBCORE_API void dbLockCleanupRecords(struct dbBase *pdbbase);
+
+
+/* Lock Set Report */
+DBCORE_API long dblsr(char *recordname,int level);
+/* If recordname NULL then all records*/
+/* level = (0,1,2) (lock set state, + recordname, +DB links) */
+
+DBCORE_API long dbLockShowLocked(int level);
+
+/** @brief Lock set contention counters
+ *
+ * Only the outermost lock of a record or dbLocker taken by a thread is
+ * counted.  Times are in nsec.
+ */
+typedef struct dbLockStats {
+    epicsUInt64 nlock;          /**< Times locked */
+    epicsUInt64 ncontended;     /**< Times another thread held the lock */
+    epicsUInt64 waitTotal;      /**< Time spent waiting for the lock */
+    epicsUInt64 waitMax;
+    epicsUInt64 nheld;          /**< Times held while dbLockHoldTimes was set */
+    epicsUInt64 holdTotal;      /**< Time held in those times */
+    epicsUInt64 holdMax;
+} dbLockStats;
+
+/** @brief Non-zero to count the time lock sets are held. */
+DBCORE_API extern int dbLockHoldTimes;
+
+/** @brief Get the contention counters of a record's lock set.
+ *
+ * The counters are read without locking the lock set, so this may be
+ * called while processing a record in another lock set.
+ * @return 0, or non-zero before iocInit.
+ */
+DBCORE_API long dbLockGetStats(struct dbCommon *precord, dbLockStats *pstats);
+/** @brief Clear the contention counters of every lock set. */
+DBCORE_API void dbLockResetStats(void);
+/** @brief Show the lock sets waited for longest.
+ * @param top Number of lock sets to show, 0 for all.
+ */
+DBCORE_API long dbLockShowContention(int top);
+
+/*KLUDGE to support field TPRO*/
+DBCORE_API int * dbLockSetAddrTrace(struct dbCommon *precord);
+
+/* debugging */
+DBCORE_API unsigned long dbLockGetRefs(struct dbCommon*);
+DBCORE_API unsigned long dbLockCountSets(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*INCdbLockh*/
@@ -0,0 +1,85 @@
+/*************************************************************************\
+* Copyright (c) 2002 The University of Chicago, as Operator of Argonne
+*     National Laboratory.
+* Copyright (c) 2002 The Regents of the University of California, as
+*     Operator of Los Alamos National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/**
+ * \file freeList.h
+ * \author Marty Kraimer
+ *
+ * \brief Allocate and free fixed size memory elements.
+ *
+ * \details
+ * Describes routines to allocate and free fixed size memory elements.
+ * Free elements are maintained on a free list rather than being returned to the heap via calls to free.
+ * When it is necessary to call malloc(), memory is allocated in multiples of the element size.
+ *
+ * Lists created with freeListInitCachedPvt() also keep a small cache of
+ * free elements for each thread which uses them, so that most calls to
+ * freeListMalloc() and freeListFree() don't take the list's lock.
+ */
+
+#ifndef INCfreeListh
+#define INCfreeListh
+
+#include <stddef.h>
+#include "libComAPI.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+LIBCOM_API extern int freeListBypass;
+
+/** \brief Number of elements in each per-thread cache magazine of lists
+ * created afterwards with freeListInitCachedPvt().  0 disables the
+ * per-thread caches.
+ */
+LIBCOM_API extern int freeListMagazineSize;
+
+/** \brief Cache statistics of a list created by freeListInitCachedPvt().
+ *
+ * Hits are counted by each thread and added to the list's totals when
+ * that thread next takes the list's lock, or exits.
+ */
+typedef struct freeListCacheStatistics {
+    int magazineSize;       /**< \brief 0 if the list isn't cached */
+    unsigned long hits;     /**< \brief Served from a thread's magazines */
+    unsigned long misses;   /**< \brief Needed the list's lock */
+    unsigned long depotRefills; /**< \brief Full magazines reused */
+    unsigned long depotReturns; /**< \brief Full magazines given back */
+    size_t depotFull;       /**< \brief Full magazines in the depot now */
+} freeListCacheStatistics;
+
+LIBCOM_API void epicsStdCall freeListInitPvt(void **ppvt, int size, int malloc);
+/** \brief Create a free list with per-thread caches.
+ *
+ * Like freeListInitPvt(), but each thread keeps two magazines of up to
+ * freeListMagazineSize free elements, exchanged with a depot of full
+ * magazines in the list.  Best for lists used by many threads on hot
+ * paths.  Free elements in a thread's magazines are returned to the list
+ * when an EPICS thread exits.  freeListItemsAvail() counts them too, so
+ * is slower for these lists.
+ * \param name Shown by freeListCacheReport(), must remain valid.
+ */
+LIBCOM_API void epicsStdCall freeListInitCachedPvt(void **ppvt,
+    const char *name, int size, int malloc);
+LIBCOM_API void * epicsStdCall freeListCalloc(void *pvt);
+LIBCOM_API void * epicsStdCall freeListMalloc(void *pvt);
+LIBCOM_API void epicsStdCall freeListFree(void *pvt,void*pmem);
+LIBCOM_API void epicsStdCall freeListCleanup(void *pvt);
+LIBCOM_API size_t epicsStdCall freeListItemsAvail(void *pvt);
+LIBCOM_API void epicsStdCall freeListCacheStats(void *pvt,
+    freeListCacheStatistics *pstats);
+/** \brief Print the cache statistics of all lists with per-thread caches */
+LIBCOM_API void epicsStdCall freeListCacheReport(unsigned level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*INCfreeListh*/
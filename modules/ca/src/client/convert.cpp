@@ -97,6 +97,69 @@ inline epicsUInt32 dbr_htonl ( const epicsUInt32 & host )
     return tmp;
 }
 
+/*
+ * On little endian hosts with the same float word order, converting arrays
+ * of 4 and 8 byte values is just reversing their bytes.  That is done here
+ * by reversing the order of their 16 bit words while swapping the bytes of
+ * each, which compilers can vectorize without byte shuffle instructions.
+ * The elements may be floating point, so each word is copied with memcpy()
+ * rather than read or written through an epicsUInt16 pointer, which would
+ * break strict aliasing.  The source and destination are either the same
+ * or don't overlap, and the in place loop is separate.
+ */
+#if EPICS_BYTE_ORDER == EPICS_ENDIAN_LITTLE && \
+    EPICS_FLOAT_WORD_ORDER == EPICS_BYTE_ORDER
+#   define CA_SWAP_ARRAYS
+
+inline epicsUInt16 swapBytes ( epicsUInt16 v )
+{
+    return static_cast < epicsUInt16 > ( ( v << 8u ) | ( v >> 8u ) );
+}
+
+inline epicsUInt16 loadWord ( const unsigned char * p, unsigned j )
+{
+    epicsUInt16 w;
+    memcpy ( &w, p + j * sizeof ( w ), sizeof ( w ) );
+    return w;
+}
+
+inline void storeWord ( unsigned char * p, unsigned j, epicsUInt16 w )
+{
+    memcpy ( p + j * sizeof ( w ), &w, sizeof ( w ) );
+}
+
+template < unsigned N >
+static void swapArray ( const void * s, void * d, arrayElementCount num )
+{
+    const size_t size = N * sizeof ( epicsUInt16 );
+
+    if ( s == d ) {
+        unsigned char * p = static_cast < unsigned char * > ( d );
+        for ( arrayElementCount i = 0; i < num; i++, p += size ) {
+            epicsUInt16 w[N];
+            for ( unsigned j = 0; j < N; j++ ) {
+                w[j] = loadWord ( p, j );
+            }
+            for ( unsigned j = 0; j < N; j++ ) {
+                storeWord ( p, j, swapBytes ( w[N - 1 - j] ) );
+            }
+        }
+    }
+    else {
+        const unsigned char * pSrc =
+            static_cast < const unsigned char * > ( s );
+        unsigned char * pDest = static_cast < unsigned char * > ( d );
+        for ( arrayElementCount i = 0; i < num;
+                i++, pSrc += size, pDest += size ) {
+            for ( unsigned j = 0; j < N; j++ ) {
+                epicsUInt16 w = loadWord ( pSrc, N - 1 - j );
+                storeWord ( pDest, j, swapBytes ( w ) );
+            }
+        }
+    }
+}
+#endif
+
 /*
  * if hton is true then it is a host to network conversion
  * otherwise vise-versa
@@ -184,6 +247,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CA_SWAP_ARRAYS
+    swapArray < 2 > ( s, d, num );
+#else
     dbr_long_t          *pSrc = (dbr_long_t *) s;
     dbr_long_t          *pDest = (dbr_long_t *) d;
 
@@ -197,6 +263,7 @@ arrayElementCount   num         /* number of values     */
             pDest[i] = dbr_ntohl( pSrc[i] );
         }
     }
+#endif
 }
 
 /*
@@ -244,6 +311,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CA_SWAP_ARRAYS
+    swapArray < 2 > ( s, d, num );
+#else
     const dbr_float_t   *pSrc = (const dbr_float_t *) s;
     dbr_float_t         *pDest = (dbr_float_t *) d;
 
@@ -257,6 +327,7 @@ arrayElementCount   num         /* number of values     */
             dbr_ntohf ( &pSrc[i], &pDest[i] );
         }
     }
+#endif
 }
 
 /*
@@ -269,6 +340,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#ifdef CA_SWAP_ARRAYS
+    swapArray < 4 > ( s, d, num );
+#else
     dbr_double_t        *pSrc = (dbr_double_t *) s;
     dbr_double_t        *pDest = (dbr_double_t *) d;
 
@@ -282,6 +356,7 @@ arrayElementCount   num         /* number of values     */
             dbr_ntohd( &pSrc[i], &pDest[i] );
         }
     }
+#endif
 }
 
 /****************************************************************************
@@ -0,0 +1,10 @@
+/* Generated file, do not edit! */
+
+/* Version determined from Git */
+
+#ifndef EPICS_VCS_VERSION
+  #define EPICS_VCS_VERSION "755e43ffc9d03beb28d8"
+#endif
+#ifndef EPICS_VCS_VERSION_DATE
+  #define EPICS_VCS_VERSION_DATE "Git: 2026-10-16 23:18:13 +0000"
+#endif
@@ -26,7 +26,7 @@
 #include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsInterrupt.h"
-#include "epicsRingPointer.h"
+#include "epicsRingMPMC.h"
 #include "epicsString.h"
 #include "epicsThread.h"
 #include "epicsTimer.h"
@@ -50,9 +50,12 @@
 
 static int callbackQueueSize = 2000;
 
+/* Most callbacks a thread takes off its queue at once */
+#define CB_BATCH 16
+
 typedef struct cbQueueSet {
     epicsEventId semWakeUp;
-    epicsRingPointerId queue;
+    epicsRingMPMCId queue;
     int queueOverflow;
     int queueOverflows;
     int shutdown; // use atomic
@@ -114,11 +117,11 @@ int callbackQueueStatus(const int reset, callbackQueueStats *result)
     if (epicsAtomicGetIntT(&cbState)==cbInit) return -1;
     if (result) {
         int prio;
-        result->size = callbackQueueSize;
+        result->size = epicsRingMPMCGetSize(callbackQueue[0].queue);
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerId qId = callbackQueue[prio].queue;
-            result->numUsed[prio] = epicsRingPointerGetUsed(qId);
-            result->maxUsed[prio] = epicsRingPointerGetHighWaterMark(qId);
+            epicsRingMPMCId qId = callbackQueue[prio].queue;
+            result->numUsed[prio] = epicsRingMPMCGetUsed(qId);
+            result->maxUsed[prio] = epicsRingMPMCGetHighWaterMark(qId);
             result->numOverflow[prio] = epicsAtomicGetIntT(&callbackQueue[prio].queueOverflows);
         }
         ret = 0;
@@ -128,7 +131,7 @@ int callbackQueueStatus(const int reset, callbackQueueStats *result)
     if (reset) {
         int prio;
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerResetHighWaterMark(callbackQueue[prio].queue);
+            epicsRingMPMCResetHighWaterMark(callbackQueue[prio].queue);
         }
     }
     return ret;
@@ -212,15 +215,22 @@ static void callbackTask(void *arg)
     epicsEventSignal(startStopEvent);
 
     while(!epicsAtomicGetIntT(&mySet->shutdown)) {
-        void *ptr;
-        if (epicsRingPointerIsEmpty(mySet->queue))
-            epicsEventMustWait(mySet->semWakeUp);
+        void *batch[CB_BATCH];
+        int n, i;
 
-        while ((ptr = epicsRingPointerPop(mySet->queue))) {
-            epicsCallback *pcallback = (epicsCallback *)ptr;
-            if(!epicsRingPointerIsEmpty(mySet->queue))
-                epicsEventMustTrigger(mySet->semWakeUp);
-            mySet->queueOverflow = FALSE;
+        n = epicsRingMPMCPopBatch(mySet->queue, batch, CB_BATCH);
+        if (!n) {
+            /* callbackRequest() wakes us when the queue was empty */
+            epicsEventMustWait(mySet->semWakeUp);
+            continue;
+        }
+        /* let another thread start on what we left */
+        if (mySet->threadsConfigured > 1 &&
+            !epicsRingMPMCIsEmpty(mySet->queue))
+            epicsEventMustTrigger(mySet->semWakeUp);
+        mySet->queueOverflow = FALSE;
+        for (i = 0; i < n; i++) {
+            epicsCallback *pcallback = (epicsCallback *)batch[i];
             (*pcallback->callback)(pcallback);
         }
     }
@@ -269,7 +279,7 @@ void callbackCleanup(void)
         assert(epicsAtomicGetIntT(&mySet->threadsRunning)==0);
         epicsEventDestroy(mySet->semWakeUp);
         mySet->semWakeUp = NULL;
-        epicsRingPointerDelete(mySet->queue);
+        epicsRingMPMCDelete(mySet->queue);
         mySet->queue = NULL;
         free(mySet->threads);
         mySet->threads = NULL;
@@ -299,9 +309,9 @@ void callbackInit(void)
         epicsThreadId tid;
 
         callbackQueue[i].semWakeUp = epicsEventMustCreate(epicsEventEmpty);
-        callbackQueue[i].queue = epicsRingPointerLockedCreate(callbackQueueSize);
+        callbackQueue[i].queue = epicsRingMPMCCreate(callbackQueueSize);
         if (callbackQueue[i].queue == 0)
-            cantProceed("epicsRingPointerLockedCreate failed for %s\n",
+            cantProceed("epicsRingMPMCCreate failed for %s\n",
                 threadNamePrefix[i]);
         callbackQueue[i].queueOverflow = FALSE;
 
@@ -360,7 +370,7 @@ int callbackRequest(epicsCallback *pcallback)
     }
     if (mySet->queueOverflow) return S_db_bufFull;
 
-    pushOK = epicsRingPointerPush(mySet->queue, pcallback);
+    pushOK = epicsRingMPMCPush(mySet->queue, pcallback);
 
     if (!pushOK) {
         epicsInterruptContextMessage(fullMessage[priority]);
@@ -368,7 +378,9 @@ int callbackRequest(epicsCallback *pcallback)
         epicsAtomicIncrIntT(&mySet->queueOverflows);
         return S_db_bufFull;
     }
-    epicsEventSignal(mySet->semWakeUp);
+    /* Threads only sleep when they find the queue empty */
+    if (pushOK == 2)
+        epicsEventSignal(mySet->semWakeUp);
     return 0;
 }
 
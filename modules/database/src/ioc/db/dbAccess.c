@@ -51,12 +51,14 @@
 #include "dbLink.h"
 #include "dbLockPvt.h"
 #include "dbNotify.h"
+#include "dbProfile.h"
 #include "dbScan.h"
 #include "dbServer.h"
 #include "dbStaticLib.h"
 #include "dbStaticPvt.h"
 #include "devSup.h"
 #include "epicsEvent.h"
+#include "iocInit.h"
 #include "link.h"
 #include "recGbl.h"
 #include "recSup.h"
@@ -492,6 +494,11 @@ long dbProcess(dbCommon *precord)
     int set_trace = FALSE;
     dbFldDes *pdbFldDes;
     int callNotifyCompletion = FALSE;
+    int profile = dbProfileActive;
+    dbProfileFrame frame;
+
+    if (profile)
+        dbProfileEnter(&frame);
 
     ptrace = dbLockSetAddrTrace(precord);
     /*
@@ -620,6 +627,8 @@ all_done:
         *ptrace = 0;
     if (callNotifyCompletion && precord->ppn)
         dbNotifyCompletion(precord);
+    if (profile)
+        dbProfileExit(precord, &frame);
 
     return status;
 }
@@ -785,15 +794,21 @@ long dbBufferSize(short dbr_type, long options, long no_elements)
 }
 int dbLoadDatabase(const char *file, const char *path, const char *subs)
 {
+    epicsUInt64 t0 = epicsMonotonicGet();
+    int status;
+
     if (!file) {
         printf("Usage: dbLoadDatabase \"file\", \"path\", \"subs\"\n");
         return -1;
     }
-    return dbReadDatabase(&pdbbase, file, path, subs);
+    status = dbReadDatabase(&pdbbase, file, path, subs);
+    iocStartupLoadTime(0, t0);
+    return status;
 }
 
 int dbLoadRecords(const char* file, const char* subs)
 {
+    epicsUInt64 t0 = epicsMonotonicGet();
     int status;
 
     if (!file) {
@@ -801,6 +816,7 @@ int dbLoadRecords(const char* file, const char* subs)
         return -1;
     }
     status = dbReadDatabase(&pdbbase, file, 0, subs);
+    iocStartupLoadTime(1, t0);
     if(status==0) {
         if(dbLoadRecordsHook)
             dbLoadRecordsHook(file, subs);
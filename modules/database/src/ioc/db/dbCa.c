@@ -25,6 +25,7 @@
 #include "epicsAssert.h"
 #include "epicsEvent.h"
 #include "epicsExit.h"
+#include "epicsExport.h"
 #include "epicsMutex.h"
 #include "epicsPrint.h"
 #include "epicsString.h"
@@ -61,17 +62,31 @@
 extern void dbServiceIOInit();
 extern int dbServiceIsolate;
 
-static ELLLIST workList = ELLLIST_INIT;    /* Work list for dbCaTask */
-static epicsMutexId workListLock; /*Mutual exclusions semaphores for workList*/
-static epicsEventId workListEvent; /*wakeup event for dbCaTask*/
-static int removesOutstanding = 0;
+/* The links are shared between dbCaWorkers threads by the hash of their
+ * PV names.  Each worker has its own work list and CA client context.
+ */
+struct dbCaShard {
+    ELLLIST workList;           /* Work list for dbCaTask */
+    epicsMutexId workListLock;  /* Guards workList and removesOutstanding */
+    epicsEventId workListEvent; /* wakeup event for dbCaTask */
+    epicsEventId startStopEvent;
+    epicsThreadId worker;
+    int removesOutstanding;
+    int chanCount;
+    int nLinks;
+    int maxDepth;
+};
 #define removesOutstandingWarning 10000
 
+int dbCaWorkers = 1;
+epicsExportAddress(int, dbCaWorkers);
+
+static struct dbCaShard *shards;
+static unsigned nShards;
+
 static volatile enum dbCaCtl_t {
     ctlInit, ctlRun, ctlPause, ctlExit
 } dbCaCtl;
-static epicsEventId startStopEvent;
-static epicsThreadId dbCaWorker;
 
 struct ca_client_context * dbCaClientContext;
 
@@ -84,15 +99,13 @@ static lset dbCa_lset;
     errlogPrintf("%s has DB CA link to %s\n",\
         pcaLink->plink->precord->name, pcaLink->pvname)
 
-static int dbca_chan_count;
-
 /* caLink locking
  *
  * Lock ordering:
  *  dbScanLock -> caLink.lock -> workListLock
  *
  * workListLock:
- *   Guards access to workList.
+ *   Guards access to the workList of a shard.
  *
  * dbScanLock:
  *   All dbCa* functions operating on a single link may only be called when
@@ -110,6 +123,12 @@ static int dbca_chan_count;
  * caLink.lock:
  *   Guards the caLink structure (but not the struct DBLINK)
  *
+ *   Native monitor updates are double buffered so that readers don't wait
+ *   for large arrays to be copied.  eventCallback takes pgetSpare while
+ *   holding the lock, fills it without, then swaps it with pgetNative
+ *   under the lock.  bufferGen tells it whether the buffers were freed
+ *   meanwhile, in which case it frees the one it filled.
+ *
  * The dbCaTask only locks caLink, and must not lock the record (a violation of lock order).
  *
  * During link modification or IOC shutdown the pca->plink pointer (guarded by caLink.lock)
@@ -130,9 +149,10 @@ static int dbca_chan_count;
 
 static void addAction(caLink *pca, short link_action)
 {
+    struct dbCaShard *pshard = pca->shard;
     int callAdd;
 
-    epicsMutexMustLock(workListLock);
+    epicsMutexMustLock(pshard->workListLock);
     callAdd = (pca->link_action == 0);
     if (pca->link_action & CA_CLEAR_CHANNEL) {
         errlogPrintf("dbCa::addAction %d with CA_CLEAR_CHANNEL set\n",
@@ -141,22 +161,25 @@ static void addAction(caLink *pca, short link_action)
         link_action = 0;
     }
     if (link_action & CA_CLEAR_CHANNEL) {
-        if (++removesOutstanding >= removesOutstandingWarning) {
+        if (++pshard->removesOutstanding >= removesOutstandingWarning) {
             errlogPrintf("dbCa::addAction pausing, %d channels to clear\n",
-                removesOutstanding);
+                pshard->removesOutstanding);
         }
-        while (removesOutstanding >= removesOutstandingWarning) {
-            epicsMutexUnlock(workListLock);
+        while (pshard->removesOutstanding >= removesOutstandingWarning) {
+            epicsMutexUnlock(pshard->workListLock);
             epicsThreadSleep(1.0);
-            epicsMutexMustLock(workListLock);
+            epicsMutexMustLock(pshard->workListLock);
         }
     }
     pca->link_action |= link_action;
+    if (callAdd) {
+        ellAdd(&pshard->workList, &pca->node);
+        if (ellCount(&pshard->workList) > pshard->maxDepth)
+            pshard->maxDepth = ellCount(&pshard->workList);
+    }
+    epicsMutexUnlock(pshard->workListLock);
     if (callAdd)
-        ellAdd(&workList, &pca->node);
-    epicsMutexUnlock(workListLock);
-    if (callAdd)
-        epicsEventSignal(workListEvent);
+        epicsEventSignal(pshard->workListEvent);
 }
 
 static void caLinkInc(caLink *pca)
@@ -178,8 +201,9 @@ static void caLinkDec(caLink *pca)
 
     if (pca->chid) {
         ca_clear_channel(pca->chid);
-        --dbca_chan_count;
+        epicsAtomicDecrIntT(&pca->shard->chanCount);
     }
+    epicsAtomicDecrIntT(&pca->shard->nLinks);
     callback = pca->putCallback;
     if (callback) {
         userPvt = pca->putUserPvt;
@@ -187,6 +211,7 @@ static void caLinkDec(caLink *pca)
         pca->putType = 0;
     }
     free(pca->pgetNative);
+    free(pca->pgetSpare);
     free(pca->pputNative);
     free(pca->pgetString);
     free(pca->pputString);
@@ -270,7 +295,7 @@ void testdbCaWaitForUpdateCount(DBLINK *plink, unsigned long cnt)
 /* Block until worker thread has processed all previously queued actions.
  * Does not prevent additional actions from being queued.
  */
-void dbCaSync(void)
+static void shardSync(struct dbCaShard *pshard)
 {
     epicsEventId wake;
     caLink templink;
@@ -281,6 +306,7 @@ void dbCaSync(void)
      */
     memset(&templink, 0, sizeof(templink));
     templink.refcount = 1;
+    templink.shard = pshard;
 
     wake = epicsEventMustCreate(epicsEventEmpty);
     templink.lock = epicsMutexMustCreate();
@@ -294,12 +320,36 @@ void dbCaSync(void)
      * we hold workListLock to ensure worker call to
      * epicsEventMustTrigger() returns before we destroy the event.
      */
-    epicsMutexMustLock(workListLock);
+    epicsMutexMustLock(pshard->workListLock);
     assert(templink.refcount==1);
 
     epicsMutexDestroy(templink.lock);
     epicsEventDestroy(wake);
-    epicsMutexUnlock(workListLock);
+    epicsMutexUnlock(pshard->workListLock);
+}
+
+void dbCaSync(void)
+{
+    unsigned i;
+
+    for (i = 0; i < nShards; i++)
+        shardSync(&shards[i]);
+}
+
+unsigned dbCaShardCount(void)
+{
+    return nShards;
+}
+
+void dbCaShardStats(unsigned shard, int *plinks, int *pdepth, int *pmaxDepth)
+{
+    struct dbCaShard *pshard = &shards[shard];
+
+    epicsMutexMustLock(pshard->workListLock);
+    *plinks = pshard->nLinks;
+    *pdepth = ellCount(&pshard->workList);
+    *pmaxDepth = pshard->maxDepth;
+    epicsMutexUnlock(pshard->workListLock);
 }
 
 void dbCaCallbackProcess(void *userPvt)
@@ -309,20 +359,46 @@ void dbCaCallbackProcess(void *userPvt)
     dbLinkAsyncComplete(plink);
 }
 
+static void signalWorkers(void)
+{
+    unsigned i;
+
+    for (i = 0; i < nShards; i++)
+        epicsEventSignal(shards[i].workListEvent);
+}
+
 void dbCaShutdown(void)
 {
     enum dbCaCtl_t cur = dbCaCtl;
+    unsigned i;
+
     assert(cur == ctlRun || cur == ctlPause);
     dbCaCtl = ctlExit;
-    epicsEventSignal(workListEvent);
-    epicsEventMustWait(startStopEvent);
-    if(dbCaWorker)
-        epicsThreadMustJoin(dbCaWorker);
+    signalWorkers();
+    for (i = 0; i < nShards; i++) {
+        struct dbCaShard *pshard = &shards[i];
+
+        epicsEventMustWait(pshard->startStopEvent);
+        if (pshard->worker)
+            epicsThreadMustJoin(pshard->worker);
+    }
+    for (i = 0; i < nShards; i++) {
+        struct dbCaShard *pshard = &shards[i];
+
+        epicsMutexDestroy(pshard->workListLock);
+        epicsEventDestroy(pshard->workListEvent);
+        epicsEventDestroy(pshard->startStopEvent);
+    }
+    free(shards);
+    shards = NULL;
+    nShards = 0;
+    dbCaClientContext = NULL;
 }
 
 static void dbCaLinkInitImpl(int isolate)
 {
     epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    unsigned i;
 
     opts.stackSize = epicsThreadGetStackSize(epicsThreadStackBig);
     opts.priority = epicsThreadPriorityMedium;
@@ -331,18 +407,27 @@ static void dbCaLinkInitImpl(int isolate)
     dbServiceIsolate = isolate;
     dbServiceIOInit();
 
-    if (!workListLock)
-        workListLock = epicsMutexMustCreate();
-    if (!workListEvent)
-        workListEvent = epicsEventMustCreate(epicsEventEmpty);
-
-    if(!startStopEvent)
-        startStopEvent = epicsEventMustCreate(epicsEventEmpty);
+    nShards = dbCaWorkers > 0 ? dbCaWorkers : 1;
+    shards = dbCalloc(nShards, sizeof(struct dbCaShard));
     dbCaCtl = ctlPause;
 
-    dbCaWorker = epicsThreadCreateOpt("dbCaLink", dbCaTask, NULL, &opts);
-    /* wait for worker to startup and initialize dbCaClientContext */
-    epicsEventMustWait(startStopEvent);
+    for (i = 0; i < nShards; i++) {
+        struct dbCaShard *pshard = &shards[i];
+        char name[20];
+
+        ellInit(&pshard->workList);
+        pshard->workListLock = epicsMutexMustCreate();
+        pshard->workListEvent = epicsEventMustCreate(epicsEventEmpty);
+        pshard->startStopEvent = epicsEventMustCreate(epicsEventEmpty);
+
+        if (nShards > 1)
+            sprintf(name, "dbCaLink%u", i);
+        else
+            strcpy(name, "dbCaLink");
+        pshard->worker = epicsThreadCreateOpt(name, dbCaTask, pshard, &opts);
+        /* wait for worker to startup and initialize its context */
+        epicsEventMustWait(pshard->startStopEvent);
+    }
 }
 
 void dbCaLinkInitIsolated(void)
@@ -359,7 +444,7 @@ void dbCaRun(void)
 {
     if (dbCaCtl == ctlPause) {
         dbCaCtl = ctlRun;
-        epicsEventSignal(workListEvent);
+        signalWorkers();
     }
 }
 
@@ -367,7 +452,7 @@ void dbCaPause(void)
 {
     if (dbCaCtl == ctlRun) {
         dbCaCtl = ctlPause;
-        epicsEventSignal(workListEvent);
+        signalWorkers();
     }
 }
 
@@ -383,6 +468,8 @@ void dbCaAddLinkCallback(struct link *plink,
     pca->lock = epicsMutexMustCreate();
     pca->plink = plink;
     pca->pvname = epicsStrDup(plink->value.pv_link.pvname);
+    pca->shard = &shards[epicsStrHash(pca->pvname, 0) % nShards];
+    epicsAtomicIncrIntT(&pca->shard->nLinks);
     pca->connect = connect;
     pca->monitor = monitor;
     pca->userPvt = userPvt;
@@ -884,6 +971,8 @@ static void connectionCallback(struct connection_handler_args arg)
             pca->gotInString  = 0;
             pca->gotOutString = 0;
             free(pca->pgetNative); pca->pgetNative = 0;
+            free(pca->pgetSpare); pca->pgetSpare = 0;
+            pca->bufferGen++;
             free(pca->pgetString); pca->pgetString = 0;
             free(pca->pputNative); pca->pputNative = 0;
             free(pca->pputString); pca->pputString = 0;
@@ -970,7 +1059,31 @@ static void eventCallback(struct event_handler_args arg)
     case DBR_TIME_LONG:
     case DBR_TIME_DOUBLE:
         assert(pca->pgetNative);
-        memcpy(pca->pgetNative, dbr_value_ptr(arg.dbr, arg.type), size);
+        if (pca->pgetSpare) {
+            void *pfill = pca->pgetSpare;
+            unsigned gen = pca->bufferGen;
+
+            pca->pgetSpare = 0;
+            epicsMutexUnlock(pca->lock);
+            memcpy(pfill, dbr_value_ptr(arg.dbr, arg.type), size);
+            epicsMutexMustLock(pca->lock);
+            monitor = 0;
+            if (gen != pca->bufferGen) {
+                /* The buffers were freed by a type or size change */
+                free(pfill);
+                goto done;
+            }
+            pca->pgetSpare = pca->pgetNative;
+            pca->pgetNative = pfill;
+            plink = pca->plink;
+            if (!plink) goto done;
+            monitor = pca->monitor;
+            userPvt = pca->userPvt;
+            precord = plink->precord;
+        }
+        else {
+            memcpy(pca->pgetNative, dbr_value_ptr(arg.dbr, arg.type), size);
+        }
         pca->usedelements = arg.count;
         pca->gotInNative = TRUE;
         break;
@@ -1119,33 +1232,35 @@ static void getAttribEventCallback(struct event_handler_args arg)
 
 static void dbCaTask(void *arg)
 {
+    struct dbCaShard *pshard = arg;
     epicsEventId requestSync = NULL;
     taskwdInsert(0, NULL, NULL);
     SEVCHK(ca_context_create(ca_enable_preemptive_callback),
         "dbCaTask calling ca_context_create");
-    dbCaClientContext = ca_current_context ();
+    if (pshard == shards)
+        dbCaClientContext = ca_current_context ();
     SEVCHK(ca_add_exception_event(exceptionCallback,NULL),
         "ca_add_exception_event");
-    epicsEventSignal(startStopEvent);
+    epicsEventSignal(pshard->startStopEvent);
 
     /* channel access event loop */
     while (TRUE){
         do {
-            epicsEventMustWait(workListEvent);
+            epicsEventMustWait(pshard->workListEvent);
         } while (dbCaCtl == ctlPause);
         while (TRUE) { /* process all requests in workList*/
             caLink *pca;
             short  link_action;
             int    status;
 
-            epicsMutexMustLock(workListLock);
-            if (!(pca = (caLink *)ellGet(&workList))){  /* Take off list head */
+            epicsMutexMustLock(pshard->workListLock);
+            if (!(pca = (caLink *)ellGet(&pshard->workList))){  /* Take off list head */
                 if(requestSync) {
                     /* dbCaSync() requires workListLock to be held here */
                     epicsEventMustTrigger(requestSync);
                     requestSync = NULL;
                 }
-                epicsMutexUnlock(workListLock);
+                epicsMutexUnlock(pshard->workListLock);
                 if (dbCaCtl == ctlExit) goto shutdown;
                 break; /* workList is empty */
             }
@@ -1155,8 +1270,8 @@ static void dbCaTask(void *arg)
                 requestSync = pca->userPvt;
             }
             pca->link_action = 0;
-            if (link_action & CA_CLEAR_CHANNEL) --removesOutstanding;
-            epicsMutexUnlock(workListLock);         /* Give back immediately */
+            if (link_action & CA_CLEAR_CHANNEL) --pshard->removesOutstanding;
+            epicsMutexUnlock(pshard->workListLock); /* Give back immediately */
             if (link_action&CA_SYNC)
                 continue;
             if (link_action & CA_CLEAR_CHANNEL) {   /* This must be first */
@@ -1174,7 +1289,7 @@ static void dbCaTask(void *arg)
                     printLinks(pca);
                     continue;
                 }
-                dbca_chan_count++;
+                epicsAtomicIncrIntT(&pshard->chanCount);
                 status = ca_replace_access_rights_event(pca->chid,
                     accessRightsCallback);
                 if (status != ECA_NORMAL) {
@@ -1247,6 +1362,7 @@ static void dbCaTask(void *arg)
                 epicsMutexMustLock(pca->lock);
                 pca->elementSize = dbr_value_size[ca_field_type(pca->chid)];
                 pca->pgetNative = dbCalloc(pca->nelements, pca->elementSize);
+                pca->pgetSpare = dbCalloc(pca->nelements, pca->elementSize);
                 epicsMutexUnlock(pca->lock);
 
                 status = ca_add_array_event(
@@ -1278,9 +1394,9 @@ static void dbCaTask(void *arg)
     }
 shutdown:
     taskwdRemove(0);
-    if (dbca_chan_count == 0)
+    if (pshard->chanCount == 0)
         ca_context_destroy();
     else
-        fprintf(stderr, "dbCa: chan_count = %d at shutdown\n", dbca_chan_count);
-    epicsEventSignal(startStopEvent);
+        fprintf(stderr, "dbCa: chan_count = %d at shutdown\n", pshard->chanCount);
+    epicsEventSignal(pshard->startStopEvent);
 }
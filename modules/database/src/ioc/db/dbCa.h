@@ -18,6 +18,9 @@
 extern "C" {
 #endif
 
+/* Number of CA link worker threads started by iocInit, default 1 */
+DBCORE_API extern int dbCaWorkers;
+
 typedef void (*dbCaCallback)(void *userPvt);
 DBCORE_API void dbCaCallbackProcess(void *usrPvt);
 
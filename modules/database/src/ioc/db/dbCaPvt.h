@@ -35,10 +35,13 @@
 #define CA_PUT          0x1
 #define CA_PUT_CALLBACK 0x2
 
+struct dbCaShard;
+
 typedef struct caLink
 {
     ELLNODE         node;
     int             refcount;
+    struct dbCaShard *shard; /* worker handling this link */
     epicsMutexId    lock;
     struct link     *plink;
     char            *pvname;
@@ -78,6 +81,8 @@ typedef struct caLink
     char            units[MAX_UNITS_SIZE];  /* units of value */
     /* The following are for handling data*/
     void            *pgetNative;
+    void            *pgetSpare; /* filled by eventCallback, then swapped */
+    unsigned        bufferGen; /* changes when the get buffers are freed */
     char            *pgetString;
     void            *pputNative;
     char            *pputString;
@@ -96,4 +101,8 @@ typedef struct caLink
     unsigned long   nUpdate;
 }caLink;
 
+/* Used by dbcar */
+unsigned dbCaShardCount(void);
+void dbCaShardStats(unsigned shard, int *plinks, int *pdepth, int *pmaxDepth);
+
 #endif /* INC_dbCaPvt_H */
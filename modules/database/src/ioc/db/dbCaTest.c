@@ -154,6 +154,19 @@ done:
            nDisconnect, nNoWrite);
     dbFinishEntry(pdbentry);
 
+    if (dbCaShardCount() > 1 || level > 0) {
+        unsigned i;
+
+        for (i = 0; i < dbCaShardCount(); i++) {
+            int nlinks, depth, maxDepth;
+
+            dbCaShardStats(i, &nlinks, &depth, &maxDepth);
+            printf("Worker %u: %d link%s, %d queued, at most %d\n",
+                i, nlinks, nlinks != 1 ? "s" : "", depth, maxDepth);
+        }
+        printf("\n");
+    }
+
     if ( level > 2  && dbCaClientContext != 0 ) {
         ca_context_status ( dbCaClientContext, level - 2 );
     }
@@ -48,6 +48,8 @@ typedef struct evSubscrip evSubscrip;
 #ifdef EPICS_PRIVATE_API
 struct evSubscrip {
     ELLNODE             node;
+    /* this node added to the record's subscriptions to the same field */
+    ELLNODE             fieldNode;
     struct dbChannel  * chan;
     /* user_sub==NULL used to indicate db_cancel_event() */
     EVENTFUNC         * user_sub;
@@ -60,12 +62,18 @@ struct evSubscrip {
     unsigned long       npend;
     /* n times replacing event on the queue */
     unsigned long       nreplace;
+    /* n times not queued as an update referring to the record is pending */
+    unsigned long       ncoalesce;
+    /* queue entries reserved */
+    unsigned            nentries;
     /* DBE mask */
     unsigned char       select;
     /* if set, subscription will yield dbfl_type_val */
     char                useValque;
-    /* event_task is handling this subscription */
-    char                callBackInProgress;
+    /* if set, array updates are copied into a shared snapshot */
+    char                useSnapshot;
+    /* n updates taken off the queue by event_task and not yet delivered */
+    unsigned            callBackInProgress;
     /* this node added to dbCommon::mlis */
     char                enabled;
 };
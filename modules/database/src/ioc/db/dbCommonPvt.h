@@ -6,6 +6,8 @@
 #include "dbCommon.h"
 
 struct epicsThreadOSD;
+struct dbEventIndex;
+struct dbProfileRecord;
 
 /** Base internal additional information for every record
  */
@@ -15,6 +17,12 @@ typedef struct dbCommonPvt {
     /* Thread which is currently processing this record */
     struct epicsThreadOSD* procThread;
 
+    /* Enabled event subscriptions by field, protected by mlok */
+    struct dbEventIndex *evIndex;
+
+    /* Processing time counters, protected by the lock set */
+    struct dbProfileRecord *profile;
+
     /* actually followed by:
      * struct dbCommon common;
      */
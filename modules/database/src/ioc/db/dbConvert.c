@@ -60,10 +60,22 @@ static void copyNoConvert(const void *pfrom,
 #define COPYNOCONVERT(N, FROM, TO, NREQ, NO_ELEM, OFFSET) \
     copyNoConvert(FROM, TO, (N)*(NREQ), (N)*(NO_ELEM), (N)*(OFFSET))
 
+/* Array conversions are done in spans which end where the array wraps
+ * around, so the loop converting each span has no test for the wrap and
+ * compilers can vectorize it.
+ * Returns the number of elements to convert before wrapping.
+ */
+static long wrapSpan(long nRequest, long no_elements, long offset)
+{
+    long span = no_elements - offset;
+
+    return span > 0 && span < nRequest ? span : nRequest;
+}
+
 #define GET(typea, typeb) (const dbAddr *paddr, \
     void *pto, long nRequest, long no_elements, long offset) \
 { \
-    typea *psrc = (typea *) paddr->pfield; \
+    const typea *psrc = (const typea *) paddr->pfield; \
     typeb *pdst = (typeb *) pto; \
     \
     if (nRequest==1 && offset==0) { \
@@ -71,10 +83,15 @@ static void copyNoConvert(const void *pfrom,
         return 0; \
     } \
     psrc += offset; \
-    while (nRequest--) { \
-        *pdst++ = (typeb) *psrc++; \
-        if (++offset == no_elements) \
-            psrc = (typea *) paddr->pfield; \
+    while (nRequest > 0) { \
+        long span = wrapSpan(nRequest, no_elements, offset), i; \
+        \
+        for (i = 0; i < span; i++) \
+            pdst[i] = (typeb) psrc[i]; \
+        pdst += span; \
+        nRequest -= span; \
+        offset = 0; \
+        psrc = (const typea *) paddr->pfield; \
     } \
     return 0; \
 }
@@ -104,10 +121,15 @@ static void copyNoConvert(const void *pfrom,
         return 0; \
     } \
     pdst += offset; \
-    while (nRequest--) { \
-        *pdst++ = (typeb) *psrc++; \
-        if (++offset == no_elements) \
-            pdst = (typeb *) paddr->pfield; \
+    while (nRequest > 0) { \
+        long span = wrapSpan(nRequest, no_elements, offset), i; \
+        \
+        for (i = 0; i < span; i++) \
+            pdst[i] = (typeb) psrc[i]; \
+        psrc += span; \
+        nRequest -= span; \
+        offset = 0; \
+        pdst = (typeb *) paddr->pfield; \
     } \
     return 0; \
 }
@@ -818,11 +840,15 @@ static long getDoubleFloat(const dbAddr *paddr,
         return 0;
     }
     psrc += offset;
-    while (nRequest--) {
-        *pdst = epicsConvertDoubleToFloat(*psrc);
-        ++psrc; ++pdst;
-        if (++offset == no_elements)
-            psrc = (epicsFloat64 *) paddr->pfield;
+    while (nRequest > 0) {
+        long span = wrapSpan(nRequest, no_elements, offset), i;
+
+        for (i = 0; i < span; i++)
+            pdst[i] = epicsConvertDoubleToFloat(psrc[i]);
+        pdst += span;
+        nRequest -= span;
+        offset = 0;
+        psrc = (epicsFloat64 *) paddr->pfield;
     }
     return 0;
 }
@@ -1647,10 +1673,15 @@ static long putDoubleFloat(dbAddr *paddr,
         return 0;
     }
     pdst += offset;
-    while (nRequest--) {
-        *pdst++ = epicsConvertDoubleToFloat(*psrc++);
-        if (++offset == no_elements)
-            pdst = (epicsFloat32 *) paddr->pfield;
+    while (nRequest > 0) {
+        long span = wrapSpan(nRequest, no_elements, offset), i;
+
+        for (i = 0; i < span; i++)
+            pdst[i] = epicsConvertDoubleToFloat(psrc[i]);
+        psrc += span;
+        nRequest -= span;
+        offset = 0;
+        pdst = (epicsFloat32 *) paddr->pfield;
     }
     return 0;
 }
@@ -31,6 +31,7 @@
 #include "cantProceed.h"
 #include "dbDefs.h"
 #include "epicsAssert.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "epicsThread.h"
@@ -45,12 +46,14 @@
 #include "dbBase.h"
 #include "dbChannel.h"
 #include "dbCommon.h"
+#include "dbCommonPvt.h"
 #include "dbEvent.h"
 #include "db_field_log.h"
 #include "dbFldTypes.h"
 #include "dbLock.h"
 #include "link.h"
 #include "special.h"
+#include "epicsExport.h"
 
 /* Queue size based on Ethernet MTU of 1500 bytes.
  * Assume <=66 bytes of ethernet+IP+TCP overhead
@@ -60,8 +63,32 @@
  */
 #define EVENTSPERQUE    36
 #define EVENTENTRIES    4      /* the number of que entries for each event */
-#define EVENTQUESIZE    (EVENTENTRIES  * EVENTSPERQUE)
+#define EVENTENTRIESMIN 2      /* leaves room beyond the EVENTSPERQUE kept free */
 #define EVENTQEMPTY     ((struct evSubscrip *)NULL)
+#define EVENTBATCH      64     /* entries event_read() takes at once */
+
+/* Queue entries reserved for each subscription of an event user created
+ * from now on, EVENTENTRIES unless set, and at least EVENTENTRIESMIN.
+ * Each queue holds the entries of EVENTSPERQUE subscriptions.
+ */
+int dbEventQueueEntries = EVENTENTRIES;
+epicsExportAddress(int, dbEventQueueEntries);
+
+/* Bytes up to which a queue grows rather than replacing updates which
+ * haven't been delivered yet, 0 disables growth.
+ */
+int dbEventQueueMaxBytes = 0;
+epicsExportAddress(int, dbEventQueueMaxBytes);
+
+/* what each queue entry costs */
+#define EVENTENTRYBYTES \
+    (sizeof(db_field_log *) + sizeof(struct evSubscrip *) + sizeof(db_field_log))
+
+/* Array subscriptions of at least this many bytes get snapshots,
+ * see db_event_enable_snapshot().  0 leaves it to the subscriber.
+ */
+int dbEventSnapshotMinBytes = 0;
+epicsExportAddress(int, dbEventSnapshotMinBytes);
 
 /*
  * really a ring buffer
@@ -70,15 +97,18 @@ struct event_que {
     /* lock writers to the ring buffer only */
     /* readers must never slow up writers */
     epicsMutexId            writelock;
-    db_field_log            *valque[EVENTQUESIZE];
-    struct evSubscrip       *evque[EVENTQUESIZE];
+    db_field_log            **valque;
+    struct evSubscrip       **evque;
     struct event_que        *nextque;       /* in case que quota exceeded */
     struct event_user       *evUser;        /* event user parent struct */
-    unsigned short          putix;
-    unsigned short          getix;
-    unsigned short          quota;          /* the number of assigned entries*/
-    unsigned short          nDuplicates;    /* N events duplicated on this q */
+    unsigned                size;           /* entries in valque and evque */
+    unsigned                putix;
+    unsigned                getix;
+    unsigned                quota;          /* the number of assigned entries*/
+    unsigned                nsubs;          /* subscriptions assigned */
+    unsigned                nDuplicates;    /* N events duplicated on this q */
     unsigned                possibleStall;
+    int                     ncancel;        /* db_cancel_event() count, atomic */
 };
 
 struct event_user {
@@ -94,6 +124,8 @@ struct event_user {
     void                *extralabor_arg;/* parameter to above */
 
     epicsThreadId       taskid;         /* event handler task id */
+    unsigned            nentries;       /* per subscription by default */
+    size_t              maxQueBytes;    /* growth limit, 0 for none */
     epicsUInt32         pflush_seq;     /* worker cycle count for synchronization */
     unsigned            queovr;         /* event que overflow count */
     unsigned char       pendexit;       /* exit pend task */
@@ -115,8 +147,8 @@ typedef struct {
  * into only 10 or 20 total steps part of the time.
  */
 
-#define RNGINC(OLD)\
-( (unsigned short) ( (OLD) >= (EVENTQUESIZE-1) ? 0 : (OLD)+1 ) )
+#define RNGINC(EV_QUE, OLD)\
+( (OLD) + 1u >= (EV_QUE)->size ? 0u : (OLD) + 1u )
 
 #define LOCKEVQUE(EV_QUE)   epicsMutexMustLock((EV_QUE)->writelock)
 #define UNLOCKEVQUE(EV_QUE) epicsMutexUnlock((EV_QUE)->writelock)
@@ -127,25 +159,156 @@ static void *dbevEventUserFreeList;
 static void *dbevEventQueueFreeList;
 static void *dbevEventSubscriptionFreeList;
 static void *dbevFieldLogFreeList;
+/* The last snapshot freed, kept for the next one of the same size as
+ * large allocations are otherwise mapped and page faulted in each time.
+ */
+static EpicsAtomicPtrT snapshotSpare;
 
 static char *EVENT_PEND_NAME = "eventTask";
 
 static epicsMutexId stopSync;
 
-/* unused space in queue (EVENTQUESIZE when empty) */
-static unsigned short ringSpace ( const struct event_que *pevq )
+/* unused space in queue (size when empty) */
+static unsigned ringSpace ( const struct event_que *pevq )
 {
     if ( pevq->evque[pevq->putix] == EVENTQEMPTY ) {
         if ( pevq->getix > pevq->putix ) {
-            return ( unsigned short ) ( pevq->getix - pevq->putix );
+            return pevq->getix - pevq->putix;
         }
         else {
-            return ( unsigned short ) ( ( EVENTQUESIZE + pevq->getix ) - pevq->putix );
+            return ( pevq->size + pevq->getix ) - pevq->putix;
         }
     }
     return 0;
 }
 
+/*
+ * Enabled subscriptions to each field of a record, so that
+ * db_post_events() only visits those which may want the update.
+ * Sorted by field address, and only changed with the record's mlok held.
+ */
+typedef struct dbEventField {
+    void            *pfield;
+    ELLLIST         subs;           /* of evSubscrip::fieldNode */
+    unsigned char   select;         /* union of the subscriptions' masks */
+    unsigned        nselect[8];     /* subscriptions with each mask bit */
+    unsigned long   nposts;         /* db_post_events() matching select */
+    unsigned long   nlogs;          /* field logs created by them */
+} dbEventField;
+
+struct dbEventIndex {
+    unsigned        nfields;
+    unsigned        nalloc;
+    dbEventField    fields[1];      /* actually nalloc long */
+};
+
+/* where pfield is or would be inserted */
+static unsigned indexSearch ( const struct dbEventIndex *pidx, void *pfield )
+{
+    unsigned lo = 0u, hi = pidx->nfields;
+
+    while ( lo < hi ) {
+        unsigned mid = lo + ( hi - lo ) / 2u;
+        if ( (char *) pidx->fields[mid].pfield < (char *) pfield ) {
+            lo = mid + 1u;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static dbEventField * indexFind ( struct dbEventIndex *pidx, void *pfield )
+{
+    unsigned i;
+
+    if ( ! pidx ) return NULL;
+    i = indexSearch ( pidx, pfield );
+    if ( i < pidx->nfields && pidx->fields[i].pfield == pfield ) {
+        return &pidx->fields[i];
+    }
+    return NULL;
+}
+
+static void indexSelect ( dbEventField *pf, unsigned select, int incr )
+{
+    unsigned bit;
+
+    for ( bit = 0u; bit < NELEMENTS ( pf->nselect ); bit++ ) {
+        if ( select & ( 1u << bit ) ) {
+            pf->nselect[bit] += incr;
+        }
+        if ( pf->nselect[bit] ) {
+            pf->select |= 1u << bit;
+        }
+        else {
+            pf->select &= ~( 1u << bit );
+        }
+    }
+}
+
+/* NOTE: This assumes that the record's mlok is held */
+static void indexAdd ( struct dbCommon *prec, struct evSubscrip *pevent )
+{
+    dbCommonPvt * const ppvt = dbRec2Pvt ( prec );
+    struct dbEventIndex *pidx = ppvt->evIndex;
+    void * const pfield = dbChannelField ( pevent->chan );
+    dbEventField *pf = indexFind ( pidx, pfield );
+
+    if ( ! pf ) {
+        unsigned i;
+
+        if ( ! pidx || pidx->nfields == pidx->nalloc ) {
+            unsigned nalloc = pidx ? 2u * pidx->nalloc : 4u;
+            struct dbEventIndex *pnew = callocMustSucceed ( 1,
+                offsetof ( struct dbEventIndex, fields ) +
+                    nalloc * sizeof ( dbEventField ),
+                "indexAdd" );
+
+            /* list heads may move, the nodes don't refer back to them */
+            if ( pidx ) {
+                memcpy ( pnew, pidx, offsetof ( struct dbEventIndex, fields ) +
+                    pidx->nfields * sizeof ( dbEventField ) );
+                free ( pidx );
+            }
+            pnew->nalloc = nalloc;
+            ppvt->evIndex = pidx = pnew;
+        }
+        i = indexSearch ( pidx, pfield );
+        pf = &pidx->fields[i];
+        memmove ( pf + 1, pf, ( pidx->nfields - i ) * sizeof ( dbEventField ) );
+        memset ( pf, 0, sizeof ( *pf ) );
+        pf->pfield = pfield;
+        ellInit ( &pf->subs );
+        pidx->nfields++;
+    }
+    ellAdd ( &pf->subs, &pevent->fieldNode );
+    indexSelect ( pf, pevent->select, 1 );
+}
+
+/* NOTE: This assumes that the record's mlok is held */
+static void indexRemove ( struct dbCommon *prec, struct evSubscrip *pevent )
+{
+    dbCommonPvt * const ppvt = dbRec2Pvt ( prec );
+    struct dbEventIndex * const pidx = ppvt->evIndex;
+    dbEventField * const pf = indexFind ( pidx,
+        dbChannelField ( pevent->chan ) );
+
+    assert ( pf );
+    ellDelete ( &pf->subs, &pevent->fieldNode );
+    indexSelect ( pf, pevent->select, -1 );
+    if ( ellCount ( &pf->subs ) == 0 ) {
+        pidx->nfields--;
+        memmove ( pf, pf + 1,
+            ( &pidx->fields[pidx->nfields] - pf ) * sizeof ( dbEventField ) );
+        if ( pidx->nfields == 0u ) {
+            free ( pidx );
+            ppvt->evIndex = NULL;
+        }
+    }
+}
+
 int db_event_list ( const char *pname, unsigned level )
 {
     return dbel ( pname, level );
@@ -194,19 +357,26 @@ int dbel ( const char *pname, unsigned level )
             if ( pevent->npend ) {
                 printf ( " undelivered=%ld", pevent->npend );
             }
+            if ( pevent->nreplace ) {
+                printf ( " replaced=%lu", pevent->nreplace );
+            }
+            if ( pevent->ncoalesce ) {
+                printf ( " coalesced=%lu", pevent->ncoalesce );
+            }
 
             if ( level > 1 ) {
-                unsigned nEntriesFree;
+                unsigned nEntriesFree, size;
                 const void * taskId;
                 LOCKEVQUE(pevent->ev_que);
                 nEntriesFree = ringSpace ( pevent->ev_que );
+                size = pevent->ev_que->size;
                 taskId = ( void * ) pevent->ev_que->evUser->taskid;
                 UNLOCKEVQUE(pevent->ev_que);
                 if ( nEntriesFree == 0u ) {
                     printf ( ", thread=%p, queue full",
                         (void *) taskId );
                 }
-                else if ( nEntriesFree == EVENTQUESIZE ) {
+                else if ( nEntriesFree == size ) {
                     printf ( ", thread=%p, queue empty",
                         (void *) taskId );
                 }
@@ -214,13 +384,11 @@ int dbel ( const char *pname, unsigned level )
                     printf ( ", thread=%p, unused entries=%u",
                         (void *) taskId, nEntriesFree );
                 }
+                printf ( ", reserved entries=%u of %u", pevent->nentries, size );
             }
 
             if ( level > 2 ) {
                 unsigned nDuplicates;
-                if ( pevent->nreplace ) {
-                    printf (", discarded by replacement=%ld", pevent->nreplace);
-                }
                 if ( ! pevent->useValque ) {
                     printf (", queueing disabled" );
                 }
@@ -250,6 +418,86 @@ int dbel ( const char *pname, unsigned level )
     return DB_EVENT_OK;
 }
 
+/*
+ * dbelf()
+ *
+ * The subscriptions to each field of a record, and how many field logs
+ * each db_post_events() for the field created on average.
+ */
+int dbelf ( const char *pname, unsigned level )
+{
+    DBADDR              addr;
+    long                status;
+    struct dbEventIndex *pidx;
+    unsigned            i;
+
+    if ( ! pname ) return DB_EVENT_OK;
+    status = dbNameToAddr ( pname, &addr );
+    if ( status != 0 ) {
+        errMessage ( status, " dbNameToAddr failed" );
+        return DB_EVENT_ERROR;
+    }
+
+    LOCKREC (addr.precord);
+
+    pidx = dbRec2Pvt ( addr.precord )->evIndex;
+    if ( ! pidx ) {
+        printf ( "\"%s\": No PV event subscriptions ( monitors ).\n", pname );
+        UNLOCKREC (addr.precord);
+        return DB_EVENT_OK;
+    }
+
+    printf ( "%u PV Event Subscriptions ( monitors ) to %u fields.\n",
+        ellCount ( &addr.precord->mlis ), pidx->nfields );
+
+    for ( i = 0u; i < pidx->nfields; i++ ) {
+        dbEventField * const pf = &pidx->fields[i];
+        struct evSubscrip * const pfirst = CONTAINER ( ellFirst ( &pf->subs ),
+            struct evSubscrip, fieldNode );
+        ELLNODE *cur;
+
+        printf ( "%4.4s %4d subscriptions { ",
+            dbChannelFldDes ( pfirst->chan )->name, ellCount ( &pf->subs ) );
+        if ( pf->select & DBE_VALUE ) printf( "VALUE " );
+        if ( pf->select & DBE_LOG ) printf( "LOG " );
+        if ( pf->select & DBE_ALARM ) printf( "ALARM " );
+        if ( pf->select & DBE_PROPERTY ) printf( "PROPERTY " );
+        printf ( "} posts=%lu", pf->nposts );
+        if ( pf->nposts ) {
+            printf ( ", fan-out=%.1f", (double) pf->nlogs / pf->nposts );
+        }
+        printf ( "\n" );
+
+        if ( level > 0 ) {
+            for ( cur = ellFirst ( &pf->subs ); cur; cur = ellNext ( cur ) ) {
+                struct evSubscrip * const pevent =
+                    CONTAINER ( cur, struct evSubscrip, fieldNode );
+
+                printf ( "     %s { ", dbChannelName ( pevent->chan ) );
+                if ( pevent->select & DBE_VALUE ) printf( "VALUE " );
+                if ( pevent->select & DBE_LOG ) printf( "LOG " );
+                if ( pevent->select & DBE_ALARM ) printf( "ALARM " );
+                if ( pevent->select & DBE_PROPERTY ) printf( "PROPERTY " );
+                printf ( "}" );
+                if ( pevent->npend ) {
+                    printf ( " undelivered=%ld", pevent->npend );
+                }
+                if ( pevent->nreplace ) {
+                    printf ( " replaced=%lu", pevent->nreplace );
+                }
+                if ( pevent->ncoalesce ) {
+                    printf ( " coalesced=%lu", pevent->ncoalesce );
+                }
+                printf ( "\n" );
+            }
+        }
+    }
+
+    UNLOCKREC (addr.precord);
+
+    return DB_EVENT_OK;
+}
+
 /*
  * DB_INIT_EVENT_FREELISTS()
  *
@@ -277,7 +525,7 @@ void db_init_event_freelists (void)
             sizeof(struct evSubscrip),256);
     }
     if (!dbevFieldLogFreeList) {
-        freeListInitPvt(&dbevFieldLogFreeList,
+        freeListInitCachedPvt(&dbevFieldLogFreeList, "dbevFieldLog",
             sizeof(struct db_field_log),2048);
     }
 }
@@ -291,6 +539,29 @@ void db_init_event_freelists (void)
  *
  * returns: ptr to event user block or NULL if memory can't be allocated
  */
+/*
+ * ev_que_alloc()
+ */
+static int ev_que_alloc ( struct event_que *ev_que, unsigned size )
+{
+    ev_que->valque = calloc ( size, sizeof ( *ev_que->valque ) );
+    ev_que->evque = calloc ( size, sizeof ( *ev_que->evque ) );
+    if ( ! ev_que->valque || ! ev_que->evque ) {
+        free ( ev_que->valque );
+        free ( ev_que->evque );
+        return -1;
+    }
+    ev_que->size = size;
+    return 0;
+}
+
+static void ev_que_free ( struct event_que *ev_que )
+{
+    epicsMutexDestroy ( ev_que->writelock );
+    free ( ev_que->valque );
+    free ( ev_que->evque );
+}
+
 dbEventCtx db_init_events (void)
 {
     struct event_user * evUser;
@@ -306,7 +577,18 @@ dbEventCtx db_init_events (void)
     /* Flag will be cleared when event task starts */
     evUser->pendexit = TRUE;
 
+    if (dbEventQueueEntries <= 0)
+        evUser->nentries = EVENTENTRIES;
+    else if (dbEventQueueEntries < EVENTENTRIESMIN)
+        evUser->nentries = EVENTENTRIESMIN;
+    else
+        evUser->nentries = (unsigned) dbEventQueueEntries;
+    evUser->maxQueBytes = dbEventQueueMaxBytes > 0 ?
+        (size_t) dbEventQueueMaxBytes : 0u;
+
     evUser->firstque.evUser = evUser;
+    if (ev_que_alloc(&evUser->firstque, evUser->nentries * EVENTSPERQUE))
+        goto fail;
     evUser->firstque.writelock = epicsMutexCreate();
     if (!evUser->firstque.writelock)
         goto fail;
@@ -329,6 +611,8 @@ fail:
         epicsMutexDestroy (evUser->lock);
     if(evUser->firstque.writelock)
         epicsMutexDestroy (evUser->firstque.writelock);
+    free(evUser->firstque.valque);
+    free(evUser->firstque.evque);
     if(evUser->ppendsem)
         epicsEventDestroy (evUser->ppendsem);
     if(evUser->pexitsem)
@@ -351,6 +635,9 @@ DBCORE_API void db_cleanup_events(void)
 
     if(dbevFieldLogFreeList) freeListCleanup(dbevFieldLogFreeList);
     dbevFieldLogFreeList = NULL;
+
+    free(epicsAtomicGetPtrT(&snapshotSpare));
+    epicsAtomicSetPtrT(&snapshotSpare, NULL);
 }
 
     /* intentionally leak stopSync to avoid possible shutdown races */
@@ -404,15 +691,22 @@ void db_close_events (dbEventCtx ctx)
 /*
  * create_ev_que()
  */
-static struct event_que * create_ev_que ( struct event_user * const evUser )
+static struct event_que * create_ev_que ( struct event_user * const evUser,
+    unsigned size )
 {
     struct event_que * const ev_que = (struct event_que *)
         freeListCalloc ( dbevEventQueueFreeList );
     if ( ! ev_que ) {
         return NULL;
     }
+    if ( ev_que_alloc ( ev_que, size ) ) {
+        freeListFree ( dbevEventQueueFreeList, ev_que );
+        return NULL;
+    }
     ev_que->writelock = epicsMutexCreate();
     if ( ! ev_que->writelock ) {
+        free ( ev_que->valque );
+        free ( ev_que->evque );
         freeListFree ( dbevEventQueueFreeList, ev_que );
         return NULL;
     }
@@ -420,6 +714,55 @@ static struct event_que * create_ev_que ( struct event_user * const evUser )
     return ev_que;
 }
 
+/*
+ * reserve_ev_que()
+ *
+ * find an event que block with enough quota
+ * otherwise add a new one to the list
+ *
+ * NOTE: This assumes that evUser->lock is applied
+ */
+static struct event_que * reserve_ev_que ( struct event_user * const evUser,
+    unsigned nentries )
+{
+    struct event_que * ev_que = & evUser->firstque;
+
+    while ( TRUE ) {
+        int success = 0;
+        LOCKEVQUE ( ev_que );
+        success = ( ev_que->quota + nentries <= ev_que->size );
+        if ( success ) {
+            ev_que->quota += nentries;
+            ev_que->nsubs++;
+        }
+        UNLOCKEVQUE ( ev_que );
+        if ( success ) {
+            return ev_que;
+        }
+        if ( ! ev_que->nextque ) {
+            unsigned size = evUser->nentries * EVENTSPERQUE;
+            if ( size < nentries ) {
+                size = nentries;
+            }
+            ev_que->nextque = create_ev_que ( evUser, size );
+            if ( ! ev_que->nextque ) {
+                return NULL;
+            }
+        }
+        ev_que = ev_que->nextque;
+    }
+}
+
+/*
+ * release_ev_que()
+ * event queue lock _must_ be applied
+ */
+static void release_ev_que ( struct evSubscrip *pevent )
+{
+    pevent->ev_que->quota -= pevent->nentries;
+    pevent->ev_que->nsubs--;
+}
+
 /*
  * DB_ADD_EVENT()
  */
@@ -443,30 +786,8 @@ dbEventSubscription db_add_event (
         return NULL;
     }
 
-    /* find an event que block with enough quota */
-    /* otherwise add a new one to the list */
     epicsMutexMustLock ( evUser->lock );
-    ev_que = & evUser->firstque;
-    while ( TRUE ) {
-        int success = 0;
-        LOCKEVQUE ( ev_que );
-        success = ( ev_que->quota < EVENTQUESIZE - EVENTENTRIES );
-        if ( success ) {
-            ev_que->quota += EVENTENTRIES;
-        }
-        UNLOCKEVQUE ( ev_que );
-        if ( success ) {
-            break;
-        }
-        if ( ! ev_que->nextque ) {
-            ev_que->nextque = create_ev_que ( evUser );
-            if ( ! ev_que->nextque ) {
-                ev_que = NULL;
-                break;
-            }
-        }
-        ev_que = ev_que->nextque;
-    }
+    ev_que = reserve_ev_que ( evUser, evUser->nentries );
     epicsMutexUnlock ( evUser->lock );
 
     if ( ! ev_que ) {
@@ -476,13 +797,16 @@ dbEventSubscription db_add_event (
 
     pevent->npend =     0ul;
     pevent->nreplace =  0ul;
+    pevent->ncoalesce = 0ul;
+    pevent->nentries =  evUser->nentries;
     pevent->user_sub =  user_sub;
     pevent->user_arg =  user_arg;
     pevent->chan =      chan;
     pevent->select =    (unsigned char) select;
     pevent->pLastLog =  NULL; /* not yet in the queue */
-    pevent->callBackInProgress = FALSE;
+    pevent->callBackInProgress = 0u;
     pevent->enabled =   FALSE;
+    pevent->useSnapshot = FALSE;
     pevent->ev_que =    ev_que;
 
     /*
@@ -499,6 +823,12 @@ dbEventSubscription db_add_event (
         pevent->useValque = FALSE;
     }
 
+    if (dbEventSnapshotMinBytes > 0 &&
+        (unsigned long) dbChannelElements(chan) * dbChannelFieldSize(chan) >=
+            (unsigned long) dbEventSnapshotMinBytes) {
+        db_event_enable_snapshot(pevent);
+    }
+
     return pevent;
 }
 
@@ -513,11 +843,70 @@ void db_event_enable (dbEventSubscription event)
     LOCKREC (precord);
     if ( ! pevent->enabled ) {
         ellAdd (&precord->mlis, &pevent->node);
+        indexAdd (precord, pevent);
         pevent->enabled = TRUE;
     }
     UNLOCKREC (precord);
 }
 
+/*
+ * db_event_enable_snapshot()
+ *
+ * Ask for the value of an array field to be copied once for each
+ * db_post_events() call into an immutable snapshot shared by all the
+ * subscriptions which asked for one.  The field logs delivered to this
+ * subscription then remain valid after the record has been unlocked,
+ * and neither the filters nor the event task need the record lock to
+ * read them.  Filters which change the data work on a copy.
+ *
+ * Only numeric array fields qualify, returns TRUE if snapshots will be
+ * used.
+ */
+int db_event_enable_snapshot (dbEventSubscription event)
+{
+    struct evSubscrip * const pevent = (struct evSubscrip *) event;
+    struct dbChannel * const chan = pevent->chan;
+    short type = dbChannelFieldType(chan);
+
+    if (!pevent->useValque &&
+        dbChannelElements(chan) > 1 &&
+        type >= DBF_CHAR && type <= DBF_DOUBLE) {
+        pevent->useSnapshot = TRUE;
+    }
+    return pevent->useSnapshot;
+}
+
+/*
+ * db_event_queue_entries()
+ *
+ * Reserve nentries entries in the event queue for this subscription,
+ * instead of the event user's default, so that as many of its updates
+ * may wait for the event task before they start replacing each other.
+ * Must be called before db_event_enable().
+ */
+int db_event_queue_entries (dbEventSubscription event, unsigned nentries)
+{
+    struct evSubscrip * const pevent = (struct evSubscrip *) event;
+    struct event_user * const evUser = pevent->ev_que->evUser;
+    struct event_que *ev_que;
+
+    if (nentries == 0 || pevent->enabled || pevent->npend)
+        return DB_EVENT_ERROR;
+
+    epicsMutexMustLock ( evUser->lock );
+    ev_que = reserve_ev_que ( evUser, nentries );
+    if ( ev_que ) {
+        LOCKEVQUE ( pevent->ev_que );
+        release_ev_que ( pevent );
+        UNLOCKEVQUE ( pevent->ev_que );
+        pevent->ev_que = ev_que;
+        pevent->nentries = nentries;
+    }
+    epicsMutexUnlock ( evUser->lock );
+
+    return ev_que ? DB_EVENT_OK : DB_EVENT_ERROR;
+}
+
 /*
  * db_event_disable()
  */
@@ -529,6 +918,7 @@ void db_event_disable (dbEventSubscription event)
     LOCKREC (precord);
     if ( pevent->enabled ) {
         ellDelete(&precord->mlis, &pevent->node);
+        indexRemove (precord, pevent);
         pevent->enabled = FALSE;
     }
     UNLOCKREC (precord);
@@ -575,6 +965,8 @@ void db_cancel_event (dbEventSubscription event)
     LOCKEVQUE (que);
 
     pevent->user_sub = NULL; /* callback pointer doubles as canceled flag */
+    /* event_read() checks the rest of its batch */
+    epicsAtomicIncrIntT ( &que->ncancel );
 
     if(pevent->callBackInProgress) {
         /* this event callback is pending or in-progress in event_task. */
@@ -587,7 +979,7 @@ void db_cancel_event (dbEventSubscription event)
     } else {
         /* no other references, cleanup now */
 
-        pevent->ev_que->quota -= EVENTENTRIES;
+        release_ev_que ( pevent );
         freeListFree ( dbevEventSubscriptionFreeList, pevent );
     }
 
@@ -728,6 +1120,96 @@ static db_field_log* db_create_field_log (struct dbChannel *chan, int use_val)
     return pLog;
 }
 
+/*
+ * Reference counted copy of an array field, see db_event_enable_snapshot()
+ */
+typedef struct dbEventSnapshot {
+    int                 refcnt;
+    size_t              size;           /* of data */
+    void                *pfield;        /* field this is a copy of */
+    long                no_elements;
+    epicsFloat64        data[1];        /* actually no_elements long */
+} dbEventSnapshot;
+
+static void snapshotRelease (dbEventSnapshot *snap)
+{
+    if (epicsAtomicDecrIntT(&snap->refcnt) == 0 &&
+        epicsAtomicCmpAndSwapPtrT(&snapshotSpare, NULL, snap) != NULL)
+        free(snap);
+}
+
+static dbEventSnapshot* snapshotAlloc (size_t size)
+{
+    dbEventSnapshot *snap = epicsAtomicGetPtrT(&snapshotSpare);
+
+    while (snap) {
+        dbEventSnapshot *prev =
+            epicsAtomicCmpAndSwapPtrT(&snapshotSpare, snap, NULL);
+
+        if (prev == snap) {
+            if (snap->size == size)
+                return snap;
+            free(snap);
+            break;
+        }
+        snap = prev;
+    }
+    snap = malloc(offsetof(dbEventSnapshot, data) + size);
+    if (snap)
+        snap->size = size;
+    return snap;
+}
+
+static void snapshotDtor (db_field_log *pfl)
+{
+    snapshotRelease((dbEventSnapshot *) pfl->u.r.pvt);
+}
+
+/*
+ * NOTE: This assumes that the db scan lock is already applied
+ */
+static dbEventSnapshot* snapshotCreate (struct dbChannel *chan)
+{
+    long nelem = dbChannelElements(chan);
+    size_t size = (size_t) nelem * dbChannelFieldSize(chan);
+    dbEventSnapshot *snap;
+
+    snap = snapshotAlloc(size);
+    if (!snap)
+        return NULL;
+
+    if (dbChannelGet(chan, dbChannelExportType(chan),
+            snap->data, NULL, &nelem, NULL)) {
+        snap->refcnt = 1;
+        snapshotRelease(snap);
+        return NULL;
+    }
+    snap->refcnt = 1;
+    snap->pfield = dbChannelField(chan);
+    snap->no_elements = nelem;
+    return snap;
+}
+
+static db_field_log* db_create_snapshot_log (struct evSubscrip *pevent,
+    dbEventSnapshot *snap)
+{
+    db_field_log *pLog = db_create_event_log(pevent);
+
+    if (pLog) {
+        epicsAtomicIncrIntT(&snap->refcnt);
+        pLog->no_elements = snap->no_elements;
+        pLog->u.r.field = snap->data;
+        pLog->u.r.pvt = snap;
+        pLog->dtor = snapshotDtor;
+    }
+    return pLog;
+}
+
+int db_field_log_is_snapshot (const db_field_log *pfl)
+{
+    return pfl && pfl->type == dbfl_type_ref && pfl->dtor == snapshotDtor;
+}
+
 /*
  *  DB_CREATE_EVENT_LOG()
  *
@@ -760,6 +1242,69 @@ db_field_log* db_create_read_log (struct dbChannel *chan)
     return pLog;
 }
 
+/*
+ * ringReserve()
+ *
+ * Free entries at which a subscription with updates queued has its last
+ * one replaced.  A queue which may grow keeps one for each subscription
+ * using it, otherwise EVENTSPERQUE as always.
+ * event queue lock _must_ be applied
+ */
+static unsigned ringReserve ( const struct event_que *ev_que )
+{
+    return ev_que->evUser->maxQueBytes ? ev_que->nsubs : EVENTSPERQUE;
+}
+
+/*
+ * ev_que_grow()
+ *
+ * Double the size of a queue, up to the event user's byte budget, with
+ * the entries moved to its start.  Returns the unused space.
+ * event queue lock _must_ be applied
+ */
+static unsigned ev_que_grow ( struct event_que *ev_que )
+{
+    size_t maxSize = ev_que->evUser->maxQueBytes / EVENTENTRYBYTES;
+    unsigned used = ev_que->size - ringSpace ( ev_que );
+    unsigned size = ev_que->size, i;
+    db_field_log **valque;
+    struct evSubscrip **evque;
+
+    if ( maxSize > UINT_MAX / 2u ) {
+        maxSize = UINT_MAX / 2u;
+    }
+    if ( (size_t) size >= maxSize ) {
+        return size - used;
+    }
+    size = (size_t) size * 2u > maxSize ? (unsigned) maxSize : size * 2u;
+
+    valque = calloc ( size, sizeof ( *valque ) );
+    evque = calloc ( size, sizeof ( *evque ) );
+    if ( ! valque || ! evque ) {
+        free ( valque );
+        free ( evque );
+        return ev_que->size - used;
+    }
+    for ( i = 0u; i < used; i++ ) {
+        unsigned j = ( ev_que->getix + i ) % ev_que->size;
+        struct evSubscrip *pevent = ev_que->evque[j];
+
+        evque[i] = pevent;
+        valque[i] = ev_que->valque[j];
+        if ( pevent->pLastLog == &ev_que->valque[j] ) {
+            pevent->pLastLog = &valque[i];
+        }
+    }
+    free ( ev_que->valque );
+    free ( ev_que->evque );
+    ev_que->valque = valque;
+    ev_que->evque = evque;
+    ev_que->size = size;
+    ev_que->getix = 0u;
+    ev_que->putix = used;
+    return size - used;
+}
+
 /*
  *  DB_QUEUE_EVENT_LOG()
  *
@@ -785,6 +1330,7 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
     if (pevent->npend > 0u
             && !dbfl_has_copy(*pevent->pLastLog)
             && !dbfl_has_copy(pLog)) {
+        pevent->ncoalesce++;
         db_delete_field_log(pLog);
         UNLOCKEVQUE (ev_que);
         return;
@@ -800,8 +1346,12 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
      * then replace the last event on the queue (for this monitor)
      */
     rngSpace = ringSpace ( ev_que );
+    if ( pevent->npend>0u && !ev_que->evUser->flowCtrlMode &&
+        rngSpace<=ringReserve(ev_que) && ev_que->evUser->maxQueBytes ) {
+        rngSpace = ev_que_grow ( ev_que );
+    }
     if ( pevent->npend>0u &&
-        (ev_que->evUser->flowCtrlMode || rngSpace<=EVENTSPERQUE) ) {
+        (ev_que->evUser->flowCtrlMode || rngSpace<=ringReserve(ev_que)) ) {
         /*
          * replace last event if no space is left
          */
@@ -833,13 +1383,13 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
          * if the ring buffer was empty before
          * adding this event
          */
-        if (rngSpace==EVENTQUESIZE) {
+        if (rngSpace==ev_que->size) {
             firstEventFlag = 1;
         }
         else {
             firstEventFlag = 0;
         }
-        ev_que->putix = RNGINC ( ev_que->putix );
+        ev_que->putix = RNGINC ( ev_que, ev_que->putix );
     }
 
     UNLOCKEVQUE (ev_que);
@@ -858,6 +1408,46 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
     }
 }
 
+/*
+ *  DB_POST_FIELD_EVENTS()
+ *
+ *  NOTE: This assumes that the db scan lock and mlok are already applied
+ */
+static void db_post_field_events (dbEventField *pf, unsigned int caEventMask)
+{
+    dbEventSnapshot *snap = NULL;
+    ELLNODE *cur;
+
+    pf->nposts++;
+    for (cur = ellFirst(&pf->subs); cur; cur = ellNext(cur)) {
+        struct evSubscrip * const pevent =
+            CONTAINER(cur, struct evSubscrip, fieldNode);
+        db_field_log *pLog = NULL;
+
+        if (!(caEventMask & pevent->select))
+            continue;
+
+        if (pevent->useSnapshot) {
+            /* one copy for all subscriptions to the field */
+            if (!snap)
+                snap = snapshotCreate(pevent->chan);
+            if (snap)
+                pLog = db_create_snapshot_log(pevent, snap);
+        }
+        if (!pLog)
+            pLog = db_create_event_log(pevent);
+        if(pLog)
+            pLog->mask = caEventMask & pevent->select;
+        pLog = dbChannelRunPreChain(pevent->chan, pLog);
+        if (pLog) {
+            pf->nlogs++;
+            db_queue_event_log(pevent, pLog);
+        }
+    }
+    if (snap)
+        snapshotRelease(snap);
+}
+
 /*
  *  DB_POST_EVENTS()
  *
@@ -871,26 +1461,29 @@ unsigned int    caEventMask
 )
 {
     struct dbCommon   * const prec = (struct dbCommon *) pRecord;
-    struct evSubscrip *pevent;
+    struct dbEventIndex *pidx;
 
     if (prec->mlis.count == 0) return DB_EVENT_OK;       /* no monitors set */
 
     LOCKREC (prec);
 
-    for (pevent = (struct evSubscrip *) prec->mlis.node.next;
-        pevent; pevent = (struct evSubscrip *) pevent->node.next){
+    /*
+     * Only send event msg if they are waiting on the field which
+     * changed or pval==NULL, and are waiting on matching event
+     */
+    pidx = dbRec2Pvt(prec)->evIndex;
+    if (pField) {
+        dbEventField *pf = indexFind(pidx, pField);
 
-        /*
-         * Only send event msg if they are waiting on the field which
-         * changed or pval==NULL, and are waiting on matching event
-         */
-        if ( (dbChannelField(pevent->chan) == (void *)pField || pField==NULL) &&
-            (caEventMask & pevent->select)) {
-            db_field_log *pLog = db_create_event_log(pevent);
-            if(pLog)
-                pLog->mask = caEventMask & pevent->select;
-            pLog = dbChannelRunPreChain(pevent->chan, pLog);
-            if (pLog) db_queue_event_log(pevent, pLog);
+        if (pf && (caEventMask & pf->select))
+            db_post_field_events(pf, caEventMask);
+    }
+    else if (pidx) {
+        unsigned i;
+
+        for (i = 0; i < pidx->nfields; i++) {
+            if (caEventMask & pidx->fields[i].select)
+                db_post_field_events(&pidx->fields[i], caEventMask);
         }
     }
 
@@ -910,7 +1503,20 @@ void db_post_single_event (dbEventSubscription event)
 
     dbScanLock (prec);
 
-    pLog = db_create_event_log(pevent);
+    if (pevent->useSnapshot) {
+        dbEventSnapshot *snap = snapshotCreate(pevent->chan);
+
+        pLog = NULL;
+        if (snap) {
+            pLog = db_create_snapshot_log(pevent, snap);
+            snapshotRelease(snap);
+        }
+        if (!pLog)
+            pLog = db_create_event_log(pevent);
+    }
+    else {
+        pLog = db_create_event_log(pevent);
+    }
     pLog = dbChannelRunPreChain(pevent->chan, pLog);
     if(pLog) db_queue_event_log(pevent, pLog);
 
@@ -919,9 +1525,21 @@ void db_post_single_event (dbEventSubscription event)
 
 /*
  * EVENT_READ()
+ *
+ * Entries are taken off the queue a batch at a time, so the queue lock
+ * is taken twice for each batch rather than for each callback, and
+ * posting threads don't wait for the event task between updates.  The
+ * callback and its argument are taken with each entry, and the rest of
+ * a batch is checked again only after a db_cancel_event() on the queue.
  */
 static int event_read ( struct event_que *ev_que )
 {
+    struct {
+        struct evSubscrip   *pevent;
+        EVENTFUNC           *user_sub;
+        void                *user_arg;
+        db_field_log        *pfl;
+    } batch[EVENTBATCH];
     int notifiedRemaining = 0;
 
     /*
@@ -941,57 +1559,83 @@ static int event_read ( struct event_que *ev_que )
     }
 
     while ( ev_que->evque[ev_que->getix] != EVENTQEMPTY ) {
-        struct evSubscrip *pevent = ev_que->evque[ev_que->getix];
-        int eventsRemaining;
-        db_field_log *pfl = ev_que->valque[ev_que->getix];
-
-        /*
-         * Simple type values queued up for reliable interprocess
-         * communication. (for other types they get whatever happens
-         * to be there upon wakeup)
-         */
-
-        event_remove ( ev_que, ev_que->getix, EVENTQEMPTY );
-        ev_que->getix = RNGINC ( ev_que->getix );
-        eventsRemaining = ev_que->evque[ev_que->getix] != EVENTQEMPTY;
+        unsigned n, i;
+        int moreQueued;
+        int ncancel = epicsAtomicGetIntT ( &ev_que->ncancel );
+
+        for ( n = 0u; n < EVENTBATCH &&
+                ev_que->evque[ev_que->getix] != EVENTQEMPTY; n++ ) {
+            struct evSubscrip *pevent = ev_que->evque[ev_que->getix];
+
+            batch[n].pevent = pevent;
+            batch[n].user_sub = pevent->user_sub;
+            batch[n].user_arg = pevent->user_arg;
+            batch[n].pfl = ev_que->valque[ev_que->getix];
+            event_remove ( ev_que, ev_que->getix, EVENTQEMPTY );
+            ev_que->getix = RNGINC ( ev_que, ev_que->getix );
+            pevent->callBackInProgress++;
+        }
+        moreQueued = ev_que->evque[ev_que->getix] != EVENTQEMPTY;
 
         /*
-         * Next event pointer can be used by event tasks to determine
-         * if more events are waiting in the queue
-         *
          * Must remove the lock here so that we don't deadlock if
          * this calls dbGetField() and blocks on the record lock,
          * dbPutField() is in progress in another task, it has the
          * record lock, and it is calling db_post_events() waiting
          * for the event queue lock (which this thread now has).
          */
-        if ( pevent->user_sub ) {
-            EVENTFUNC* user_sub = pevent->user_sub;
-            pevent->callBackInProgress = TRUE;
+        UNLOCKEVQUE (ev_que);
+
+        for ( i = 0u; i < n; i++ ) {
+            struct evSubscrip *pevent = batch[i].pevent;
+            db_field_log *pfl = batch[i].pfl;
+            /*
+             * Tells event tasks whether more events are waiting,
+             * in this batch or the queue
+             */
+            int eventsRemaining = i + 1u < n || moreQueued;
 
-            UNLOCKEVQUE (ev_que);
+            /* skip the subscriptions canceled since, maybe by a callback */
+            if ( epicsAtomicGetIntT ( &ev_que->ncancel ) != ncancel ) {
+                unsigned j;
 
-            /* Run post-event-queue filter chain */
-            if (ellCount(&pevent->chan->post_chain)) {
-                pfl = dbChannelRunPostChain(pevent->chan, pfl);
+                LOCKEVQUE (ev_que);
+                for ( j = i; j < n; j++ ) {
+                    if ( ! batch[j].pevent->user_sub )
+                        batch[j].user_sub = NULL;
+                }
+                ncancel = epicsAtomicGetIntT ( &ev_que->ncancel );
+                UNLOCKEVQUE (ev_que);
             }
-            if (pfl) {
-                /* Issue user callback */
-                ( *user_sub ) ( pevent->user_arg, pevent->chan,
-                                eventsRemaining, pfl );
-                notifiedRemaining = eventsRemaining;
+
+            if ( batch[i].user_sub ) {
+                /* Run post-event-queue filter chain */
+                if (ellCount(&pevent->chan->post_chain)) {
+                    pfl = dbChannelRunPostChain(pevent->chan, pfl);
+                }
+                if (pfl) {
+                    /* Issue user callback */
+                    ( *batch[i].user_sub ) ( batch[i].user_arg, pevent->chan,
+                                    eventsRemaining, pfl );
+                    notifiedRemaining = eventsRemaining;
+                }
             }
+            db_delete_field_log(pfl);
+        }
 
-            LOCKEVQUE (ev_que);
+        LOCKEVQUE (ev_que);
 
-            pevent->callBackInProgress = FALSE;
-        }
-        /* callback may have called db_cancel_event(), so must check user_sub again */
-        if(!pevent->user_sub && !pevent->npend) {
-            pevent->ev_que->quota -= EVENTENTRIES;
-            freeListFree ( dbevEventSubscriptionFreeList, pevent );
+        for ( i = 0u; i < n; i++ ) {
+            struct evSubscrip *pevent = batch[i].pevent;
+
+            pevent->callBackInProgress--;
+            /* callback may have called db_cancel_event(), so must check user_sub again */
+            if ( ! pevent->user_sub && ! pevent->npend &&
+                    ! pevent->callBackInProgress ) {
+                release_ev_que ( pevent );
+                freeListFree ( dbevEventSubscriptionFreeList, pevent );
+            }
         }
-        db_delete_field_log(pfl);
     }
 
     if(notifiedRemaining && !ev_que->possibleStall) {
@@ -1067,7 +1711,7 @@ static void event_task (void *pParm)
 
     } while( ! pendexit );
 
-    epicsMutexDestroy(evUser->firstque.writelock);
+    ev_que_free(&evUser->firstque);
 
     {
         struct event_que    *nextque;
@@ -1075,7 +1719,7 @@ static void event_task (void *pParm)
         ev_que = evUser->firstque.nextque;
         while (ev_que) {
             nextque = ev_que->nextque;
-            epicsMutexDestroy(ev_que->writelock);
+            ev_que_free(ev_que);
             freeListFree(dbevEventQueueFreeList, ev_que);
             ev_que = nextque;
         }
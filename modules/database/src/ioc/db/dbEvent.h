@@ -45,6 +45,8 @@ DBCORE_API int db_event_list (
     const char *name, unsigned level);
 DBCORE_API int dbel (
     const char *name, unsigned level);
+DBCORE_API int dbelf (
+    const char *name, unsigned level);
 DBCORE_API int db_post_events (
     void *pRecord, void *pField, unsigned caEventMask );
 
@@ -77,10 +79,17 @@ DBCORE_API void db_cancel_event (dbEventSubscription es);
 DBCORE_API void db_post_single_event (dbEventSubscription es);
 DBCORE_API void db_event_enable (dbEventSubscription es);
 DBCORE_API void db_event_disable (dbEventSubscription es);
+DBCORE_API int db_event_enable_snapshot (dbEventSubscription es);
+DBCORE_API int db_event_queue_entries (dbEventSubscription es,
+    unsigned nentries);
+DBCORE_API extern int dbEventSnapshotMinBytes;
+DBCORE_API extern int dbEventQueueEntries;
+DBCORE_API extern int dbEventQueueMaxBytes;
 
 DBCORE_API struct db_field_log* db_create_event_log (struct evSubscrip *pevent);
 DBCORE_API struct db_field_log* db_create_read_log (struct dbChannel *chan);
 DBCORE_API void db_delete_field_log (struct db_field_log *pfl);
+DBCORE_API int db_field_log_is_snapshot (const struct db_field_log *pfl);
 DBCORE_API int db_available_logs(void);
 
 #define DB_EVENT_OK 0
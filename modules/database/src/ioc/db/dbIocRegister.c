@@ -25,6 +25,7 @@
 #include "dbScan.h"
 #include "dbServer.h"
 #include "dbState.h"
+#include "dbProfile.h"
 #include "db_test.h"
 #include "dbTest.h"
 
@@ -181,6 +182,21 @@ static void dbelCallFunc(const iocshArgBuf *args)
     iocshSetError(dbel(args[0].sval, args[1].ival));
 }
 
+/* dbelf */
+static const iocshArg dbelfArg0 = { "record name",iocshArgStringRecord};
+static const iocshArg dbelfArg1 = { "level",iocshArgInt};
+static const iocshArg * const dbelfArgs[2] = {&dbelfArg0,&dbelfArg1};
+static const iocshFuncDef dbelfFuncDef = {"dbelf",2,dbelfArgs,
+                                          "Database event list by field.\n"
+                                          "Show the dbEvent subscriptions to each field of a record,\n"
+                                          "and the mean number of monitor updates queued per post.\n"
+                                          "Level 1 also lists the subscriptions.\n"
+                                          "Example: dbelf aitest 1\n"};
+static void dbelfCallFunc(const iocshArgBuf *args)
+{
+    iocshSetError(dbelf(args[0].sval, args[1].ival));
+}
+
 /* dba */
 static const iocshArg dbaArg0 = { "record name",iocshArgStringRecord};
 static const iocshArg * const dbaArgs[1] = {&dbaArg0};
@@ -396,7 +412,7 @@ static const iocshArg * const dblsrArgs[2] = {&dblsrArg0,&dblsrArg1};
 static const iocshFuncDef dblsrFuncDef = {"dblsr",2,dblsrArgs,
                                           "Database Lockset report.\n"
                                           "Generate a report showing the lock set to which each record belongs.\n"
-                                          "interest level 0 - Show lock set information only.\n"
+                                          "interest level 0 - Show lock set information and contention counters only.\n"
                                           "               1 - Show each record in the lock set.\n"
                                           "               2 - Show each record and all database links in the lock set.\n\n"
                                           "Example: dblsr aitest 2\n"};
@@ -416,6 +432,27 @@ static const iocshFuncDef dbLockShowLockedFuncDef = {
 static void dbLockShowLockedCallFunc(const iocshArgBuf *args)
 { iocshSetError(dbLockShowLocked(args[0].ival));}
 
+/* dbLockShowContention */
+static const iocshArg dbLockShowContentionArg0 = { "count",iocshArgInt};
+static const iocshArg * const dbLockShowContentionArgs[1] = {&dbLockShowContentionArg0};
+static const iocshFuncDef dbLockShowContentionFuncDef = {
+    "dbLockShowContention",1,dbLockShowContentionArgs,
+    "Show the lock sets whose lock was waited for longest,\n"
+    "with how often they were locked, how long threads waited\n"
+    "for them and, if dbLockHoldTimes is set, how long they were held.\n"
+    "Shows count lock sets, or all of them if count is 0.\n"
+    "Counting starts when the IOC is running.\n"
+    "Example: dbLockShowContention 10\n"
+};
+static void dbLockShowContentionCallFunc(const iocshArgBuf *args)
+{ iocshSetError(dbLockShowContention(args[0].ival));}
+
+/* dbLockResetStats */
+static const iocshFuncDef dbLockResetStatsFuncDef = {"dbLockResetStats",0,0,
+    "Clear the lock set contention counters.\n"};
+static void dbLockResetStatsCallFunc(const iocshArgBuf *args)
+{ dbLockResetStats();}
+
 /* scanOnceSetQueueSize */
 static const iocshArg scanOnceSetQueueSizeArg0 = { "size",iocshArgInt};
 static const iocshArg * const scanOnceSetQueueSizeArgs[1] =
@@ -448,6 +485,20 @@ static const iocshFuncDef scanpplFuncDef = {"scanppl",1,scanpplArgs,
 static void scanpplCallFunc(const iocshArgBuf *args)
 { iocshSetError(scanppl(args[0].dval));}
 
+/* scanPeriodicThreads */
+static const iocshArg scanPeriodicThreadsArg0 = { "no of threads",iocshArgInt};
+static const iocshArg scanPeriodicThreadsArg1 = { "rate",iocshArgDouble};
+static const iocshArg * const scanPeriodicThreadsArgs[2] =
+    {&scanPeriodicThreadsArg0,&scanPeriodicThreadsArg1};
+static const iocshFuncDef scanPeriodicThreadsFuncDef = {"scanPeriodicThreads",2,scanPeriodicThreadsArgs,
+                                                        "Share each pass over a periodic scan list between threads,\n"
+                                                        "dividing its records by lock set.\n"
+                                                        "If no of threads <= 0, the number of CPUs plus no of threads.\n"
+                                                        "If rate == 0.0, applies to all periods.\n"
+                                                        "Must be called before iocInit().\n"};
+static void scanPeriodicThreadsCallFunc(const iocshArgBuf *args)
+{ iocshSetError(scanPeriodicThreads(args[0].ival, args[1].dval));}
+
 /* scanpel */
 static const iocshArg scanpelArg0 = { "event name",iocshArgString};
 static const iocshArg * const scanpelArgs[1] = {&scanpelArg0};
@@ -573,6 +624,41 @@ static void dbStateShowAllCallFunc (const iocshArgBuf *args)
     dbStateShowAll(args[0].ival);
 }
 
+/* dbProfileEnable */
+static const iocshArg dbProfileEnableArg0 = { "on", iocshArgInt };
+static const iocshArg * const dbProfileEnableArgs[] = { &dbProfileEnableArg0 };
+static const iocshFuncDef dbProfileEnableFuncDef = {"dbProfileEnable", 1, dbProfileEnableArgs,
+                                                    "Start (on=1) or stop (on=0) timing record processing.\n"};
+static void dbProfileEnableCallFunc (const iocshArgBuf *args)
+{
+    dbProfileEnable(args[0].ival);
+}
+
+/* dbProfileReport */
+static const iocshArg dbProfileReportArg0 = { "top", iocshArgInt };
+static const iocshArg dbProfileReportArg1 = { "scan", iocshArgString };
+static const iocshArg * const dbProfileReportArgs[] =
+    { &dbProfileReportArg0, &dbProfileReportArg1 };
+static const iocshFuncDef dbProfileReportFuncDef = {"dbProfileReport", 2, dbProfileReportArgs,
+                                                    "Show the records taking longest to process for each SCAN setting,\n"
+                                                    "counting chains of linked records against the record at their root,\n"
+                                                    "then the processing times by record type.\n"
+                                                    "Shows the top records, or all if top is 0.\n"
+                                                    "If scan is given, e.g. \"1 second\", only that scan list is shown.\n"
+                                                    "Times are in microseconds.\n"};
+static void dbProfileReportCallFunc (const iocshArgBuf *args)
+{
+    iocshSetError(dbProfileReport(args[0].ival, args[1].sval));
+}
+
+/* dbProfileReset */
+static const iocshFuncDef dbProfileResetFuncDef = {"dbProfileReset", 0, NULL,
+                                                   "Clear the record processing time counters.\n"};
+static void dbProfileResetCallFunc (const iocshArgBuf *args)
+{
+    iocshSetError(dbProfileReset());
+}
+
 void dbIocRegister(void)
 {
     iocshCompleteRecord = &dbCompleteRecord;
@@ -588,6 +674,7 @@ void dbIocRegister(void)
     iocshRegister(&dbsrFuncDef,dbsrCallFunc);
     iocshRegister(&dbcarFuncDef,dbcarCallFunc);
     iocshRegister(&dbelFuncDef,dbelCallFunc);
+    iocshRegister(&dbelfFuncDef,dbelfCallFunc);
     iocshRegister(&dbjlrFuncDef,dbjlrCallFunc);
 
     iocshRegister(&dbLoadDatabaseFuncDef,dbLoadDatabaseCallFunc);
@@ -615,10 +702,13 @@ void dbIocRegister(void)
     iocshRegister(&tpnFuncDef,tpnCallFunc);
     iocshRegister(&dblsrFuncDef,dblsrCallFunc);
     iocshRegister(&dbLockShowLockedFuncDef,dbLockShowLockedCallFunc);
+    iocshRegister(&dbLockShowContentionFuncDef,dbLockShowContentionCallFunc);
+    iocshRegister(&dbLockResetStatsFuncDef,dbLockResetStatsCallFunc);
 
     iocshRegister(&scanOnceSetQueueSizeFuncDef,scanOnceSetQueueSizeCallFunc);
     iocshRegister(&scanOnceQueueShowFuncDef,scanOnceQueueShowCallFunc);
     iocshRegister(&scanpplFuncDef,scanpplCallFunc);
+    iocshRegister(&scanPeriodicThreadsFuncDef,scanPeriodicThreadsCallFunc);
     iocshRegister(&scanpelFuncDef,scanpelCallFunc);
     iocshRegister(&postEventFuncDef,postEventCallFunc);
     iocshRegister(&scanpiolFuncDef,scanpiolCallFunc);
@@ -635,4 +725,8 @@ void dbIocRegister(void)
     iocshRegister(&dbStateClearFuncDef, dbStateClearCallFunc);
     iocshRegister(&dbStateShowFuncDef, dbStateShowCallFunc);
     iocshRegister(&dbStateShowAllFuncDef, dbStateShowAllCallFunc);
+
+    iocshRegister(&dbProfileEnableFuncDef, dbProfileEnableCallFunc);
+    iocshRegister(&dbProfileReportFuncDef, dbProfileReportCallFunc);
+    iocshRegister(&dbProfileResetFuncDef, dbProfileResetCallFunc);
 }
@@ -23,7 +23,9 @@
 #include "epicsSpin.h"
 #include "epicsStdio.h"
 #include "epicsThread.h"
+#include "epicsTime.h"
 #include "errMdef.h"
+#include "initHooks.h"
 
 #include "dbAccessDefs.h"
 #include "dbAddr.h"
@@ -34,6 +36,13 @@
 #include "dbLockPvt.h"
 #include "dbStaticLib.h"
 #include "link.h"
+#include "epicsExport.h"
+
+/* Time how long each lock set is held, which costs two clock reads
+ * every time a lock set is locked.
+ */
+int dbLockHoldTimes = 0;
+epicsExportAddress(int, dbLockHoldTimes);
 
 typedef struct dbScanLockNode dbScanLockNode;
 
@@ -56,12 +65,58 @@ static epicsMutexId lockSetsGuard;
 static size_t recomputeCnt;
 #endif
 
+static void dbLockStatsHook(initHookState state);
+
 /*private routines */
 static void dbLockOnce(void* ignore)
 {
     lockSetsGuard = epicsMutexMustCreate();
 }
 
+/* Take a lockSet's mutex, timing the wait if another thread holds it.
+ * Only the outermost lock taken by a thread is counted.
+ */
+static void lockSetLock(lockSet *ls)
+{
+    epicsUInt64 wait = 0;
+
+    if (epicsMutexTryLock(ls->lock) != epicsMutexLockOK) {
+        epicsUInt64 t0 = epicsMonotonicGet();
+
+        epicsMutexMustLock(ls->lock);
+        wait = epicsMonotonicGet() - t0;
+    }
+    if (ls->nest++)
+        return;
+
+    if (epicsAtomicGetIntT(&ls->resetStats)) {
+        memset(&ls->stats, 0, sizeof(ls->stats));
+        epicsAtomicSetIntT(&ls->resetStats, 0);
+    }
+    ls->stats.nlock++;
+    if (wait) {
+        ls->stats.ncontended++;
+        ls->stats.waitTotal += wait;
+        if (wait > ls->stats.waitMax)
+            ls->stats.waitMax = wait;
+    }
+    ls->lockedAt = dbLockHoldTimes ? epicsMonotonicGet() : 0;
+}
+
+static void lockSetUnlock(lockSet *ls)
+{
+    assert(ls->nest > 0);
+    if (--ls->nest == 0 && ls->lockedAt) {
+        epicsUInt64 hold = epicsMonotonicGet() - ls->lockedAt;
+
+        ls->stats.nheld++;
+        ls->stats.holdTotal += hold;
+        if (hold > ls->stats.holdMax)
+            ls->stats.holdMax = hold;
+    }
+    epicsMutexUnlock(ls->lock);
+}
+
 /* global ID number assigned to each lockSet on creation.
  * When the free-list is in use will never exceed
  * the number of records +1.
@@ -90,6 +145,10 @@ static lockSet* makeSet(void)
         epicsMutexMustLock(lockSetsGuard);
     }
 #endif
+    /* a lockSet from the free list starts counting again */
+    memset(&ls->stats, 0, sizeof(ls->stats));
+    ls->resetStats = 0;
+
     /* the initial reference for the first lockRecord */
     iref = epicsAtomicIncrIntT(&ls->refcount);
     ellAdd(&lockSetsActive, &ls->node);
@@ -193,7 +252,7 @@ void dbScanLock(dbCommon *precord)
     assert(epicsAtomicGetIntT(&ls->refcount)>0);
 
 retry:
-    epicsMutexMustLock(ls->lock);
+    lockSetLock(ls);
 
     epicsSpinLock(lr->spin);
     if(ls!=lr->plockSet) {
@@ -205,7 +264,7 @@ retry:
         assert(newcnt>=2); /* at least lockRecord and us */
         epicsSpinUnlock(lr->spin);
 
-        epicsMutexUnlock(ls->lock);
+        lockSetUnlock(ls);
         dbLockDecRef(ls);
 
         ls = ls2;
@@ -245,7 +304,7 @@ void dbScanUnlock(dbCommon *precord)
     if(ls->ownercount==0)
         ls->owner = NULL;
 #endif
-    epicsMutexUnlock(ls->lock);
+    lockSetUnlock(ls);
     dbLockDecRef(ls);
 }
 
@@ -322,6 +381,17 @@ int dbLockUpdateRefs(dbLocker *locker, int update)
     if(changed && update) {
         qsort(locker->refs, nlock, sizeof(lockRecordRef),
                                           &lrrcompare);
+        /* Sorting groups the refs to each lockSet together.
+         * Link the first of each group to the next group so that
+         * dbScanLockMany() visits each lockSet once.
+         */
+        for(i=0; i<nlock; ) {
+            size_t j = i+1;
+            while(j<nlock && locker->refs[j].plockSet==locker->refs[i].plockSet)
+                j++;
+            locker->refs[i].next = j;
+            i = j;
+        }
     }
     return changed;
 }
@@ -341,6 +411,7 @@ void dbLockerPrepare(struct dbLocker *locker,
 
     for(i=0; i<nrecs; i++) {
         locker->refs[i].plr = precs[i] ? precs[i]->lset : NULL;
+        locker->refs[i].next = i+1;
     }
 
     /* acquire a reference to all lockRecords */
@@ -398,18 +469,19 @@ retry:
     assert(ellCount(&locker->locked)==0);
     dbLockUpdateRefs(locker, 1);
 
-    for(i=0, plock=NULL; i<nlock; i++) {
+    for(i=0; i<nlock; i=locker->refs[i].next) {
         lockRecordRef *ref = &locker->refs[i];
 
         /* skip duplicates (same lockSet
          * referenced by more than one lockRecord).
-         * Sorting will group these together.
+         * Sorting groups these together, and unused
+         * slots sort last.
          */
-        if(!ref->plr || (plock && plock==ref->plockSet))
-            continue;
+        if(!ref->plr)
+            break;
         plock = ref->plockSet;
 
-        epicsMutexMustLock(plock->lock);
+        lockSetLock(plock);
         assert(plock->ownerlocker==NULL);
         plock->ownerlocker = locker;
         ellAdd(&locker->locked, &plock->lockernode);
@@ -465,7 +537,7 @@ void dbScanUnlockMany(dbLocker* locker)
             plock->owner = NULL;
 #endif
 
-        epicsMutexUnlock(plock->lock);
+        lockSetUnlock(plock);
         /* release ref for locked list */
         dbLockDecRef(plock);
     }
@@ -530,6 +602,8 @@ void dbLockInitRecords(dbBase *pdbbase)
 
     /* create all lockRecords and lockSets */
     forEachRecord(NULL, pdbbase, &createLockRecord);
+
+    initHookRegister(&dbLockStatsHook);
 }
 
 static int freeLockRecord(void* junk, DBENTRY* pdbentry)
@@ -615,6 +689,23 @@ void dbLockSetMerge(dbLocker *locker, dbCommon *pfirst, dbCommon *psecond)
     Nb = ellCount(&B->lockRecordList);
     assert(Nb>0);
 
+    /* A keeps the history of both */
+    if(!epicsAtomicGetIntT(&B->resetStats)) {
+        if(epicsAtomicGetIntT(&A->resetStats)) {
+            memset(&A->stats, 0, sizeof(A->stats));
+            epicsAtomicSetIntT(&A->resetStats, 0);
+        }
+        A->stats.nlock += B->stats.nlock;
+        A->stats.ncontended += B->stats.ncontended;
+        A->stats.waitTotal += B->stats.waitTotal;
+        if(B->stats.waitMax > A->stats.waitMax)
+            A->stats.waitMax = B->stats.waitMax;
+        A->stats.nheld += B->stats.nheld;
+        A->stats.holdTotal += B->stats.holdTotal;
+        if(B->stats.holdMax > A->stats.holdMax)
+            A->stats.holdMax = B->stats.holdMax;
+    }
+
     /* move all records from B to A */
     while((cur=ellGet(&B->lockRecordList))!=NULL)
     {
@@ -657,7 +748,7 @@ void dbLockSetMerge(dbLocker *locker, dbCommon *pfirst, dbCommon *psecond)
         B->ownerlocker = NULL;
         epicsAtomicDecrIntT(&B->refcount);
 
-        epicsMutexUnlock(B->lock);
+        lockSetUnlock(B);
     }
 
     dbLockDecRef(B); /* last ref we hold */
@@ -795,7 +886,7 @@ void dbLockSetSplit(dbLocker *locker, dbCommon *pfirst, dbCommon *psecond)
 
         splitset = makeSet(); /* reference for locker->locked */
 
-        epicsMutexMustLock(splitset->lock);
+        lockSetLock(splitset);
 
         assert(splitset->ownerlocker==NULL);
         ellAdd(&locker->locked, &splitset->lockernode);
@@ -871,6 +962,31 @@ nosplit:
 
 static const char *msstring[4]={"NMS","MS","MSI","MSS"};
 
+static void getStats(lockSet *plockSet, dbLockStats *pstats)
+{
+    if(epicsAtomicGetIntT(&plockSet->resetStats))
+        memset(pstats, 0, sizeof(*pstats));
+    else
+        *pstats = plockSet->stats;
+}
+
+static void showStats(const dbLockStats *pstats)
+{
+    printf("    locked %llu times, %llu contended (%.1f%%)",
+        (unsigned long long)pstats->nlock,
+        (unsigned long long)pstats->ncontended,
+        pstats->nlock ? 100.0 * pstats->ncontended / pstats->nlock : 0.0);
+    if(pstats->ncontended)
+        printf(", wait mean %.1f max %.1f usec",
+            pstats->waitTotal * 1e-3 / pstats->ncontended,
+            pstats->waitMax * 1e-3);
+    if(pstats->nheld)
+        printf(", hold mean %.1f max %.1f usec",
+            pstats->holdTotal * 1e-3 / pstats->nheld,
+            pstats->holdMax * 1e-3);
+    printf("\n");
+}
+
 long dblsr(char *recordname,int level)
 {
     int                 link;
@@ -903,8 +1019,12 @@ long dblsr(char *recordname,int level)
         plockSet = (lockSet *)ellFirst(&lockSetsActive);
     }
     for( ; plockSet; plockSet = (lockSet *)ellNext(&plockSet->node)) {
+        dbLockStats stats;
+
         printf("Lock Set %lu %d members %d refs epicsMutexId %p\n",
             plockSet->id,ellCount(&plockSet->lockRecordList),plockSet->refcount,plockSet->lock);
+        getStats(plockSet, &stats);
+        showStats(&stats);
 
         if(level==0) { if(recordname) break; continue; }
         for(plockRecord = (lockRecord *)ellFirst(&plockSet->lockRecordList);
@@ -972,6 +1092,93 @@ long dbLockShowLocked(int level)
     return 0;
 }
 
+long dbLockGetStats(dbCommon *precord, dbLockStats *pstats)
+{
+    lockSet *plockSet;
+
+    if(!precord->lset)
+        return -1; /* before iocInit */
+    plockSet = dbLockGetRef(precord->lset);
+    getStats(plockSet, pstats);
+    dbLockDecRef(plockSet);
+    return 0;
+}
+
+void dbLockResetStats(void)
+{
+    lockSet *plockSet;
+
+    epicsThreadOnce(&dbLockOnceInit, &dbLockOnce, NULL);
+    epicsMutexMustLock(lockSetsGuard);
+    for(plockSet = (lockSet *)ellFirst(&lockSetsActive); plockSet;
+        plockSet = (lockSet *)ellNext(&plockSet->node))
+        epicsAtomicSetIntT(&plockSet->resetStats, 1);
+    epicsMutexUnlock(lockSetsGuard);
+}
+
+/* Start counting when the IOC is running */
+static void dbLockStatsHook(initHookState state)
+{
+    if(state==initHookAfterIocRunning)
+        dbLockResetStats();
+}
+
+typedef struct {
+    lockSet *plockSet;
+    dbLockStats stats;
+} contention;
+
+static int cmpContention(const void *rawA, const void *rawB)
+{
+    const contention *A=rawA, *B=rawB;
+    if(A->stats.waitTotal!=B->stats.waitTotal)
+        return A->stats.waitTotal<B->stats.waitTotal ? 1 : -1;
+    if(A->stats.ncontended!=B->stats.ncontended)
+        return A->stats.ncontended<B->stats.ncontended ? 1 : -1;
+    if(A->stats.holdTotal!=B->stats.holdTotal)
+        return A->stats.holdTotal<B->stats.holdTotal ? 1 : -1;
+    return A->plockSet->id<B->plockSet->id ? -1 : A->plockSet->id>B->plockSet->id;
+}
+
+long dbLockShowContention(int top)
+{
+    contention *pcont;
+    lockSet *plockSet;
+    size_t n, i;
+
+    epicsThreadOnce(&dbLockOnceInit, &dbLockOnce, NULL);
+    epicsMutexMustLock(lockSetsGuard);
+    n = ellCount(&lockSetsActive);
+    pcont = n ? calloc(n, sizeof(*pcont)) : NULL;
+    if(n && !pcont) {
+        epicsMutexUnlock(lockSetsGuard);
+        fprintf(stderr, "Out of memory\n");
+        return -1;
+    }
+    for(i=0, plockSet = (lockSet *)ellFirst(&lockSetsActive); plockSet;
+        i++, plockSet = (lockSet *)ellNext(&plockSet->node)) {
+        pcont[i].plockSet = plockSet;
+        getStats(plockSet, &pcont[i].stats);
+    }
+    if(n)
+        qsort(pcont, n, sizeof(*pcont), cmpContention);
+
+    printf("Active lockSets: %lu\n", (unsigned long)n);
+    if(top>0 && (size_t)top<n)
+        n = top;
+    for(i=0; i<n; i++) {
+        lockRecord *plr = (lockRecord *)ellFirst(&pcont[i].plockSet->lockRecordList);
+
+        printf("Lock Set %lu %d members, first %s\n", pcont[i].plockSet->id,
+            ellCount(&pcont[i].plockSet->lockRecordList),
+            plr ? plr->precord->name : "-");
+        showStats(&pcont[i].stats);
+    }
+    epicsMutexUnlock(lockSetsGuard);
+    free(pcont);
+    return 0;
+}
+
 int * dbLockSetAddrTrace(dbCommon *precord)
 {
     lockRecord  *plockRecord = precord->lset;
@@ -16,6 +16,7 @@
 #include <stddef.h>
 
 #include "ellLib.h"
+#include "epicsTypes.h"
 #include "dbCoreAPI.h"
 
 #ifdef __cplusplus
@@ -34,6 +35,12 @@ struct dbBase;
  * While locked, dbScanLock() may be called only on those records
  * included in the dbLocker.
  *
+ * A dbLocker keeps the order in which to take the lock sets of its
+ * records, each lock set once.  The order is only checked again when lock
+ * sets have been merged or split, so code which locks the same records
+ * repeatedly should keep its dbLocker rather than allocate a new one each
+ * time.
+ *
  * @since 3.16.0.1
  */
 struct dbLocker;
@@ -98,6 +105,38 @@ DBCORE_API long dblsr(char *recordname,int level);
 
 DBCORE_API long dbLockShowLocked(int level);
 
+/** @brief Lock set contention counters
+ *
+ * Only the outermost lock of a record or dbLocker taken by a thread is
+ * counted.  Times are in nsec.
+ */
+typedef struct dbLockStats {
+    epicsUInt64 nlock;          /**< Times locked */
+    epicsUInt64 ncontended;     /**< Times another thread held the lock */
+    epicsUInt64 waitTotal;      /**< Time spent waiting for the lock */
+    epicsUInt64 waitMax;
+    epicsUInt64 nheld;          /**< Times held while dbLockHoldTimes was set */
+    epicsUInt64 holdTotal;      /**< Time held in those times */
+    epicsUInt64 holdMax;
+} dbLockStats;
+
+/** @brief Non-zero to count the time lock sets are held. */
+DBCORE_API extern int dbLockHoldTimes;
+
+/** @brief Get the contention counters of a record's lock set.
+ *
+ * The counters are read without locking the lock set, so this may be
+ * called while processing a record in another lock set.
+ * @return 0, or non-zero before iocInit.
+ */
+DBCORE_API long dbLockGetStats(struct dbCommon *precord, dbLockStats *pstats);
+/** @brief Clear the contention counters of every lock set. */
+DBCORE_API void dbLockResetStats(void);
+/** @brief Show the lock sets waited for longest.
+ * @param top Number of lock sets to show, 0 for all.
+ */
+DBCORE_API long dbLockShowContention(int top);
+
 /*KLUDGE to support field TPRO*/
 DBCORE_API int * dbLockSetAddrTrace(struct dbCommon *precord);
 
@@ -40,6 +40,11 @@ typedef struct dbLockSet {
     ELLNODE             lockernode;
 
     int                 trace; /*For field TPRO*/
+
+    unsigned            nest;       /* times locked by the owning thread */
+    epicsUInt64         lockedAt;   /* when the owner took the lock */
+    int                 resetStats; /* atomic, clear stats when next locked */
+    dbLockStats         stats;
 } lockSet;
 
 struct lockRecord;
@@ -75,6 +80,10 @@ typedef struct {
      * is locked.
      */
     lockSet *plockSet;
+    /* index of the first ref to the next lockSet in sorted order,
+     * valid for the first ref to each lockSet.
+     */
+    size_t next;
 } lockRecordRef;
 
 #define DBLOCKER_NALLOC 2
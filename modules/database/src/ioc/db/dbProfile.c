@@ -0,0 +1,374 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Record processing time profiler
+ *
+ * dbProcess() keeps a frame on its stack for each record it processes
+ * while profiling, and the frames of a thread are linked through a thread
+ * private pointer.  When a record finishes, its elapsed time is added to
+ * its parent's children so the parent's own time can exclude it, and the
+ * record at the root of the chain also counts the whole chain.
+ *
+ * The counters of a record are allocated when it is first profiled and
+ * are protected by its lock set.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "epicsTypes.h"
+
+#include "dbAccessDefs.h"
+#include "dbBase.h"
+#include "dbCommon.h"
+#include "dbCommonPvt.h"
+#include "dbLock.h"
+#include "dbProfile.h"
+#include "dbStaticLib.h"
+
+#define NBUCKETS NELEMENTS(((dbProfileStats *) 0)->hist)
+
+volatile int dbProfileActive;
+
+static epicsThreadOnceId profileOnce = EPICS_THREAD_ONCE_INIT;
+static epicsThreadPrivateId frameKey;
+
+static void profileInit(void *junk)
+{
+    frameKey = epicsThreadPrivateCreate();
+}
+
+void dbProfileEnable(int on)
+{
+    epicsThreadOnce(&profileOnce, profileInit, NULL);
+    dbProfileActive = !!on;
+}
+
+/* Bucket 0 holds times under 64 nsec, then two buckets per octave */
+static unsigned bucketOf(epicsUInt64 t)
+{
+    epicsUInt64 v = t;
+    unsigned b = 0, i;
+
+    if (t < 64)
+        return 0;
+    if (v >> 32) { v >>= 32; b += 32; }
+    if (v >> 16) { v >>= 16; b += 16; }
+    if (v >> 8)  { v >>= 8;  b += 8; }
+    if (v >> 4)  { v >>= 4;  b += 4; }
+    if (v >> 2)  { v >>= 2;  b += 2; }
+    if (v >> 1)  { b += 1; }
+    i = 1 + 2 * (b - 6) + (unsigned) ((t >> (b - 1)) & 1);
+    return i < NBUCKETS ? i : NBUCKETS - 1;
+}
+
+static epicsUInt64 bucketTop(unsigned i)
+{
+    unsigned b = 6 + (i - 1) / 2;
+
+    if (i == 0)
+        return 64;
+    return (1ull << b) + (((i - 1) & 1) + 1) * (1ull << (b - 1));
+}
+
+static void statsAdd(dbProfileStats *pstats, epicsUInt64 t)
+{
+    pstats->count++;
+    pstats->total += t;
+    if (t > pstats->max)
+        pstats->max = t;
+    pstats->hist[bucketOf(t)]++;
+}
+
+static void statsMerge(dbProfileStats *pto, const dbProfileStats *pfrom)
+{
+    unsigned i;
+
+    pto->count += pfrom->count;
+    pto->total += pfrom->total;
+    if (pfrom->max > pto->max)
+        pto->max = pfrom->max;
+    for (i = 0; i < NBUCKETS; i++)
+        pto->hist[i] += pfrom->hist[i];
+}
+
+epicsUInt64 dbProfilePercentile(const dbProfileStats *pstats,
+    double fraction)
+{
+    epicsUInt64 target = (epicsUInt64) (fraction * pstats->count + 0.5);
+    epicsUInt64 sum = 0;
+    unsigned i;
+
+    if (!pstats->count)
+        return 0;
+    if (target < 1)
+        target = 1;
+    for (i = 0; i < NBUCKETS - 1; i++) {
+        sum += pstats->hist[i];
+        if (sum >= target)
+            break;
+    }
+    if (i == NBUCKETS - 1 || bucketTop(i) > pstats->max)
+        return pstats->max;
+    return bucketTop(i);
+}
+
+void dbProfileEnter(dbProfileFrame *pframe)
+{
+    pframe->parent = epicsThreadPrivateGet(frameKey);
+    pframe->children = 0;
+    epicsThreadPrivateSet(frameKey, pframe);
+    pframe->start = epicsMonotonicGet();
+}
+
+void dbProfileExit(dbCommon *prec, dbProfileFrame *pframe)
+{
+    epicsUInt64 elapsed = epicsMonotonicGet() - pframe->start;
+    dbCommonPvt *ppvt = dbRec2Pvt(prec);
+    dbProfileRecord *pprof = ppvt->profile;
+
+    if (!pprof)
+        pprof = ppvt->profile = calloc(1, sizeof(dbProfileRecord));
+    if (pprof) {
+        statsAdd(&pprof->self, elapsed > pframe->children ?
+            elapsed - pframe->children : 0);
+        if (!pframe->parent)
+            statsAdd(&pprof->chain, elapsed);
+    }
+    if (pframe->parent)
+        pframe->parent->children += elapsed;
+    epicsThreadPrivateSet(frameKey, pframe->parent);
+}
+
+long dbProfileGet(dbCommon *prec, dbProfileRecord *pprof)
+{
+    dbProfileRecord *psrc;
+
+    dbScanLock(prec);
+    psrc = dbRec2Pvt(prec)->profile;
+    if (psrc)
+        *pprof = *psrc;
+    dbScanUnlock(prec);
+    return !psrc;
+}
+
+long dbProfileReset(void)
+{
+    DBENTRY dbentry;
+    long status;
+
+    if (!pdbbase) {
+        fprintf(stderr, "No database loaded\n");
+        return -1;
+    }
+    dbInitEntry(pdbbase, &dbentry);
+    for (status = dbFirstRecordType(&dbentry); !status;
+            status = dbNextRecordType(&dbentry)) {
+        for (status = dbFirstRecord(&dbentry); !status;
+                status = dbNextRecord(&dbentry)) {
+            dbCommon *prec = dbentry.precnode->precord;
+
+            if (dbIsAlias(&dbentry) || !prec)
+                continue;
+            dbScanLock(prec);
+            if (dbRec2Pvt(prec)->profile)
+                memset(dbRec2Pvt(prec)->profile, 0, sizeof(dbProfileRecord));
+            dbScanUnlock(prec);
+        }
+    }
+    dbFinishEntry(&dbentry);
+    return 0;
+}
+
+typedef struct profEntry {
+    dbCommon *prec;
+    epicsUInt64 chainTotal;
+    epicsUInt64 selfTotal;
+} profEntry;
+
+static int cmpEntry(const void *a, const void *b)
+{
+    const profEntry *pa = a, *pb = b;
+
+    if (pa->chainTotal != pb->chainTotal)
+        return pa->chainTotal < pb->chainTotal ? 1 : -1;
+    if (pa->selfTotal != pb->selfTotal)
+        return pa->selfTotal < pb->selfTotal ? 1 : -1;
+    return strcmp(pa->prec->name, pb->prec->name);
+}
+
+static void printStats(const dbProfileStats *pstats)
+{
+    if (!pstats->count) {
+        printf(" %9s %8s %8s %8s %8s", "0", "-", "-", "-", "-");
+        return;
+    }
+    printf(" %9llu %8.2f %8.2f %8.2f %8.2f",
+        (unsigned long long) pstats->count,
+        pstats->total * 1e-3 / pstats->count,
+        dbProfilePercentile(pstats, 0.5) * 1e-3,
+        dbProfilePercentile(pstats, 0.99) * 1e-3,
+        pstats->max * 1e-3);
+}
+
+static void printHeader(const char *what)
+{
+    printf("  %-28s %9s %8s %8s %8s %8s", what,
+        "count", "mean", "p50", "p99", "max");
+}
+
+/* Count the profiled records with a SCAN setting, storing up to max */
+static size_t collect(int scan, profEntry *pentries, size_t max)
+{
+    DBENTRY dbentry;
+    size_t n = 0;
+    long status;
+
+    dbInitEntry(pdbbase, &dbentry);
+    for (status = dbFirstRecordType(&dbentry); !status;
+            status = dbNextRecordType(&dbentry)) {
+        for (status = dbFirstRecord(&dbentry); !status;
+                status = dbNextRecord(&dbentry)) {
+            dbCommon *prec = dbentry.precnode->precord;
+            dbProfileRecord prof;
+
+            if (dbIsAlias(&dbentry) || !prec || prec->scan != scan ||
+                    dbProfileGet(prec, &prof) || !prof.self.count)
+                continue;
+            if (n < max) {
+                pentries[n].prec = prec;
+                pentries[n].chainTotal = prof.chain.total;
+                pentries[n].selfTotal = prof.self.total;
+            }
+            n++;
+        }
+    }
+    dbFinishEntry(&dbentry);
+    return n;
+}
+
+static void reportScan(int top, int scan, const char *name)
+{
+    size_t n = collect(scan, NULL, 0), i;
+    profEntry *pentries;
+    epicsUInt64 total = 0;
+
+    if (!n)
+        return;
+    pentries = calloc(n, sizeof(profEntry));
+    if (!pentries) {
+        fprintf(stderr, "Out of memory\n");
+        return;
+    }
+    /* ignoring any records profiled since counting them */
+    i = collect(scan, pentries, n);
+    if (i < n)
+        n = i;
+    for (i = 0; i < n; i++)
+        total += pentries[i].chainTotal;
+    qsort(pentries, n, sizeof(profEntry), cmpEntry);
+
+    printf("Scan \"%s\": %lu record%s profiled, chains took %.3f msec\n",
+        name, (unsigned long) n, n == 1 ? "" : "s", total * 1e-6);
+    printHeader("record (usec)");
+    printf("  %9s %8s %8s %8s %8s\n", "chains", "mean", "p50", "p99", "max");
+    if (top > 0 && (size_t) top < n)
+        n = top;
+    for (i = 0; i < n; i++) {
+        dbProfileRecord prof;
+
+        if (dbProfileGet(pentries[i].prec, &prof))
+            continue;
+        printf("  %-28s", pentries[i].prec->name);
+        printStats(&prof.self);
+        printf(" ");
+        printStats(&prof.chain);
+        printf("\n");
+    }
+    free(pentries);
+}
+
+static void reportTypes(void)
+{
+    DBENTRY dbentry;
+    long status;
+    int first = 1;
+
+    dbInitEntry(pdbbase, &dbentry);
+    for (status = dbFirstRecordType(&dbentry); !status;
+            status = dbNextRecordType(&dbentry)) {
+        dbProfileStats stats;
+        unsigned long nrec = 0;
+
+        memset(&stats, 0, sizeof(stats));
+        for (status = dbFirstRecord(&dbentry); !status;
+                status = dbNextRecord(&dbentry)) {
+            dbCommon *prec = dbentry.precnode->precord;
+            dbProfileRecord prof;
+
+            if (dbIsAlias(&dbentry) || !prec ||
+                    dbProfileGet(prec, &prof) || !prof.self.count)
+                continue;
+            statsMerge(&stats, &prof.self);
+            nrec++;
+        }
+        if (!nrec)
+            continue;
+        if (first) {
+            printf("By record type:\n");
+            printHeader("type (usec)");
+            printf(" %8s\n", "records");
+            first = 0;
+        }
+        printf("  %-28s", dbGetRecordTypeName(&dbentry));
+        printStats(&stats);
+        printf(" %8lu\n", nrec);
+    }
+    dbFinishEntry(&dbentry);
+}
+
+long dbProfileReport(int top, const char *scan)
+{
+    dbMenu *pmenu;
+    int i;
+
+    if (!pdbbase) {
+        fprintf(stderr, "No database loaded\n");
+        return -1;
+    }
+    pmenu = dbFindMenu(pdbbase, "menuScan");
+    if (!pmenu) {
+        fprintf(stderr, "menuScan not found\n");
+        return -1;
+    }
+    if (scan && !*scan)
+        scan = NULL;
+    for (i = 0; scan && i < pmenu->nChoice; i++) {
+        if (strcmp(scan, pmenu->papChoiceValue[i]) == 0)
+            break;
+    }
+    if (i == pmenu->nChoice) {
+        fprintf(stderr, "No SCAN setting \"%s\"\n", scan);
+        return -1;
+    }
+
+    printf("Record processing profiler %s\n",
+        dbProfileActive ? "enabled" : "disabled");
+    for (i = 0; i < pmenu->nChoice; i++) {
+        if (!scan || strcmp(scan, pmenu->papChoiceValue[i]) == 0)
+            reportScan(top, i, pmenu->papChoiceValue[i]);
+    }
+    if (!scan)
+        reportTypes();
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#ifndef INCdbProfileH
+#define INCdbProfileH
+
+#include "epicsTypes.h"
+#include "dbCoreAPI.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file dbProfile.h
+ * @brief Record processing time profiler
+ *
+ * While enabled, dbProcess() measures how long each record takes to process
+ * and keeps a histogram of these times for every record processed.  The
+ * time a record spends processing other records through its links (FLNK,
+ * or DB links with PP) is not counted against it; instead the whole chain
+ * is also timed and counted against the record at its root, the one which
+ * a scan thread, callback or server started processing.
+ *
+ * Only the synchronous part of processing is timed: an asynchronous record
+ * is timed until its record support returns with PACT set.
+ *
+ * The facility is also provided as IOC Shell commands.
+ */
+
+struct dbCommon;
+
+/** @brief Histogram of processing times */
+typedef struct dbProfileStats {
+    epicsUInt64 count;
+    epicsUInt64 total;      /**< Sum of the times, in nsec */
+    epicsUInt64 max;        /**< Longest time, in nsec */
+    /** Times by half-octave, bucket 0 counts those under 64 nsec */
+    epicsUInt32 hist[48];
+} dbProfileStats;
+
+/** @brief Profile of one record */
+typedef struct dbProfileRecord {
+    dbProfileStats self;    /**< Processing times of the record alone */
+    dbProfileStats chain;   /**< Times of the chains started by the record */
+} dbProfileRecord;
+
+/** @brief Non-zero while the profiler is enabled. */
+DBCORE_API extern volatile int dbProfileActive;
+
+/** @brief Start or stop profiling record processing.
+ *
+ * The counters are kept while the profiler is stopped.
+ *
+ * @param on Non-zero to start profiling, zero to stop.
+ */
+DBCORE_API void dbProfileEnable(int on);
+
+/** @brief Clear the counters of every record.
+ * @return 0 or error status.
+ */
+DBCORE_API long dbProfileReset(void);
+
+/** @brief Print the records taking the longest, by scan list.
+ *
+ * For each SCAN setting the records are sorted by the total time of the
+ * chains started from them, then by their own total time.  A summary by
+ * record type follows.
+ *
+ * @param top Number of records to show for each scan list, 0 for all.
+ * @param scan SCAN setting to show, e.g. "1 second", NULL or "" for all.
+ * @return 0 or error status.
+ */
+DBCORE_API long dbProfileReport(int top, const char *scan);
+
+/** @brief Get a copy of the counters of a record.
+ * @param prec The record, which the caller must not have locked.
+ * @param pprof Where to copy the counters to.
+ * @return 0 if the record has been profiled, non-zero if not.
+ */
+DBCORE_API long dbProfileGet(struct dbCommon *prec, dbProfileRecord *pprof);
+
+/** @brief Estimate a percentile from a histogram.
+ * @param pstats The histogram.
+ * @param fraction The percentile as a fraction, e.g. 0.99.
+ * @return The upper bound of the bucket holding it, in nsec, limited to the
+ * longest time seen.
+ */
+DBCORE_API epicsUInt64 dbProfilePercentile(const dbProfileStats *pstats,
+    double fraction);
+
+/* Used by dbProcess() */
+typedef struct dbProfileFrame {
+    struct dbProfileFrame *parent;
+    epicsUInt64 start;
+    epicsUInt64 children;
+} dbProfileFrame;
+
+DBCORE_API void dbProfileEnter(dbProfileFrame *pframe);
+DBCORE_API void dbProfileExit(struct dbCommon *prec, dbProfileFrame *pframe);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCdbProfileH */
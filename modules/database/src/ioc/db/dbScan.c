@@ -70,10 +70,22 @@ static void *exitOnce;
 
 
 /* All other scan types */
+
+/* The records of a scan list in PHAS order as of one version of the list,
+ * kept until the list changes and the passes using it have finished.
+ */
+typedef struct scan_snapshot {
+    int                 refs;
+    unsigned            version;
+    size_t              nrecs;
+    struct dbCommon     *precs[1];  /* actually nrecs long */
+} scan_snapshot;
+
 typedef struct scan_list{
     epicsMutexId        lock;
     ELLLIST             list;
-    short               modified;/*has list been modified?*/
+    unsigned            version;    /* changed by each add or delete */
+    scan_snapshot       *snap;      /* of some version of list, or NULL */
 } scan_list;
 /*scan_elements are allocated and the address stored in dbCommon.spvt*/
 typedef struct scan_element{
@@ -87,6 +99,18 @@ typedef struct scan_element{
 
 #define OVERRUN_REPORT_DELAY 10.0   /* Time between initial reports */
 #define OVERRUN_REPORT_MAX 3600.0   /* Maximum time between reports */
+struct periodic_scan_list;
+
+/* One of the threads sharing each pass over a periodic scan list */
+typedef struct periodic_worker {
+    struct periodic_scan_list *ppsl;
+    epicsThreadId       tid;
+    epicsEventId        start;
+    struct dbCommon     **precs;    /* this pass's records, in list order */
+    size_t              nrecs;
+    int                 stop;
+} periodic_worker;
+
 typedef struct periodic_scan_list {
     scan_list           scan_list;
     double              period;
@@ -94,8 +118,24 @@ typedef struct periodic_scan_list {
     unsigned long       overruns;
     volatile enum ctl   scanCtl;
     epicsEventId        loopEvent;
+    /* Passes split by lock set, see scanPeriodicThreads() */
+    int                 nworkers;
+    periodic_worker     *workers;   /* [0] is the periodicTask itself */
+    struct dbCommon     **precs;    /* the workers' records */
+    unsigned            *part;      /* and which worker has each */
+    size_t              nalloc;
+    int                 busy;       /* workers still in this pass */
+    epicsEventId        passDone;
 } periodic_scan_list;
 
+/* scanPeriodicThreads() requests, applied by initPeriodic() */
+typedef struct periodic_threads {
+    ELLNODE             node;
+    double              period;     /* 0.0 for all */
+    int                 count;
+} periodic_threads;
+static ELLLIST periodicThreads = ELLLIST_INIT;
+
 static int nPeriodic = 0;
 static periodic_scan_list **papPeriodic; /* pointer to array of pointers */
 static epicsThreadId *periodicTaskId;    /* array of thread ids */
@@ -146,7 +186,12 @@ static void ioscanInit(void);
 static void ioscanCallback(epicsCallback *pcallback);
 static void ioscanDestroy(void);
 static void printList(scan_list *psl, char *message);
+static scan_snapshot *snapshotGet(scan_list *psl);
+static void snapshotRelease(scan_snapshot *snap);
+static void scanRecords(scan_list *psl, struct dbCommon **precs,
+    size_t nrecs);
 static void scanList(scan_list *psl);
+static void scanListFree(scan_list *psl);
 static void buildScanLists(void);
 static void addToList(struct dbCommon *precord, scan_list *psl);
 static void deleteFromList(struct dbCommon *precord, scan_list *psl);
@@ -401,8 +446,12 @@ int scanppl(double period)      /* print periodic scan list(s) */
             (fabs(period - ppsl->period) > 0.05))
             continue;
 
-        sprintf(message, "Records with SCAN = '%s' (%lu over-runs):",
-            ppsl->name, ppsl->overruns);
+        if (ppsl->nworkers > 1)
+            sprintf(message, "Records with SCAN = '%s' (%lu over-runs, "
+                "%d threads):", ppsl->name, ppsl->overruns, ppsl->nworkers);
+        else
+            sprintf(message, "Records with SCAN = '%s' (%lu over-runs):",
+                ppsl->name, ppsl->overruns);
         printList(&ppsl->scan_list, message);
     }
     return 0;
@@ -575,10 +624,8 @@ static void ioscanDestroy(void)
         ioscan_head *pnext = piosh->next;
         int prio;
 
-        for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsMutexDestroy(piosh->iosl[prio].scan_list.lock);
-            ellFree(&piosh->iosl[prio].scan_list.list);
-        }
+        for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++)
+            scanListFree(&piosh->iosl[prio].scan_list);
         free(piosh);
         piosh = pnext;
     }
@@ -779,6 +826,145 @@ static void initOnce(void)
     epicsEventWait(startStopEvent);
 }
 
+int scanPeriodicThreads(int count, double period)
+{
+    periodic_threads *ppt;
+
+    if (papPeriodic) {
+        fprintf(stderr, "scanPeriodicThreads: "
+            "Scan system already initialized\n");
+        return -1;
+    }
+    if (period < 0.0) {
+        fprintf(stderr, "scanPeriodicThreads: Bad period %g\n", period);
+        return -1;
+    }
+
+    if (count <= 0)
+        count = epicsThreadGetCPUs() + count;
+    if (count < 1) count = 1;
+
+    ppt = dbCalloc(1, sizeof(periodic_threads));
+    ppt->period = period;
+    ppt->count = count;
+    ellAdd(&periodicThreads, &ppt->node);
+    return 0;
+}
+
+/* Share a pass over a periodic scan list between its workers.
+ * Records with the same lock set go to the same worker, in list order,
+ * and the pass ends when every worker has finished its share.
+ */
+static void scanListWorkers(periodic_scan_list *ppsl)
+{
+    scan_snapshot *snap = snapshotGet(&ppsl->scan_list);
+    const int nworkers = ppsl->nworkers;
+    const size_t n = snap->nrecs;
+    struct dbCommon **precs;
+    size_t i;
+    int w;
+
+    if (n > ppsl->nalloc) {
+        free(ppsl->precs);
+        free(ppsl->part);
+        ppsl->nalloc = n + n / 4;
+        ppsl->precs = dbCalloc(ppsl->nalloc, sizeof(struct dbCommon *));
+        ppsl->part = dbCalloc(ppsl->nalloc, sizeof(unsigned));
+    }
+    for (w = 0; w < nworkers; w++)
+        ppsl->workers[w].nrecs = 0;
+    for (i = 0; i < n; i++) {
+        unsigned part = dbLockGetLockId(snap->precs[i]) % nworkers;
+
+        ppsl->part[i] = part;
+        ppsl->workers[part].nrecs++;
+    }
+    for (w = 0, precs = ppsl->precs; w < nworkers; w++) {
+        ppsl->workers[w].precs = precs;
+        precs += ppsl->workers[w].nrecs;
+        ppsl->workers[w].nrecs = 0;
+    }
+    for (i = 0; i < n; i++) {
+        periodic_worker *pw = &ppsl->workers[ppsl->part[i]];
+
+        pw->precs[pw->nrecs++] = snap->precs[i];
+    }
+    snapshotRelease(snap);
+
+    epicsAtomicSetIntT(&ppsl->busy, nworkers - 1);
+    for (w = 1; w < nworkers; w++)
+        epicsEventMustTrigger(ppsl->workers[w].start);
+    scanRecords(&ppsl->scan_list, ppsl->workers[0].precs,
+        ppsl->workers[0].nrecs);
+    epicsEventMustWait(ppsl->passDone);
+}
+
+static void periodicWorker(void *arg)
+{
+    periodic_worker *pw = (periodic_worker *)arg;
+    periodic_scan_list *ppsl = pw->ppsl;
+
+    taskwdInsert(0, NULL, NULL);
+
+    while (1) {
+        epicsEventMustWait(pw->start);
+        if (pw->stop)
+            break;
+        scanRecords(&ppsl->scan_list, pw->precs, pw->nrecs);
+        if (epicsAtomicDecrIntT(&ppsl->busy) == 0)
+            epicsEventMustTrigger(ppsl->passDone);
+    }
+
+    taskwdRemove(0);
+}
+
+static void spawnWorkers(periodic_scan_list *ppsl)
+{
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    int w;
+
+    opts.joinable = 1;
+    opts.priority = epicsThreadGetPrioritySelf();
+    opts.stackSize = epicsThreadStackBig;
+
+    ppsl->workers = dbCalloc(ppsl->nworkers, sizeof(periodic_worker));
+    ppsl->passDone = epicsEventMustCreate(epicsEventEmpty);
+    for (w = 0; w < ppsl->nworkers; w++) {
+        periodic_worker *pw = &ppsl->workers[w];
+        char taskName[40];
+
+        pw->ppsl = ppsl;
+        if (w == 0) continue;
+        pw->start = epicsEventMustCreate(epicsEventEmpty);
+        sprintf(taskName, "scan-%g-%d", ppsl->period, w);
+        pw->tid = epicsThreadCreateOpt(taskName, periodicWorker, pw, &opts);
+        if (!pw->tid)
+            cantProceed("dbScan: Can't create %s thread\n", taskName);
+    }
+}
+
+static void stopWorkers(periodic_scan_list *ppsl)
+{
+    int w;
+
+    for (w = 1; w < ppsl->nworkers; w++) {
+        periodic_worker *pw = &ppsl->workers[w];
+
+        pw->stop = TRUE;
+        epicsEventMustTrigger(pw->start);
+        epicsThreadMustJoin(pw->tid);
+        epicsEventDestroy(pw->start);
+    }
+    epicsEventDestroy(ppsl->passDone);
+    free(ppsl->workers);
+    free(ppsl->precs);
+    free(ppsl->part);
+    ppsl->workers = NULL;
+    ppsl->precs = NULL;
+    ppsl->part = NULL;
+    ppsl->nalloc = 0;
+}
+
 static void periodicTask(void *arg)
 {
     periodic_scan_list *ppsl = (periodic_scan_list *)arg;
@@ -791,6 +977,8 @@ static void periodicTask(void *arg)
     const double penalty = (ppsl->period >= 2) ? 1 : (ppsl->period / 2);
 
     taskwdInsert(0, NULL, NULL);
+    if (ppsl->nworkers > 1)
+        spawnWorkers(ppsl);
     epicsEventSignal(startStopEvent);
 
     epicsTimeGetMonotonic(&next);
@@ -800,8 +988,12 @@ static void periodicTask(void *arg)
         double delay;
         epicsTimeStamp now;
 
-        if (ppsl->scanCtl == ctlRun)
-            scanList(&ppsl->scan_list);
+        if (ppsl->scanCtl == ctlRun) {
+            if (ppsl->nworkers > 1)
+                scanListWorkers(ppsl);
+            else
+                scanList(&ppsl->scan_list);
+        }
 
         epicsTimeAddSeconds(&next, ppsl->period);
         epicsTimeGetMonotonic(&now);
@@ -846,6 +1038,8 @@ static void periodicTask(void *arg)
         epicsEventWaitWithTimeout(ppsl->loopEvent, delay);
     }
 
+    if (ppsl->nworkers > 1)
+        stopWorkers(ppsl);
     taskwdRemove(0);
     epicsEventSignal(startStopEvent);
 }
@@ -855,6 +1049,7 @@ static void initPeriodic(void)
 {
     dbMenu *pmenu = dbFindMenu(pdbbase, "menuScan");
     double quantum = epicsThreadSleepQuantum();
+    periodic_threads *ppt;
     int i;
 
     if (!pmenu) {
@@ -905,6 +1100,14 @@ static void initPeriodic(void)
         ppsl->scanCtl = ctlPause;
         ppsl->loopEvent = epicsEventMustCreate(epicsEventEmpty);
 
+        ppsl->nworkers = 1;
+        for (ppt = (periodic_threads *)ellFirst(&periodicThreads); ppt;
+             ppt = (periodic_threads *)ellNext(&ppt->node)) {
+            if (ppt->period == 0.0 ||
+                fabs(ppt->period - ppsl->period) <= 0.01 * ppsl->period)
+                ppsl->nworkers = ppt->count;
+        }
+
         number = ppsl->period / quantum;
         if ((ppsl->period < 2 * quantum) ||
             (number / floor(number) > 1.1)) {
@@ -924,14 +1127,17 @@ static void deletePeriodic(void)
         periodic_scan_list *ppsl = papPeriodic[i];
 
         if (!ppsl) continue;
-        ellFree(&ppsl->scan_list.list);
+        scanListFree(&ppsl->scan_list);
         epicsEventDestroy(ppsl->loopEvent);
-        epicsMutexDestroy(ppsl->scan_list.lock);
+        free(ppsl->workers);
+        free(ppsl->precs);
+        free(ppsl->part);
         free(ppsl);
     }
 
     free(papPeriodic);
     papPeriodic = NULL;
+    ellFree(&periodicThreads);
 }
 
 static void spawnPeriodic(int ind)
@@ -989,63 +1195,85 @@ static void printList(scan_list *psl, char *message)
     }
 }
 
-static void scanList(scan_list *psl)
+/* The current snapshot of a scan list, made if the list has changed
+ * since the last one.  The caller must snapshotRelease() it.
+ */
+static scan_snapshot *snapshotGet(scan_list *psl)
 {
-    /* When reading this code remember that the call to dbProcess can result
-     * in the SCAN field being changed in an arbitrary number of records.
-     */
-
-    scan_element *pse;
-    scan_element *prev = NULL;
-    scan_element *next = NULL;
+    scan_snapshot *snap;
 
     epicsMutexMustLock(psl->lock);
-    psl->modified = FALSE;
-    pse = (scan_element *)ellFirst(&psl->list);
-    if (pse) next = (scan_element *)ellNext(&pse->node);
+    snap = psl->snap;
+    if (!snap || snap->version != psl->version) {
+        size_t n = ellCount(&psl->list), i = 0;
+        scan_element *pse;
+
+        snap = dbMalloc(offsetof(scan_snapshot, precs) +
+            (n ? n : 1) * sizeof(struct dbCommon *));
+        snap->refs = 1;     /* for psl->snap */
+        snap->version = psl->version;
+        snap->nrecs = n;
+        for (pse = (scan_element *)ellFirst(&psl->list); pse;
+             pse = (scan_element *)ellNext(&pse->node))
+            snap->precs[i++] = pse->precord;
+        if (psl->snap)
+            snapshotRelease(psl->snap);
+        psl->snap = snap;
+    }
+    epicsAtomicIncrIntT(&snap->refs);
     epicsMutexUnlock(psl->lock);
+    return snap;
+}
 
-    while (pse) {
-        struct dbCommon *precord = pse->precord;
+static void snapshotRelease(scan_snapshot *snap)
+{
+    if (epicsAtomicDecrIntT(&snap->refs) == 0)
+        free(snap);
+}
+
+/* Process records taken from a snapshot of a scan list, unless they have
+ * since been moved to another list, which happens with their lock set
+ * locked.
+ */
+static void scanRecords(scan_list *psl, struct dbCommon **precs,
+    size_t nrecs)
+{
+    size_t i;
+
+    for (i = 0; i < nrecs; i++) {
+        struct dbCommon *precord = precs[i];
+        scan_element *pse;
 
         dbScanLock(precord);
-        dbProcess(precord);
+        pse = precord->spvt;
+        if (pse && pse->pscan_list == psl)
+            dbProcess(precord);
         dbScanUnlock(precord);
-
-        epicsMutexMustLock(psl->lock);
-        if (!psl->modified) {
-            prev = pse;
-            pse = (scan_element *)ellNext(&pse->node);
-            if (pse) next = (scan_element *)ellNext(&pse->node);
-        } else if (pse->pscan_list == psl) {
-            /*This scan element is still in same scan list*/
-            prev = pse;
-            pse = (scan_element *)ellNext(&pse->node);
-            if (pse) next = (scan_element *)ellNext(&pse->node);
-            psl->modified = FALSE;
-        } else if (prev && prev->pscan_list == psl) {
-            /*Previous scan element is still in same scan list*/
-            pse = (scan_element *)ellNext(&prev->node);
-            if (pse) {
-                prev = (scan_element *)ellPrevious(&pse->node);
-                next = (scan_element *)ellNext(&pse->node);
-            }
-            psl->modified = FALSE;
-        } else if (next && next->pscan_list == psl) {
-            /*Next scan element is still in same scan list*/
-            pse = next;
-            prev = (scan_element *)ellPrevious(&pse->node);
-            next = (scan_element *)ellNext(&pse->node);
-            psl->modified = FALSE;
-        } else {
-            /*Too many changes. Just wait till next period*/
-            epicsMutexUnlock(psl->lock);
-            return;
-        }
-        epicsMutexUnlock(psl->lock);
     }
 }
-
+
+static void scanList(scan_list *psl)
+{
+    /* When reading this code remember that the call to dbProcess can result
+     * in the SCAN field being changed in an arbitrary number of records.
+     * Records added to the list during a pass are processed from the
+     * next one.
+     */
+    scan_snapshot *snap = snapshotGet(psl);
+
+    scanRecords(psl, snap->precs, snap->nrecs);
+    snapshotRelease(snap);
+}
+
+static void scanListFree(scan_list *psl)
+{
+    if (psl->snap)
+        snapshotRelease(psl->snap);
+    psl->snap = NULL;
+    ellFree(&psl->list);
+    epicsMutexDestroy(psl->lock);
+}
+
 static void buildScanLists(void)
 {
     dbRecordType *pdbRecordType;
@@ -1087,7 +1315,7 @@ static void addToList(struct dbCommon *precord, scan_list *psl)
         ptemp = (scan_element *)ellPrevious(&ptemp->node);
     }
     ellInsert(&psl->list, (ptemp ? &ptemp->node : NULL), &pse->node);
-    psl->modified = TRUE;
+    psl->version++;
     epicsMutexUnlock(psl->lock);
 }
 
@@ -1113,6 +1341,6 @@ static void deleteFromList(struct dbCommon *precord, scan_list *psl)
     }
     pse->pscan_list = NULL;
     ellDelete(&psl->list, &pse->node);
-    psl->modified = TRUE;
+    psl->version++;
     epicsMutexUnlock(psl->lock);
 }
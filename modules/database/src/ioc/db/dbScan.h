@@ -88,6 +88,23 @@ DBCORE_API int scanOnceSetQueueSize(int size);
 DBCORE_API int scanOnceQueueStatus(const int reset, scanOnceQueueStats *result);
 DBCORE_API void scanOnceQueueShow(const int reset);
 
+/** @brief Share passes over periodic scan lists between threads
+ *
+ * Each pass over the scan list is divided between count threads by
+ * lock set.  All records in one lock set are processed by the same
+ * thread in list order, so PHAS only orders records within a lock set.
+ * A pass ends when all of its threads have finished, and only then is
+ * it counted as an over-run if it took longer than the period.
+ *
+ * Must be called before iocInit()
+ *
+ * @param count Number of threads.  If zero or negative, the number of
+ *        CPUs plus count.
+ * @param period Scan period in seconds, or 0.0 for every periodic scan list.
+ * @return Zero on success
+ */
+DBCORE_API int scanPeriodicThreads(int count, double period);
+
 /*print periodic lists*/
 DBCORE_API int scanppl(double rate);
 
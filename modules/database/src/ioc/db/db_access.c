@@ -39,6 +39,7 @@
 #include "dbChannel.h"
 #include "dbCommon.h"
 #include "dbEvent.h"
+#include "db_field_log.h"
 #include "dbLock.h"
 #include "dbNotify.h"
 #include "dbStaticLib.h"
@@ -148,13 +149,23 @@ int dbChannel_get_count(
     long options;
     long i;
     long zero = 0;
+    db_field_log *plog = (db_field_log *) pfl;
+    /* The value, alarm and time stamp of a numeric array snapshot don't
+     * need the record.  Graphic and control limits do, and so do string
+     * conversions (PREC, enum strings) and other field logs, which dbGet()
+     * may convert through the record. */
+    int lock = !db_field_log_is_snapshot(plog) ||
+        plog->field_type <= DBF_STRING || plog->field_type > DBF_DOUBLE ||
+        buffer_type >= oldDBR_GR_STRING || buffer_type == oldDBR_STRING ||
+        buffer_type == oldDBR_STS_STRING || buffer_type == oldDBR_TIME_STRING;
 
    /* The order of the DBR* elements in the "newSt" structures below is
     * very important and must correspond to the order of processing
     * in the dbAccess.c dbGet() and getOptions() routines.
     */
 
-    dbScanLock(dbChannelRecord(chan));
+    if (lock)
+        dbScanLock(dbChannelRecord(chan));
 
     switch(buffer_type) {
     case(oldDBR_STRING):
@@ -798,7 +809,8 @@ int dbChannel_get_count(
         break;
     }
 
-    dbScanUnlock(dbChannelRecord(chan));
+    if (lock)
+        dbScanUnlock(dbChannelRecord(chan));
 
     if (status) return -1;
     return 0;
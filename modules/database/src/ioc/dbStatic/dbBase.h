@@ -45,6 +45,7 @@ typedef struct devSup {
     /*Following only available on run time system*/
     dset            *pdset;
     struct dsxt     *pdsxt;       /* Extended device support */
+    int             initThreadSafe; /* see dbInitThreadSafe() */
 }devSup;
 
 typedef struct linkSup {
@@ -168,6 +169,7 @@ typedef struct dbRecordType {
     /*The following are only available on run time system*/
     rset            *prset;
     int             rec_size;       /*record size in bytes          */
+    int             initThreadSafe; /* see dbInitThreadSafe() */
 }dbRecordType;
 
 struct dbPvd;           /* Contents private to dbPvdLib code */
@@ -16,7 +16,7 @@
 #include <string.h>
 
 #include "dbDefs.h"
-#include "ellLib.h"
+#include "epicsAtomic.h"
 #include "epicsMutex.h"
 #include "epicsStdio.h"
 #include "epicsString.h"
@@ -25,15 +25,71 @@
 #include "dbStaticLib.h"
 #include "dbStaticPvt.h"
 
-typedef struct {
-    ELLLIST      list;
-    epicsMutexId lock;
-} dbPvdBucket;
+/* Process Variable Directory
+ *
+ * An open addressing hash table of all record and alias names with
+ * linear probing.  Each slot holds the name's hash next to its entry,
+ * so most slots of a probe sequence can be skipped without following
+ * the entry to compare names.  The table is replaced by one twice the
+ * size before it becomes more than 3/4 used.
+ *
+ * Lookups don't lock.  Updates are serialized by lock, and make an
+ * entry visible by storing its slot's hash before the entry pointer.
+ * Deleted entries leave a DELETED marker behind, so that the probe
+ * sequences of other names are not cut short, which may be reused by
+ * later additions.  Once the database has been loaded (dbPvdLoaded())
+ * replaced tables and deleted entries are kept until dbPvdFreeMem(), as
+ * lookups may still be reading them.  Lookups compare names with the copy
+ * in the entry, since a deleted record's node is freed by its caller.
+ */
+typedef struct dbPvdSlot {
+    unsigned int hash;
+    EpicsAtomicPtrT entry;          /* PVDENTRY *, NULL or DELETED */
+} dbPvdSlot;
+
+typedef struct dbPvdTable {
+    unsigned int size;              /* power of 2 */
+    unsigned int mask;
+    struct dbPvdTable *retired;     /* older tables */
+    dbPvdSlot slots[1];
+} dbPvdTable;
+
+static char deletedEntry;
+#define DELETED ((EpicsAtomicPtrT) &deletedEntry)
+
+/* Negative lookup filter
+ *
+ * A blocked counting Bloom filter over all record and alias names, so
+ * that lookups of names this IOC doesn't have (most CA name searches)
+ * can be rejected without searching the table.  Each name increments
+ * FILTER_K 4-bit counters within one 64 byte block.  Counters which
+ * reach 15 are never decremented again, so the filter may give false
+ * positives, but never false negatives.
+ *
+ * The filter is sized and built by dbPvdLoaded() once the database has
+ * been loaded, and kept up to date by dbPvdAdd() and dbPvdDelete().
+ */
+#define FILTER_K 8
+#define FILTER_BLOCK 128            /* counters per block */
+#define FILTER_COUNTERS_PER_NAME 16
+#define FILTER_MIN_BLOCKS 16
+#define FILTER_SEED 0x9e3779b9u
+
+typedef struct dbPvdFilter {
+    unsigned char *counters;        /* two per byte */
+    unsigned int nblocks;           /* power of 2 */
+    unsigned int nnames;
+} dbPvdFilter;
 
 typedef struct dbPvd {
-    unsigned int size;
-    unsigned int mask;
-    dbPvdBucket **buckets;
+    EpicsAtomicPtrT table;          /* dbPvdTable * */
+    unsigned int nnames;
+    unsigned int ndeleted;          /* DELETED slots */
+    int loaded;                     /* lookups may run during updates */
+    dbPvdTable *retired;
+    PVDENTRY *deleted;              /* retired entries */
+    dbPvdFilter *filter;
+    epicsMutexId lock;
 } dbPvd;
 
 unsigned int dbPvdHashTableSize = 0;
@@ -42,6 +98,137 @@ unsigned int dbPvdHashTableSize = 0;
 #define DEFAULT_SIZE 512
 #define MAX_SIZE 65536
 
+/* The last characters of a name only reach the low bits of
+ * epicsMemHash(), so mix them into all bits (MurmurHash3 finalizer)
+ */
+static unsigned int hashMix(unsigned int h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+static unsigned int pvdHash(const char *name, size_t lenName)
+{
+    return hashMix(epicsMemHash(name, lenName, 0));
+}
+
+/* Calls func for each of the name's counters, stopping if it returns 0.
+ * h is the name's pvdHash(), returns 0 if stopped.
+ */
+static int filterProbe(dbPvdFilter *pfilter, unsigned int h,
+    const char *name, size_t lenName,
+    int (*func)(unsigned char *pbyte, unsigned int shift))
+{
+    unsigned char *pblock = pfilter->counters + (FILTER_BLOCK / 2) *
+        (hashMix(epicsMemHash(name, lenName, FILTER_SEED)) &
+            (pfilter->nblocks - 1));
+    unsigned int pos = h % FILTER_BLOCK;
+    unsigned int step = (h / FILTER_BLOCK) | 1; /* odd, so all different */
+    int i;
+
+    for (i = 0; i < FILTER_K; i++) {
+        if (!func(&pblock[pos / 2], (pos & 1) * 4))
+            return 0;
+        pos = (pos + step) % FILTER_BLOCK;
+    }
+    return 1;
+}
+
+static int counterTest(unsigned char *pbyte, unsigned int shift)
+{
+    return (*pbyte >> shift) & 0xf;
+}
+
+static int counterInc(unsigned char *pbyte, unsigned int shift)
+{
+    if (((*pbyte >> shift) & 0xf) != 0xf)
+        *pbyte += 1u << shift;
+    return 1;
+}
+
+static int counterDec(unsigned char *pbyte, unsigned int shift)
+{
+    unsigned int count = (*pbyte >> shift) & 0xf;
+
+    /* saturated counters may be shared by more names than they count */
+    if (count != 0 && count != 0xf)
+        *pbyte -= 1u << shift;
+    return 1;
+}
+
+/* Caller holds ppvd->lock */
+static void filterUpdate(dbPvd *ppvd, unsigned int h, const char *name,
+    int (*func)(unsigned char *pbyte, unsigned int shift))
+{
+    if (!ppvd->filter)
+        return;
+
+    filterProbe(ppvd->filter, h, name, strlen(name), func);
+    if (func == counterInc)
+        ppvd->filter->nnames++;
+    else
+        ppvd->filter->nnames--;
+}
+
+static dbPvdTable *tableCreate(unsigned int size)
+{
+    dbPvdTable *ptable = dbCalloc(1,
+        offsetof(dbPvdTable, slots) + size * sizeof(dbPvdSlot));
+
+    ptable->size = size;
+    ptable->mask = size - 1;
+    return ptable;
+}
+
+/* Publish an entry in an unused slot */
+static void slotSet(dbPvdSlot *pslot, unsigned int h, PVDENTRY *ppvdNode)
+{
+    pslot->hash = h;
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetPtrT(&pslot->entry, ppvdNode);
+}
+
+/* Put an entry in the first unused slot of its probe sequence */
+static void tableInsert(dbPvdTable *ptable, unsigned int h,
+    PVDENTRY *ppvdNode)
+{
+    unsigned int i = h & ptable->mask;
+
+    while (ptable->slots[i].entry && ptable->slots[i].entry != DELETED)
+        i = (i + 1) & ptable->mask;
+    slotSet(&ptable->slots[i], h, ppvdNode);
+}
+
+/* Caller holds ppvd->lock */
+static void tableReplace(dbPvd *ppvd, unsigned int size)
+{
+    dbPvdTable *pold = (dbPvdTable *) ppvd->table;
+    dbPvdTable *pnew = tableCreate(size);
+    unsigned int i;
+
+    for (i = 0; i < pold->size; i++) {
+        dbPvdSlot *pslot = &pold->slots[i];
+
+        if (pslot->entry && pslot->entry != DELETED)
+            tableInsert(pnew, pslot->hash, (PVDENTRY *) pslot->entry);
+    }
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetPtrT(&ppvd->table, pnew);
+    ppvd->ndeleted = 0;
+
+    if (ppvd->loaded) {
+        pold->retired = ppvd->retired;
+        ppvd->retired = pold;
+    }
+    else {
+        free(pold);
+    }
+}
+
 
 int dbPvdTableSize(int size)
 {
@@ -70,131 +257,225 @@ void dbPvdInitPvt(dbBase *pdbbase)
         dbPvdHashTableSize = DEFAULT_SIZE;
     }
 
-    ppvd = (dbPvd *)dbMalloc(sizeof(dbPvd));
-    ppvd->size    = dbPvdHashTableSize;
-    ppvd->mask    = dbPvdHashTableSize - 1;
-    ppvd->buckets = dbCalloc(ppvd->size, sizeof(dbPvdBucket *));
+    ppvd = (dbPvd *)dbCalloc(1, sizeof(dbPvd));
+    ppvd->table = tableCreate(dbPvdHashTableSize);
+    ppvd->lock = epicsMutexMustCreate();
 
     pdbbase->ppvd = ppvd;
     return;
 }
 
+void dbPvdLoaded(dbBase *pdbbase)
+{
+    dbPvd *ppvd = pdbbase->ppvd;
+    dbPvdTable *ptable;
+    dbPvdFilter *pfilter;
+    unsigned int i;
+
+    if (ppvd == NULL || ppvd->loaded) return;
+
+    epicsMutexMustLock(ppvd->lock);
+    ptable = (dbPvdTable *) ppvd->table;
+
+    pfilter = dbCalloc(1, sizeof(dbPvdFilter));
+    pfilter->nblocks = FILTER_MIN_BLOCKS;
+    while (pfilter->nblocks * FILTER_BLOCK <
+            ppvd->nnames * FILTER_COUNTERS_PER_NAME &&
+        pfilter->nblocks < 0x1000000u)
+        pfilter->nblocks <<= 1;
+    pfilter->counters = dbCalloc(pfilter->nblocks, FILTER_BLOCK / 2);
+
+    for (i = 0; i < ptable->size; i++) {
+        dbPvdSlot *pslot = &ptable->slots[i];
+        const char *name;
+
+        if (!pslot->entry || pslot->entry == DELETED) continue;
+        name = ((PVDENTRY *) pslot->entry)->name;
+        filterProbe(pfilter, pslot->hash, name, strlen(name), counterInc);
+        pfilter->nnames++;
+    }
+
+    ppvd->filter = pfilter;
+    ppvd->loaded = 1;
+    epicsMutexUnlock(ppvd->lock);
+}
+
 PVDENTRY *dbPvdFind(dbBase *pdbbase, const char *name, size_t lenName)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
-    PVDENTRY *ppvdNode;
+    dbPvdTable *ptable;
+    unsigned int h = pvdHash(name, lenName);
+    unsigned int i;
+
+    if (ppvd->filter &&
+        !filterProbe(ppvd->filter, h, name, lenName, counterTest))
+        return NULL;
 
-    pbucket = ppvd->buckets[epicsMemHash(name, lenName, 0) & ppvd->mask];
-    if (pbucket == NULL) return NULL;
+    ptable = (dbPvdTable *) epicsAtomicGetPtrT(&ppvd->table);
+    epicsAtomicReadMemoryBarrier();
 
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
-        const char *recordname = ppvdNode->precnode->recordname;
+    for (i = h & ptable->mask; ; i = (i + 1) & ptable->mask) {
+        dbPvdSlot *pslot = &ptable->slots[i];
+        PVDENTRY *ppvdNode = (PVDENTRY *) epicsAtomicGetPtrT(&pslot->entry);
+        const char *recordname;
 
+        if (ppvdNode == NULL)
+            return NULL;
+        if (ppvdNode == DELETED)
+            continue;
+        epicsAtomicReadMemoryBarrier();
+        if (pslot->hash != h)
+            continue;
+
+        recordname = ppvdNode->name;
         if (strncmp(name, recordname, lenName) == 0 &&
-            strlen(recordname) == lenName)
-            break;
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
+            recordname[lenName] == '\0')
+            return ppvdNode;
     }
-    epicsMutexUnlock(pbucket->lock);
-    return ppvdNode;
 }
-
+
 PVDENTRY *dbPvdAdd(dbBase *pdbbase, dbRecordType *precordType,
     dbRecordNode *precnode)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
+    dbPvdTable *ptable;
+    dbPvdSlot *pfree = NULL;
     PVDENTRY *ppvdNode;
     char *name = precnode->recordname;
-    unsigned int h;
-
-    h = epicsStrHash(name, 0) & ppvd->mask;
-    pbucket = ppvd->buckets[h];
-    if (pbucket == NULL) {
-        pbucket = dbCalloc(1, sizeof(dbPvdBucket));
-        ellInit(&pbucket->list);
-        pbucket->lock = epicsMutexCreate();
-        ppvd->buckets[h] = pbucket;
-    }
-
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
-        if (strcmp(name, ppvdNode->precnode->recordname) == 0) {
-            epicsMutexUnlock(pbucket->lock);
+    unsigned int h = pvdHash(name, strlen(name));
+    unsigned int i;
+
+    epicsMutexMustLock(ppvd->lock);
+    ptable = (dbPvdTable *) ppvd->table;
+    for (i = h & ptable->mask; ; i = (i + 1) & ptable->mask) {
+        dbPvdSlot *pslot = &ptable->slots[i];
+
+        if (pslot->entry == NULL)
+            break;
+        if (pslot->entry == DELETED) {
+            if (!pfree)
+                pfree = pslot;
+        }
+        else if (pslot->hash == h &&
+            strcmp(name, ((PVDENTRY *) pslot->entry)->name) == 0) {
+            epicsMutexUnlock(ppvd->lock);
             return NULL;
         }
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
     }
-    ppvdNode = dbCalloc(1, sizeof(PVDENTRY));
+    ppvdNode = dbCalloc(1, sizeof(PVDENTRY) + strlen(name));
     ppvdNode->precordType = precordType;
     ppvdNode->precnode = precnode;
-    ellAdd(&pbucket->list, (ELLNODE *)ppvdNode);
-    epicsMutexUnlock(pbucket->lock);
+    strcpy(ppvdNode->name, name);
+    /* in the filter before it can be found */
+    filterUpdate(ppvd, h, name, counterInc);
+
+    if (pfree) {
+        slotSet(pfree, h, ppvdNode);
+        ppvd->ndeleted--;
+    }
+    else {
+        /* keep at least a quarter of the slots empty */
+        if ((ppvd->nnames + ppvd->ndeleted + 1) * 4 > ptable->size * 3) {
+            unsigned int size = ptable->size;
+
+            while ((ppvd->nnames + 1) * 2 > size)
+                size <<= 1;
+            tableReplace(ppvd, size);
+            ptable = (dbPvdTable *) ppvd->table;
+        }
+        tableInsert(ptable, h, ppvdNode);
+    }
+    ppvd->nnames++;
+    epicsMutexUnlock(ppvd->lock);
     return ppvdNode;
 }
 
 void dbPvdDelete(dbBase *pdbbase, dbRecordNode *precnode)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
-    PVDENTRY *ppvdNode;
+    dbPvdTable *ptable;
     char *name = precnode->recordname;
+    unsigned int h = pvdHash(name, strlen(name));
+    unsigned int i;
+
+    epicsMutexMustLock(ppvd->lock);
+    ptable = (dbPvdTable *) ppvd->table;
+    for (i = h & ptable->mask; ptable->slots[i].entry;
+         i = (i + 1) & ptable->mask) {
+        dbPvdSlot *pslot = &ptable->slots[i];
+        PVDENTRY *ppvdNode = (PVDENTRY *) pslot->entry;
+
+        if (pslot->entry == DELETED || pslot->hash != h ||
+            strcmp(name, ppvdNode->name) != 0)
+            continue;
 
-    pbucket = ppvd->buckets[epicsStrHash(name, 0) & ppvd->mask];
-    if (pbucket == NULL) return;
-
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
-        if (ppvdNode->precnode &&
-            ppvdNode->precnode->recordname &&
-            strcmp(name, ppvdNode->precnode->recordname) == 0) {
-            ellDelete(&pbucket->list, (ELLNODE *)ppvdNode);
+        /* the last slot of a probe sequence can be emptied */
+        if (ptable->slots[(i + 1) & ptable->mask].entry == NULL) {
+            epicsAtomicSetPtrT(&pslot->entry, NULL);
+        }
+        else {
+            epicsAtomicSetPtrT(&pslot->entry, DELETED);
+            ppvd->ndeleted++;
+        }
+        ppvd->nnames--;
+        filterUpdate(ppvd, h, name, counterDec);
+        if (ppvd->loaded) {
+            ppvdNode->retired = ppvd->deleted;
+            ppvd->deleted = ppvdNode;
+        }
+        else {
             free(ppvdNode);
-            break;
         }
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
+        break;
     }
-    epicsMutexUnlock(pbucket->lock);
+    epicsMutexUnlock(ppvd->lock);
     return;
 }
 
 void dbPvdFreeMem(dbBase *pdbbase)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    unsigned int h;
+    dbPvdTable *ptable;
+    unsigned int i;
 
     if (ppvd == NULL) return;
     pdbbase->ppvd = NULL;
 
-    for (h = 0; h < ppvd->size; h++) {
-        dbPvdBucket *pbucket = ppvd->buckets[h];
-        PVDENTRY *ppvdNode;
+    ptable = (dbPvdTable *) ppvd->table;
+    for (i = 0; i < ptable->size; i++) {
+        EpicsAtomicPtrT entry = ptable->slots[i].entry;
 
-        if (pbucket == NULL) continue;
-        epicsMutexMustLock(pbucket->lock);
-        ppvd->buckets[h] = NULL;
-        while ((ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list))) {
-            ellDelete(&pbucket->list, (ELLNODE *)ppvdNode);
-            free(ppvdNode);
-        }
-        epicsMutexUnlock(pbucket->lock);
-        epicsMutexDestroy(pbucket->lock);
-        free(pbucket);
+        if (entry && entry != DELETED)
+            free(entry);
+    }
+    free(ptable);
+    while ((ptable = ppvd->retired)) {
+        ppvd->retired = ptable->retired;
+        free(ptable);
+    }
+    while (ppvd->deleted) {
+        PVDENTRY *ppvdNode = ppvd->deleted;
+
+        ppvd->deleted = ppvdNode->retired;
+        free(ppvdNode);
+    }
+    if (ppvd->filter) {
+        free(ppvd->filter->counters);
+        free(ppvd->filter);
     }
-    free(ppvd->buckets);
+    epicsMutexDestroy(ppvd->lock);
     free(ppvd);
 }
 
 void dbPvdDump(dbBase *pdbbase, int verbose)
 {
-    unsigned int empty = 0;
     dbPvd *ppvd;
-    unsigned int h;
+    dbPvdTable *ptable;
+    unsigned long totalProbe = 0;
+    unsigned int maxProbe = 0, nretired = 0, ndeleted = 0;
+    PVDENTRY *ppvdNode;
+    unsigned int i;
+    int n = 0;
 
     if (!pdbbase) {
         fprintf(stderr,"pdbbase not specified\n");
@@ -203,27 +484,44 @@ void dbPvdDump(dbBase *pdbbase, int verbose)
     ppvd = pdbbase->ppvd;
     if (ppvd == NULL) return;
 
-    printf("Process Variable Directory has %u buckets", ppvd->size);
-
-    for (h = 0; h < ppvd->size; h++) {
-        dbPvdBucket *pbucket = ppvd->buckets[h];
-        PVDENTRY *ppvdNode;
-        int i = 1;
-
-        if (pbucket == NULL) {
-            empty++;
-            continue;
+    epicsMutexMustLock(ppvd->lock);
+    ptable = (dbPvdTable *) ppvd->table;
+    printf("Process Variable Directory has %u slots for %u names",
+        ptable->size, ppvd->nnames);
+
+    for (i = 0; i < ptable->size; i++) {
+        dbPvdSlot *pslot = &ptable->slots[i];
+        unsigned int probe;
+
+        if (!pslot->entry || pslot->entry == DELETED) continue;
+        /* slots after the name's first */
+        probe = (i - pslot->hash) & ptable->mask;
+        totalProbe += probe;
+        if (probe > maxProbe)
+            maxProbe = probe;
+        if (verbose) {
+            if (!(n++ % 3))
+                printf("\n");
+            printf(" [%7u] %-28s", i, ((PVDENTRY *) pslot->entry)->name);
         }
-        epicsMutexMustLock(pbucket->lock);
-        ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-        printf("\n [%4u] %4d  ", h, ellCount(&pbucket->list));
-        while (ppvdNode && verbose) {
-            if (!(++i % 4))
-                printf("\n         ");
-            printf("  %s", ppvdNode->precnode->recordname);
-            ppvdNode = (PVDENTRY *) ellNext((ELLNODE*)ppvdNode);
-        }
-        epicsMutexUnlock(pbucket->lock);
     }
-    printf("\n%u buckets empty.\n", empty);
+    printf("\n%u slots deleted, probe length average %.2f, longest %u\n",
+        ppvd->ndeleted, ppvd->nnames ?
+            1.0 + (double) totalProbe / ppvd->nnames : 0.0,
+        ppvd->nnames ? maxProbe + 1 : 0);
+
+    for (ptable = ppvd->retired; ptable; ptable = ptable->retired)
+        nretired += ptable->size;
+    if (nretired)
+        printf("%u slots in replaced tables\n", nretired);
+    for (ppvdNode = ppvd->deleted; ppvdNode; ppvdNode = ppvdNode->retired)
+        ndeleted++;
+    if (ndeleted)
+        printf("%u deleted entries kept\n", ndeleted);
+
+    if (ppvd->filter) {
+        printf("Negative lookup filter of %u bytes for %u names\n",
+            ppvd->filter->nblocks * FILTER_BLOCK / 2, ppvd->filter->nnames);
+    }
+    epicsMutexUnlock(ppvd->lock);
 }
@@ -181,10 +181,10 @@ static const iocshFuncDef dbPvdDumpFuncDef = {
     "dbPvdDump",
     2,
     dbPvdDumpArgs,
-    "Dump the various buckets of the process variable directory.\n"
-    "If verbose is greater than 0, also print the process variables in each bucket.\n"
+    "Report the size and probe lengths of the process variable directory.\n"
+    "If verbose is greater than 0, also print the process variables in each slot.\n"
     "Example: dbPvdDump pdbbase 1\n"
-    "If the last argument(s) are missing, dump all buckets as though verbose is 0.\n",
+    "If the last argument(s) are missing, report as though verbose is 0.\n",
 };
 static void dbPvdDumpCallFunc(const iocshArgBuf *args)
 {
@@ -199,9 +199,9 @@ static const iocshFuncDef dbPvdTableSizeFuncDef = {
     "dbPvdTableSize",
     1,
     dbPvdTableSizeArgs,
-    "Change the number of buckets in the process variable directory.\n\n"
+    "Change the initial number of slots in the process variable directory.\n\n"
     "The process variable directory size should be set before loading the database.\n"
-    "The size of the process variable directory can automatically grow.\n"
+    "The process variable directory grows automatically as records are added.\n"
     "The size must be a power of 2.\n\n"
     "Example: dbPvdTableSize 1024\n",
 };
@@ -104,14 +104,16 @@ typedef struct dbGuiGroup {
 
 /*The following are in dbPvdLib.c*/
 /*directory*/
-typedef struct{
-    ELLNODE         node;
+typedef struct pvdEntry{
     dbRecordType    *precordType;
     dbRecordNode    *precnode;
+    struct pvdEntry *retired;   /* deleted entries, kept for lookups */
+    char            name[1];    /* copy of the name, for lookups */
 }PVDENTRY;
 DBCORE_API int dbPvdTableSize(int size);
 extern int dbStaticDebug;
 void dbPvdInitPvt(DBBASE *pdbbase);
+void dbPvdLoaded(DBBASE *pdbbase);
 PVDENTRY *dbPvdFind(DBBASE *pdbbase,const char *name,size_t lenname);
 PVDENTRY *dbPvdAdd(DBBASE *pdbbase,dbRecordType *precordType,dbRecordNode *precnode);
 void dbPvdDelete(DBBASE *pdbbase,dbRecordNode *precnode);
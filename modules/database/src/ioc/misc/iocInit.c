@@ -31,6 +31,8 @@
 #include "epicsPrint.h"
 #include "epicsSignal.h"
 #include "epicsThread.h"
+#include "epicsThreadPool.h"
+#include "epicsTime.h"
 #include "errMdef.h"
 #include "iocsh.h"
 #include "taskwd.h"
@@ -98,6 +100,100 @@ static void iterateRecords(recIterFunc func, void *user);
 int dbThreadRealtimeLock = 1;
 epicsExportAddress(int, dbThreadRealtimeLock);
 
+int dbInitThreads = 0;
+epicsExportAddress(int, dbInitThreads);
+
+/*
+ * Startup phase timing
+ */
+enum startupPhase {
+    phaseLoadDatabase, phaseLoadRecords,
+    phaseBuild1, phaseCaLinkInit,
+    phaseBuild2, phaseInitDrvSup, phaseInitRecSup, phaseInitDevSup,
+        phaseLockInit, phaseInitRecord0, phaseResolveLinks, phaseInitRecord1,
+        phaseFinishDevSup, phaseScanInit, phasePini,
+    phaseInitServers, phaseBuild3,
+    phaseRun, phasePiniRun, phasePiniRunning,
+    phaseCount
+};
+
+static struct {
+    const char *name;
+    int sub;        /* part of the previous phase which isn't */
+    unsigned count;
+    epicsUInt64 elapsed;
+} startupPhases[phaseCount] = {
+    {"dbLoadDatabase"}, {"dbLoadRecords"},
+    {"iocBuild_1"}, {"dbCaLinkInit"},
+    {"iocBuild_2"}, {"initDrvSup", 1}, {"initRecSup", 1}, {"initDevSup", 1},
+        {"dbLockInitRecords", 1}, {"init_record pass 0", 1},
+        {"resolve links", 1}, {"init_record pass 1", 1},
+        {"finishDevSup", 1}, {"scanInit", 1}, {"PINI YES", 1},
+    {"dbInitServers"}, {"iocBuild_3"},
+    {"iocRun"}, {"PINI RUN", 1}, {"PINI RUNNING", 1}
+};
+
+/* records initialized in parallel in each init_record pass */
+static size_t startupParallel[2];
+static int startupThreads;
+
+static void phaseDone(enum startupPhase phase, epicsUInt64 start)
+{
+    startupPhases[phase].count++;
+    startupPhases[phase].elapsed += epicsMonotonicGet() - start;
+}
+
+void iocStartupLoadTime(int records, epicsUInt64 start)
+{
+    phaseDone(records ? phaseLoadRecords : phaseLoadDatabase, start);
+}
+
+static void printPhase(const char *name, unsigned count, epicsUInt64 elapsed)
+{
+    printf("%-34s", name);
+    if (count)
+        printf(" %5u", count);
+    else
+        printf(" %5s", "");
+    printf(" %12.3f\n", elapsed * 1e-6);
+}
+
+void iocStartupReport(void)
+{
+    int i;
+
+    printf("%-34s %5s %12s\n", "IOC startup phase", "calls", "msec");
+    for (i = 0; i < phaseCount; i++) {
+        epicsUInt64 subs = 0;
+        int j;
+
+        if (startupPhases[i].sub || !startupPhases[i].count)
+            continue;
+        printPhase(startupPhases[i].name, startupPhases[i].count,
+            startupPhases[i].elapsed);
+        for (j = i + 1; j < phaseCount && startupPhases[j].sub; j++) {
+            char name[40];
+
+            if (!startupPhases[j].count)
+                continue;
+            sprintf(name, "  %s", startupPhases[j].name);
+            printPhase(name, startupPhases[j].count,
+                startupPhases[j].elapsed);
+            subs += startupPhases[j].elapsed;
+            if (j == phaseInitRecord0 || j == phaseInitRecord1) {
+                size_t n = startupParallel[j == phaseInitRecord1];
+
+                if (n)
+                    printf("    %lu records on %d threads\n",
+                        (unsigned long) n, startupThreads);
+            }
+        }
+        if (subs && subs < startupPhases[i].elapsed)
+            printPhase("  other, including init hooks", 0,
+                startupPhases[i].elapsed - subs);
+    }
+}
+
 enum iocStateEnum getIocState(void)
 {
     return iocState;
@@ -129,6 +225,8 @@ static int iocBuild_1(void)
         errlogPrintf("iocBuild: " ERL_ERROR " Aborting, bad database definition (DBD)!\n");
         return -1;
     }
+    /* all records have been loaded */
+    dbPvdLoaded(pdbbase);
     epicsSignalInstallSigHupIgnore();
     initHookAnnounce(initHookAtBeginning);
 
@@ -150,27 +248,40 @@ static void prepareLinks(dbRecordType *rtyp, dbCommon *prec, void *junk)
 
 static int iocBuild_2(void)
 {
+    epicsUInt64 t0;
+
     initHookAnnounce(initHookAfterCaLinkInit);
 
+    t0 = epicsMonotonicGet();
     initDrvSup();
+    phaseDone(phaseInitDrvSup, t0);
     initHookAnnounce(initHookAfterInitDrvSup);
 
+    t0 = epicsMonotonicGet();
     initRecSup();
+    phaseDone(phaseInitRecSup, t0);
     initHookAnnounce(initHookAfterInitRecSup);
 
+    t0 = epicsMonotonicGet();
     initDevSup();
+    phaseDone(phaseInitDevSup, t0);
     initHookAnnounce(initHookAfterInitDevSup); /* used by autosave pass 0 */
 
+    t0 = epicsMonotonicGet();
     iterateRecords(prepareLinks, NULL);
 
     dbLockInitRecords(pdbbase);
+    phaseDone(phaseLockInit, t0);
     initDatabase();
     dbBkptInit();
     initHookAnnounce(initHookAfterInitDatabase); /* used by autosave pass 1 */
 
+    t0 = epicsMonotonicGet();
     finishDevSup();
+    phaseDone(phaseFinishDevSup, t0);
     initHookAnnounce(initHookAfterFinishDevSup);
 
+    t0 = epicsMonotonicGet();
     scanInit();
     if (asInit()) {
         errlogPrintf(ERL_ERROR " iocBuild: asInit Failed.\n");
@@ -178,6 +289,7 @@ static int iocBuild_2(void)
     }
     dbProcessNotifyInit();
     epicsThreadSleep(.5);
+    phaseDone(phaseScanInit, t0);
     initHookAnnounce(initHookAfterScanInit);
 
     initialProcess();
@@ -194,21 +306,35 @@ static int iocBuild_3(void)
     return 0;
 }
 
+static int timeBuild(int (*build)(void), enum startupPhase phase)
+{
+    epicsUInt64 t0 = epicsMonotonicGet();
+    int status = build();
+
+    phaseDone(phase, t0);
+    return status;
+}
+
 int iocBuild(void)
 {
+    epicsUInt64 t0;
     int status;
 
-    status = iocBuild_1();
+    status = timeBuild(iocBuild_1, phaseBuild1);
     if (status) return status;
 
+    t0 = epicsMonotonicGet();
     dbCaLinkInit();
+    phaseDone(phaseCaLinkInit, t0);
 
-    status = iocBuild_2();
+    status = timeBuild(iocBuild_2, phaseBuild2);
     if (status) return status;
 
+    t0 = epicsMonotonicGet();
     dbInitServers();
+    phaseDone(phaseInitServers, t0);
 
-    status = iocBuild_3();
+    status = timeBuild(iocBuild_3, phaseBuild3);
 
     if (dbThreadRealtimeLock)
         epicsThreadRealtimeLock();
@@ -219,23 +345,28 @@ int iocBuild(void)
 
 int iocBuildIsolated(void)
 {
+    epicsUInt64 t0;
     int status;
 
-    status = iocBuild_1();
+    status = timeBuild(iocBuild_1, phaseBuild1);
     if (status) return status;
 
+    t0 = epicsMonotonicGet();
     dbCaLinkInitIsolated();
+    phaseDone(phaseCaLinkInit, t0);
 
-    status = iocBuild_2();
+    status = timeBuild(iocBuild_2, phaseBuild2);
     if (status) return status;
 
-    status = iocBuild_3();
+    status = timeBuild(iocBuild_3, phaseBuild3);
     if (!status) iocBuildMode = buildIsolated;
     return status;
 }
 
 int iocRun(void)
 {
+    epicsUInt64 t0 = epicsMonotonicGet();
+
     if (iocState != iocPaused && iocState != iocBuilt) {
         errlogPrintf("iocRun: " ERL_WARNING " IOC not paused\n");
         return -1;
@@ -262,6 +393,7 @@ int iocRun(void)
         "IOC restarted");
     iocState = iocRunning;
     initHookAnnounce(initHookAfterIocRunning);
+    phaseDone(phaseRun, t0);
     return 0;
 }
 
@@ -557,13 +689,271 @@ static void doInitRecord1(dbRecordType *pdbRecordType, dbCommon *precord,
         prset->init_record(precord, 1);
 }
 
+long dbInitThreadSafe(const char *recordType, const char *dset)
+{
+    DBENTRY dbentry;
+    dbRecordType *pdbRecordType;
+    devSup *pdevSup;
+
+    if (!pdbbase) {
+        errlogPrintf("dbInitThreadSafe: No database definitions loaded.\n");
+        return -1;
+    }
+    if (!recordType) {
+        errlogPrintf("Usage: dbInitThreadSafe \"recordType\", \"dset\"\n");
+        return -1;
+    }
+    dbInitEntry(pdbbase, &dbentry);
+    if (dbFindRecordType(&dbentry, recordType)) {
+        dbFinishEntry(&dbentry);
+        errlogPrintf("dbInitThreadSafe: No record type \"%s\"\n", recordType);
+        return S_dbLib_recordTypeNotFound;
+    }
+    pdbRecordType = dbentry.precordType;
+    dbFinishEntry(&dbentry);
+
+    if (!dset || !*dset) {
+        pdbRecordType->initThreadSafe = TRUE;
+        return 0;
+    }
+    for (pdevSup = (devSup *)ellFirst(&pdbRecordType->devList);
+         pdevSup;
+         pdevSup = (devSup *)ellNext(&pdevSup->node)) {
+        if (strcmp(dset, pdevSup->name) == 0 ||
+            strcmp(dset, pdevSup->choice) == 0) {
+            pdevSup->initThreadSafe = TRUE;
+            return 0;
+        }
+    }
+    errlogPrintf("dbInitThreadSafe: No %s device support \"%s\"\n",
+        recordType, dset);
+    return S_dev_noDevSup;
+}
+
+/*
+ * Parallel record initialization
+ *
+ * The thread-safe records are divided into chunks which the pool threads
+ * initialize while this thread initializes the others in their usual
+ * order.  For pass 1 a lock set is only initialized in parallel if all its
+ * records are thread-safe, and always by the one thread in their usual
+ * order, since init_record() may read the records it links to.
+ */
+typedef struct initRec {
+    dbRecordType *rtyp;
+    dbCommon *prec;
+    unsigned long lockId;
+    char safe;
+    char parallel;      /* in a chunk in this pass */
+} initRec;
+
+typedef struct initChunk {
+    epicsJob *job;
+    recIterFunc func;
+    initRec **precs;
+    size_t n;
+} initChunk;
+
+static epicsThreadPool *initPool;
+static initRec *initRecs;
+static size_t nInitRecs;
+
+static void addInitRec(dbRecordType *rtyp, dbCommon *prec, void *junk)
+{
+    initRec *pir = &initRecs[nInitRecs++];
+    devSup *pdevSup;
+
+    pir->rtyp = rtyp;
+    pir->prec = prec;
+    if (!rtyp->initThreadSafe)
+        return;
+    if (ellCount(&rtyp->devList) == 0) {
+        pir->safe = TRUE;
+        return;
+    }
+    pdevSup = dbDTYPtoDevSup(rtyp, prec->dtyp);
+    pir->safe = pdevSup && pdevSup->initThreadSafe;
+}
+
+static void initParallelStart(void)
+{
+    epicsThreadPoolConfig conf;
+    dbRecordType *pdbRecordType;
+    size_t nrec = 0, nsafe = 0, i;
+
+    startupParallel[0] = startupParallel[1] = 0;
+    if (dbInitThreads <= 0)
+        return;
+
+    for (pdbRecordType = (dbRecordType *)ellFirst(&pdbbase->recordTypeList);
+         pdbRecordType;
+         pdbRecordType = (dbRecordType *)ellNext(&pdbRecordType->node)) {
+        nrec += ellCount(&pdbRecordType->recList);
+    }
+    initRecs = calloc(nrec ? nrec : 1, sizeof(initRec));
+    if (!initRecs) {
+        errlogPrintf("iocInit: Out of memory, initializing records in turn\n");
+        return;
+    }
+    nInitRecs = 0;
+    iterateRecords(addInitRec, NULL);
+    for (i = 0; i < nInitRecs; i++)
+        nsafe += initRecs[i].safe;
+
+    if (nsafe) {
+        epicsThreadPoolConfigDefaults(&conf);
+        conf.initialThreads = conf.maxThreads = dbInitThreads;
+        conf.workerStack = epicsThreadGetStackSize(epicsThreadStackBig);
+        conf.workerPriority = epicsThreadGetPrioritySelf();
+        initPool = epicsThreadPoolCreate(&conf);
+        if (!initPool)
+            errlogPrintf("iocInit: Can't create thread pool, "
+                "initializing records in turn\n");
+    }
+    if (!initPool) {
+        free(initRecs);
+        initRecs = NULL;
+        return;
+    }
+    startupThreads = dbInitThreads;
+}
+
+static void initParallelStop(void)
+{
+    if (initPool)
+        epicsThreadPoolDestroy(initPool);
+    initPool = NULL;
+    free(initRecs);
+    initRecs = NULL;
+    nInitRecs = 0;
+}
+
+static void initChunkRun(void *arg, epicsJobMode mode)
+{
+    initChunk *pchunk = (initChunk *)arg;
+    size_t i;
+
+    if (mode != epicsJobModeRun)
+        return;
+    epicsThreadSetOkToBlock(1);
+    for (i = 0; i < pchunk->n; i++)
+        pchunk->func(pchunk->precs[i]->rtyp, pchunk->precs[i]->prec, NULL);
+}
+
+static int cmpLockId(const void *a, const void *b)
+{
+    const initRec *pa = *(const initRec * const *)a;
+    const initRec *pb = *(const initRec * const *)b;
+
+    if (pa->lockId != pb->lockId)
+        return pa->lockId < pb->lockId ? -1 : 1;
+    return pa < pb ? -1 : pa > pb;  /* the usual order within a lock set */
+}
+
+/* Returns the number of records initialized by the pool */
+static size_t initPass(recIterFunc func, int byLockSet)
+{
+    initRec **plist;
+    initChunk *chunks;
+    size_t n = 0, nchunks = 0, chunkSize, i, j;
+
+    if (!initPool) {
+        iterateRecords(func, NULL);
+        return 0;
+    }
+    plist = calloc(nInitRecs ? nInitRecs : 1, sizeof(initRec *));
+    chunks = calloc(nInitRecs ? nInitRecs : 1, sizeof(initChunk));
+    if (!plist || !chunks) {
+        free(plist);
+        free(chunks);
+        iterateRecords(func, NULL);
+        return 0;
+    }
+
+    if (!byLockSet) {
+        for (i = 0; i < nInitRecs; i++) {
+            initRecs[i].parallel = initRecs[i].safe;
+            if (initRecs[i].safe)
+                plist[n++] = &initRecs[i];
+        }
+    }
+    else {
+        for (i = 0; i < nInitRecs; i++) {
+            initRecs[i].lockId = dbLockGetLockId(initRecs[i].prec);
+            plist[i] = &initRecs[i];
+        }
+        qsort(plist, nInitRecs, sizeof(initRec *), cmpLockId);
+
+        /* keep the lock sets where every record is thread-safe */
+        for (i = 0; i < nInitRecs; i = j) {
+            int safe = TRUE;
+
+            for (j = i; j < nInitRecs && plist[j]->lockId == plist[i]->lockId;
+                 j++)
+                safe &= plist[j]->safe;
+            while (i < j) {
+                plist[i]->parallel = safe;
+                if (safe)
+                    plist[n++] = plist[i];
+                i++;
+            }
+        }
+    }
+
+    /* about 8 chunks for each thread, not splitting lock sets */
+    chunkSize = n / (8 * (size_t)dbInitThreads) + 1;
+    for (i = 0; i < n; i = j) {
+        initChunk *pchunk = &chunks[nchunks++];
+
+        /* find the end of the chunk, extended to the end of its lock set */
+        j = i + 1;
+        while (j < n && (j - i < chunkSize ||
+               (byLockSet && plist[j]->lockId == plist[j - 1]->lockId))) {
+            j++;
+        }
+        pchunk->func = func;
+        pchunk->precs = &plist[i];
+        pchunk->n = j - i;
+        pchunk->job = epicsJobCreate(initPool, initChunkRun, pchunk);
+        if (!pchunk->job || epicsJobQueue(pchunk->job))
+            initChunkRun(pchunk, epicsJobModeRun);
+    }
+
+    for (i = 0; i < nInitRecs; i++) {
+        if (!initRecs[i].parallel)
+            func(initRecs[i].rtyp, initRecs[i].prec, NULL);
+    }
+
+    epicsThreadPoolWait(initPool, -1.0);
+    for (i = 0; i < nchunks; i++) {
+        if (chunks[i].job)
+            epicsJobDestroy(chunks[i].job);
+    }
+    free(chunks);
+    free(plist);
+    return n;
+}
+
 static void initDatabase(void)
 {
+    epicsUInt64 t0;
+
     dbChannelInit();
-    iterateRecords(doInitRecord0, NULL);
+    initParallelStart();
+
+    t0 = epicsMonotonicGet();
+    startupParallel[0] = initPass(doInitRecord0, FALSE);
+    phaseDone(phaseInitRecord0, t0);
+
+    t0 = epicsMonotonicGet();
     iterateRecords(doResolveLinks, NULL);
-    iterateRecords(doInitRecord1, NULL);
+    phaseDone(phaseResolveLinks, t0);
 
+    t0 = epicsMonotonicGet();
+    startupParallel[1] = initPass(doInitRecord1, TRUE);
+    phaseDone(phaseInitRecord1, t0);
+
+    initParallelStop();
     epicsAtExit(exitDatabase, NULL);
     return;
 }
@@ -616,13 +1006,17 @@ static void piniProcess(int pini)
 
 static void piniProcessHook(initHookState state)
 {
+    epicsUInt64 t0 = epicsMonotonicGet();
+
     switch (state) {
     case initHookAtIocRun:
         piniProcess(menuPiniRUN);
+        phaseDone(phasePiniRun, t0);
         break;
 
     case initHookAfterIocRunning:
         piniProcess(menuPiniRUNNING);
+        phaseDone(phasePiniRunning, t0);
         break;
 
     case initHookAtIocPause:
@@ -640,8 +1034,11 @@ static void piniProcessHook(initHookState state)
 
 static void initialProcess(void)
 {
+    epicsUInt64 t0 = epicsMonotonicGet();
+
     initHookRegister(piniProcessHook);
     piniProcess(menuPiniYES);
+    phaseDone(phasePini, t0);
 }
 
 
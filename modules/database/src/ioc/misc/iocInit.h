@@ -12,6 +12,7 @@
 #ifndef INCiocInith
 #define INCiocInith
 
+#include "epicsTypes.h"
 #include "dbCoreAPI.h"
 
 enum iocStateEnum {
@@ -33,6 +34,47 @@ DBCORE_API int iocRun(void);
 DBCORE_API int iocPause(void);
 DBCORE_API int iocShutdown(void);
 
+/** @brief Number of threads initializing records in parallel.
+ *
+ * While this is 0 (the default) iocBuild() initializes every record in
+ * turn.  Otherwise the records declared thread-safe with dbInitThreadSafe()
+ * are initialized by a pool of this many threads, and the others in turn
+ * by the thread running iocBuild().
+ */
+DBCORE_API extern int dbInitThreads;
+
+/** @brief Declare that records may be initialized in parallel.
+ *
+ * Declares that the init_record() routines of a record type, or of one of
+ * its device supports, may be called for different records at the same
+ * time, and while other record types and device supports initialize their
+ * records.  The record type's pass 1 may also read the fields of other
+ * records in its lock set, which are then initialized by the same thread.
+ *
+ * A record is initialized in parallel when its record type has been
+ * declared thread-safe and, if the record type has device supports, the
+ * device support the record uses has also been.  Links are always resolved
+ * in turn.  This must be called before iocBuild(), from a registrar or from
+ * the startup script.
+ *
+ * @param recordType The record type, e.g. "ai".
+ * @param dset NULL or "" to declare the record type, otherwise the name or
+ * DTYP choice of the device support, e.g. "devAiSoft" or "Soft Channel".
+ * @return 0 or error status.
+ */
+DBCORE_API long dbInitThreadSafe(const char *recordType, const char *dset);
+
+/** @brief Print how long each phase of the IOC startup took.
+ *
+ * Covers the dbLoadDatabase() and dbLoadRecords() calls, the steps of
+ * iocBuild() including record initialization and processing records with
+ * PINI set, and iocRun().
+ */
+DBCORE_API void iocStartupReport(void);
+
+/* Used by dbLoadDatabase() and dbLoadRecords() */
+DBCORE_API void iocStartupLoadTime(int records, epicsUInt64 start);
+
 #ifdef __cplusplus
 }
 #endif
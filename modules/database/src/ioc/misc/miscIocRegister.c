@@ -53,6 +53,30 @@ static void iocPauseCallFunc(const iocshArgBuf *args)
     iocshSetError(iocPause());
 }
 
+/* dbInitThreadSafe */
+static const iocshArg dbInitThreadSafeArg0 = { "recordType",iocshArgString};
+static const iocshArg dbInitThreadSafeArg1 = { "dset",iocshArgString};
+static const iocshArg * const dbInitThreadSafeArgs[] = {
+    &dbInitThreadSafeArg0, &dbInitThreadSafeArg1};
+static const iocshFuncDef dbInitThreadSafeFuncDef = {"dbInitThreadSafe",2,
+             dbInitThreadSafeArgs,
+             "Declare that the records of a record type, or of one of its\n"
+             "device supports (named by dset or DTYP choice), may be initialized\n"
+             "in parallel when dbInitThreads is set.  Must be used before iocInit.\n"};
+static void dbInitThreadSafeCallFunc(const iocshArgBuf *args)
+{
+    iocshSetError(dbInitThreadSafe(args[0].sval, args[1].sval));
+}
+
+/* iocStartupReport */
+static const iocshFuncDef iocStartupReportFuncDef = {"iocStartupReport",0,NULL,
+             "Print how long each phase of loading the database and of\n"
+             "iocInit took.\n"};
+static void iocStartupReportCallFunc(const iocshArgBuf *args)
+{
+    iocStartupReport();
+}
+
 /* coreRelease */
 static const iocshFuncDef coreReleaseFuncDef = {"coreRelease",0,NULL,
              "Print release information for iocCore.\n"};
@@ -68,6 +92,8 @@ void miscIocRegister(void)
     iocshRegister(&iocBuildFuncDef,iocBuildCallFunc);
     iocshRegister(&iocRunFuncDef,iocRunCallFunc);
     iocshRegister(&iocPauseFuncDef,iocPauseCallFunc);
+    iocshRegister(&dbInitThreadSafeFuncDef,dbInitThreadSafeCallFunc);
+    iocshRegister(&iocStartupReportFuncDef,iocStartupReportCallFunc);
     iocshRegister(&coreReleaseFuncDef, coreReleaseCallFunc);
 }
 
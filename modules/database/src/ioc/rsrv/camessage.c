@@ -42,6 +42,7 @@
 #include "callback.h"
 #include "db_access.h"
 #include "db_access_routines.h"
+#include "db_convert.h"
 #include "dbChannel.h"
 #include "dbCommon.h"
 #include "dbEvent.h"
@@ -129,6 +130,44 @@ static struct channel_in_use *MPTOPCIU (const caHdrLargeArray *mp)
     return pciu;
 }
 
+/* longest error reply payload, cf. vsend_err() */
+static const ca_uint32_t maxDiagLen = 512;
+
+/*
+ * casReplyBound()
+ *
+ * Most room which the replies to a TCP request can take in the send
+ * buffer, reserved by reactor threads before they handle it
+ */
+static unsigned casReplyBound ( const caHdrLargeArray *mp )
+{
+    /* an error, or a few other small replies */
+    const unsigned small = 2u * ( sizeof ( caHdr ) +
+        2u * sizeof ( ca_uint32_t ) ) + maxDiagLen;
+    const unsigned largest = rsrvSizeofLargeBufTCP +
+        sizeof ( caHdr ) + 2u * sizeof ( ca_uint32_t );
+    unsigned bound;
+
+    switch ( mp->m_cmmd ) {
+    case CA_PROTO_READ:
+    case CA_PROTO_READ_NOTIFY:
+    case CA_PROTO_EVENT_ADD:
+        if ( INVALID_DB_REQ ( mp->m_dataType ) ) {
+            return small;
+        }
+        /* the channel's element count isn't known yet */
+        if ( mp->m_count == 0u || mp->m_count >=
+                largest / dbr_value_size[mp->m_dataType] ) {
+            return largest;
+        }
+        bound = CA_MESSAGE_ALIGN ( dbr_size_n ( mp->m_dataType,
+            mp->m_count ) ) + sizeof ( caHdr ) + 2u * sizeof ( ca_uint32_t );
+        return bound > small ? bound : small;
+    default:
+        return small;
+    }
+}
+
 /*  vsend_err()
  *
  *  reflect error msg back to the client
@@ -144,7 +183,6 @@ const char              *pformat,
 va_list                 args
 )
 {
-    static const ca_uint32_t    maxDiagLen = 512;
     struct channel_in_use       *pciu;
     caHdr                       *pReqOut;
     char                        *pMsgString;
@@ -479,6 +517,32 @@ static void no_read_access_event ( struct client *pClient,
     }
 }
 
+/*
+ * zeroCopyType()
+ *
+ * TRUE if the values of this channel are sent to the client exactly as
+ * they are stored when it asks for dbrType, so need no conversion
+ */
+static int zeroCopyType ( struct dbChannel *dbch, unsigned dbrType )
+{
+    if ( dbrType > DBR_DOUBLE ||
+            dbChannelFinalCAType ( dbch ) != dbrType ||
+            dbChannelFinalFieldSize ( dbch ) != dbr_value_size[dbrType] ) {
+        return FALSE;
+    }
+    /* single bytes need no swapping */
+    if ( dbr_value_size[dbrType] == 1u ) {
+        return TRUE;
+    }
+#if EPICS_BYTE_ORDER == EPICS_ENDIAN_BIG && \
+    EPICS_FLOAT_WORD_ORDER == EPICS_ENDIAN_BIG
+    /* rules out the 64 bit integers, which are also sent as DBR_DOUBLE */
+    return dbChannelFinalFieldType ( dbch ) == dbDBRoldToDBFnew[dbrType];
+#else
+    return FALSE;
+#endif
+}
+
 /*
  *  read_reply()
  */
@@ -506,6 +570,27 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
      * request for all available elements.  In this case we initialize the
      * header with the maximum element size specified by the database. */
     autosize = pevext->msg.m_count == 0;
+
+    /* Large arrays which need no conversion are sent straight from the
+     * immutable snapshot in the field log, without being copied into the
+     * send buffer.  Requests for more elements than are available need
+     * zero padding, so take the normal path. */
+    if ( readAccess && casZeroCopyMinBytes > 0 &&
+            db_field_log_is_snapshot ( pfl ) &&
+            ( autosize || pevext->msg.m_count <= pfl->no_elements ) &&
+            zeroCopyType ( dbch, pevext->msg.m_dataType ) ) {
+        item_count = autosize ? pfl->no_elements : pevext->msg.m_count;
+        payload_size = item_count * dbr_value_size[pevext->msg.m_dataType];
+        if ( payload_size >= (ca_uint32_t) casZeroCopyMinBytes &&
+                cas_send_external ( pClient, pevext->msg.m_cmmd,
+                    payload_size, pevext->msg.m_dataType, item_count, cid,
+                    pevext->msg.m_available,
+                    dbfl_pfield ( pfl ) ) == ECA_NORMAL ) {
+            SEND_UNLOCK ( pClient );
+            return;
+        }
+    }
+
     item_count =
         autosize ? paddr->no_elements : pevext->msg.m_count;
     payload_size = dbr_size_n(pevext->msg.m_dataType, item_count);
@@ -1844,6 +1929,19 @@ static int event_add_action (caHdrLargeArray *mp, void *pPayload, struct client
         return RSRV_ERROR;
     }
 
+    /*
+     * large arrays which can be sent without conversion need a
+     * snapshot of each update, see read_reply()
+     */
+    if ( casZeroCopyMinBytes > 0 &&
+            client->proto == IPPROTO_TCP && ! client->reactor &&
+            zeroCopyType ( pciu->dbch, mp->m_dataType ) &&
+            dbr_size_n ( mp->m_dataType, mp->m_count ? mp->m_count :
+                dbChannelFinalElements ( pciu->dbch ) ) >=
+                (unsigned long) casZeroCopyMinBytes ) {
+        db_event_enable_snapshot ( pevext->pdbev );
+    }
+
     /*
      * always send it once at event add
      */
@@ -2188,8 +2286,10 @@ static int search_reply_udp ( caHdrLargeArray *mp, void *pPayload, struct client
     /* Exit quickly if channel not on this node */
     if (dbChannelTest(pName)) {
         DLOG ( 2, ( "CAS: Lookup for channel \"%s\" failed\n", pName ) );
+        client->nSearchMisses++;
         return RSRV_OK;
     }
+    client->nSearchHits++;
 
     /*
      * stop further use of server if memory becomes scarce
@@ -2519,6 +2619,18 @@ int camessage ( struct client *client )
             break;
         }
 
+        /*
+         * a reactor thread can't wait for room for the replies, so the
+         * rest of the requests wait in the receive buffer until the
+         * socket takes what is already queued
+         */
+        if ( client->reactor &&
+                ! cas_send_reserve ( client, casReplyBound ( &msg ) ) ) {
+            client->recvStalled = TRUE;
+            status = RSRV_OK;
+            break;
+        }
+
         nmsg++;
 
         if ( CASDEBUG > 2 )
@@ -2540,13 +2652,20 @@ int camessage ( struct client *client )
         else {
             if ( msg.m_cmmd < NELEMENTS(tcpJumpTable) ) {
                 status = ( *tcpJumpTable[msg.m_cmmd] ) ( &msg, pBody, client );
+                if ( client->reactor ) {
+                    cas_send_release ( client );
+                }
                 if ( status != RSRV_OK ) {
                     status = RSRV_ERROR;
                     break;
                 }
             }
             else {
-                return bad_tcp_cmd_action ( &msg, pBody, client );
+                status = bad_tcp_cmd_action ( &msg, pBody, client );
+                if ( client->reactor ) {
+                    cas_send_release ( client );
+                }
+                return status;
             }
         }
 
@@ -33,6 +33,130 @@
 #include "rsrv.h"
 #include "server.h"
 
+/*
+ *  casClientRecv()
+ *
+ *  Receive whatever is available from a TCP client and process any
+ *  complete messages.  Shared by camsgtask() and the reactor threads.
+ *
+ *  Returns RSRV_ERROR when the circuit should be shut down.
+ */
+int casClientRecv ( struct client *client )
+{
+    long nchars;
+
+    assert ( client->recv.maxstk >= client->recv.cnt );
+    nchars = recv ( client->sock, &client->recv.buf[client->recv.cnt],
+            (int) ( client->recv.maxstk - client->recv.cnt ), 0 );
+    if ( nchars == 0 ){
+        if ( CASDEBUG > 0 ) {
+            /* convert to u long so that %lu works on both 32 and 64 bit archs */
+            unsigned long cnt = sizeof ( client->recv.buf ) - client->recv.cnt;
+            errlogPrintf ( "CAS: nill message disconnect ( %lu bytes request )\n",
+                cnt );
+        }
+        return RSRV_ERROR;
+    }
+    else if ( nchars < 0 ) {
+        int anerrno = SOCKERRNO;
+
+        /* reactor sockets are non-blocking */
+        if ( anerrno == SOCK_EINTR || anerrno == SOCK_EWOULDBLOCK ) {
+            return RSRV_OK;
+        }
+
+        if ( anerrno == SOCK_ENOBUFS ) {
+            errlogPrintf (
+                "CAS: Out of network buffers, retring receive in 15 seconds\n" );
+            if ( client->reactor ) {
+                /* the reactor sets the client aside, it must not sleep */
+                client->reactorRetry = TRUE;
+            }
+            else {
+                epicsThreadSleep ( 15.0 );
+            }
+            return RSRV_OK;
+        }
+
+        /*
+         * normal conn lost conditions
+         */
+        if (    ( anerrno != SOCK_ECONNABORTED &&
+            anerrno != SOCK_ECONNRESET &&
+            anerrno != SOCK_ETIMEDOUT ) ||
+            CASDEBUG > 2 ) {
+            char sockErrBuf[64];
+
+            epicsSocketConvertErrorToString(
+                sockErrBuf, sizeof ( sockErrBuf ), anerrno);
+            errlogPrintf ( "CAS: Client disconnected - %s\n",
+                sockErrBuf );
+        }
+        return RSRV_ERROR;
+    }
+
+    epicsTimeGetCurrent ( &client->time_at_last_recv );
+    client->recv.cnt += ( unsigned ) nchars;
+
+    return casClientProcess ( client );
+}
+
+/*
+ *  casClientProcess()
+ *
+ *  Process the complete messages in the receive buffer.  Those left when
+ *  a reactor thread runs out of room for the replies (recvStalled) are
+ *  moved to the front of the buffer, along with any partial message.
+ *
+ *  Returns RSRV_ERROR when the circuit should be shut down.
+ */
+int casClientProcess ( struct client *client )
+{
+    int status;
+
+    client->recv.stk = 0;
+    status = camessage ( client );
+    if (status == 0) {
+        /*
+         * if there is a partial message
+         * align it with the start of the buffer
+         */
+        if (client->recv.cnt > client->recv.stk) {
+            unsigned bytes_left;
+
+            bytes_left = client->recv.cnt - client->recv.stk;
+
+            /*
+             * overlapping regions handled
+             * properly by memmove
+             */
+            memmove (client->recv.buf,
+                &client->recv.buf[client->recv.stk], bytes_left);
+            client->recv.cnt = bytes_left;
+        }
+        else {
+            client->recv.cnt = 0ul;
+        }
+    }
+    else {
+        char buf[64];
+
+        /* flush any queued messages before shutdown */
+        cas_send_bs_msg(client, 1);
+
+        client->recv.cnt = 0ul;
+
+        /*
+         * disconnect when there are severe message errors
+         */
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+        epicsPrintf ("CAS: forcing disconnect from %s\n", buf);
+        return RSRV_ERROR;
+    }
+
+    return RSRV_OK;
+}
+
 /*
  *  camsgtask()
  *
@@ -46,7 +170,6 @@ void camsgtask ( void *pParm )
 
     while (castcp_ctl == ctlRun && !client->disconnect) {
         osiSockIoctl_t check_nchars;
-        long nchars;
         int status;
 
         /*
@@ -66,91 +189,9 @@ void camsgtask ( void *pParm )
             cas_send_bs_msg(client, TRUE);
         }
 
-        client->recv.stk = 0;
-        assert ( client->recv.maxstk >= client->recv.cnt );
-        nchars = recv ( client->sock, &client->recv.buf[client->recv.cnt],
-                (int) ( client->recv.maxstk - client->recv.cnt ), 0 );
-        if ( nchars == 0 ){
-            if ( CASDEBUG > 0 ) {
-                /* convert to u long so that %lu works on both 32 and 64 bit archs */
-                unsigned long cnt = sizeof ( client->recv.buf ) - client->recv.cnt;
-                errlogPrintf ( "CAS: nill message disconnect ( %lu bytes request )\n",
-                    cnt );
-            }
-            break;
-        }
-        else if ( nchars < 0 ) {
-            int anerrno = SOCKERRNO;
-
-            if ( anerrno == SOCK_EINTR ) {
-                continue;
-            }
-
-            if ( anerrno == SOCK_ENOBUFS ) {
-                errlogPrintf (
-                    "CAS: Out of network buffers, retring receive in 15 seconds\n" );
-                epicsThreadSleep ( 15.0 );
-                continue;
-            }
-
-            /*
-             * normal conn lost conditions
-             */
-            if (    ( anerrno != SOCK_ECONNABORTED &&
-                anerrno != SOCK_ECONNRESET &&
-                anerrno != SOCK_ETIMEDOUT ) ||
-                CASDEBUG > 2 ) {
-                char sockErrBuf[64];
-
-                epicsSocketConvertErrorToString(
-                    sockErrBuf, sizeof ( sockErrBuf ), anerrno);
-                errlogPrintf ( "CAS: Client disconnected - %s\n",
-                    sockErrBuf );
-            }
+        if ( casClientRecv ( client ) != RSRV_OK ) {
             break;
         }
-
-        epicsTimeGetCurrent ( &client->time_at_last_recv );
-        client->recv.cnt += ( unsigned ) nchars;
-
-        status = camessage ( client );
-        if (status == 0) {
-            /*
-             * if there is a partial message
-             * align it with the start of the buffer
-             */
-            if (client->recv.cnt > client->recv.stk) {
-                unsigned bytes_left;
-
-                bytes_left = client->recv.cnt - client->recv.stk;
-
-                /*
-                 * overlapping regions handled
-                 * properly by memmove
-                 */
-                memmove (client->recv.buf,
-                    &client->recv.buf[client->recv.stk], bytes_left);
-                client->recv.cnt = bytes_left;
-            }
-            else {
-                client->recv.cnt = 0ul;
-            }
-        }
-        else {
-            char buf[64];
-
-            /* flush any queued messages before shutdown */
-            cas_send_bs_msg(client, 1);
-
-            client->recv.cnt = 0ul;
-
-            /*
-             * disconnect when there are severe message errors
-             */
-            ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-            epicsPrintf ("CAS: forcing disconnect from %s\n", buf);
-                break;
-        }
     }
 
     LOCK_CLIENTQ;
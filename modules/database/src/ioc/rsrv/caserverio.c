@@ -32,24 +32,162 @@
 
 #include "server.h"
 
+#if !defined(_WIN32) && !defined(vxWorks)
+#   include <sys/uio.h>
+#   define CAS_HAVE_SENDMSG
+#endif
+
 /*
- *  cas_send_bs_msg()
- *
- *  (channel access server send message)
- *
+ *  The TCP send buffer is used as a ring.  Unsent bytes are [cnt, stk),
+ *  or [cnt, wrap) followed by [0, stk) after new messages have wrapped
+ *  around to the front of the buffer.  A partial send() only advances
+ *  cnt so unsent bytes are never moved.  Each message is contiguous.
  *
- * Set lock_needed=1 unless SEND_LOCK() is held by caller
+ *  UDP send buffers are linear, [0, stk) with cnt and wrap left zero.
  */
-void cas_send_bs_msg ( struct client *pclient, int lock_needed )
+unsigned cas_send_pending ( const struct client *pclient )
 {
-    int status;
+    const struct message_buffer *buf = &pclient->send;
 
-    if ( lock_needed ) {
-        SEND_LOCK ( pclient );
+    if ( buf->wrap ) {
+        return buf->wrap - buf->cnt + buf->stk;
     }
+    return buf->stk - buf->cnt;
+}
 
-    if ( CASDEBUG > 2 && pclient->send.stk ) {
-        errlogPrintf ( "CAS: Sending a message of %d bytes\n", pclient->send.stk );
+static void sendBufReset ( struct message_buffer *buf )
+{
+    buf->stk = 0u;
+    buf->cnt = 0u;
+    buf->wrap = 0u;
+}
+
+/*
+ * TRUE if a message of this size can be placed at stk, possibly
+ * after wrapping around
+ */
+static int sendBufHasRoom ( const struct message_buffer *buf, unsigned size )
+{
+    if ( buf->wrap ) {
+        return buf->cnt - buf->stk >= size;
+    }
+    return buf->maxstk - buf->stk >= size ||
+        ( buf->type != mbtUDP && buf->cnt >= size );
+}
+
+static void sendBufReserve ( struct message_buffer *buf, unsigned size )
+{
+    if ( ! buf->wrap && buf->maxstk - buf->stk < size ) {
+        assert ( buf->type != mbtUDP && buf->cnt >= size );
+        buf->wrap = buf->stk;
+        buf->stk = 0u;
+    }
+}
+
+static void sendBufConsume ( struct message_buffer *buf, unsigned size )
+{
+    if ( buf->wrap ) {
+        unsigned first = buf->wrap - buf->cnt;
+        if ( size < first ) {
+            buf->cnt += size;
+            return;
+        }
+        buf->cnt = size - first;
+        buf->wrap = 0u;
+    }
+    else {
+        buf->cnt += size;
+    }
+    if ( buf->cnt >= buf->stk ) {
+        sendBufReset ( buf );
+    }
+}
+
+/*
+ * Payload sent from outside of the send buffer, after all of its contents
+ */
+typedef struct casExtPayload {
+    const char  *pData;
+    unsigned    dataSize;
+    unsigned    size;           /* dataSize plus zero padding */
+    unsigned    sent;
+} casExtPayload;
+
+static const char casZeroPad[8];
+
+static unsigned extRemaining ( const casExtPayload *pExt )
+{
+    return pExt ? pExt->size - pExt->sent : 0u;
+}
+
+/*
+ * Send as much of the ring, then of any external payload, as the
+ * socket will take in one call
+ */
+static int sendBufSend ( struct client *pclient, const casExtPayload *pExt )
+{
+    struct message_buffer *buf = &pclient->send;
+    unsigned first = ( buf->wrap ? buf->wrap : buf->stk ) - buf->cnt;
+    unsigned padSent = 0u;
+
+    if ( pExt && pExt->sent > pExt->dataSize ) {
+        padSent = pExt->sent - pExt->dataSize;
+    }
+
+#ifdef CAS_HAVE_SENDMSG
+    if ( ( buf->wrap && buf->stk ) || ( first && extRemaining ( pExt ) ) ) {
+        struct iovec iov[4];
+        struct msghdr msg;
+        unsigned n = 0u;
+
+        if ( first ) {
+            iov[n].iov_base = &buf->buf[buf->cnt];
+            iov[n++].iov_len = first;
+        }
+        if ( buf->wrap && buf->stk ) {
+            iov[n].iov_base = buf->buf;
+            iov[n++].iov_len = buf->stk;
+        }
+        if ( pExt && pExt->sent < pExt->dataSize ) {
+            iov[n].iov_base = (void *) &pExt->pData[pExt->sent];
+            iov[n++].iov_len = pExt->dataSize - pExt->sent;
+        }
+        if ( pExt && pExt->size - pExt->dataSize > padSent ) {
+            iov[n].iov_base = (void *) &casZeroPad[padSent];
+            iov[n++].iov_len = pExt->size - pExt->dataSize - padSent;
+        }
+        memset ( &msg, 0, sizeof ( msg ) );
+        msg.msg_iov = iov;
+        msg.msg_iovlen = n;
+        return sendmsg ( pclient->sock, &msg, 0 );
+    }
+#endif
+    if ( first ) {
+        return send ( pclient->sock, &buf->buf[buf->cnt], first, 0 );
+    }
+    if ( pExt->sent < pExt->dataSize ) {
+        return send ( pclient->sock, &pExt->pData[pExt->sent],
+            pExt->dataSize - pExt->sent, 0 );
+    }
+    return send ( pclient->sock, &casZeroPad[padSent],
+        pExt->size - pExt->sent, 0 );
+}
+
+/*
+ *  casSendFlush()
+ *
+ *  Send until the send buffer, and pExt if supplied, is empty or, if need
+ *  is non-zero, until a message of that size will fit.  SEND_LOCK() must
+ *  be held.
+ */
+static void casSendFlush ( struct client *pclient, unsigned need,
+    casExtPayload *pExt )
+{
+    int status;
+
+    if ( CASDEBUG > 2 && cas_send_pending ( pclient ) ) {
+        errlogPrintf ( "CAS: Sending a message of %u bytes\n",
+            cas_send_pending ( pclient ) + extRemaining ( pExt ) );
     }
 
     if ( pclient->disconnect ) {
@@ -57,27 +195,29 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
             errlogPrintf ( "CAS: msg Discard for sock %d addr %x\n",
                 (int)pclient->sock, (unsigned) pclient->addr.sin_addr.s_addr );
         }
-        pclient->send.stk = 0u;
-        if(lock_needed)
-            SEND_UNLOCK(pclient);
+        sendBufReset ( &pclient->send );
         return;
     }
 
-    while ( pclient->send.stk && ! pclient->disconnect ) {
-        status = send ( pclient->sock, pclient->send.buf, pclient->send.stk, 0 );
+    while ( ( cas_send_pending ( pclient ) || extRemaining ( pExt ) ) &&
+            ! pclient->disconnect ) {
+        if ( need && sendBufHasRoom ( &pclient->send, need ) ) {
+            break;
+        }
+        status = sendBufSend ( pclient, pExt );
         if ( status >= 0 ) {
             unsigned transferSize = (unsigned) status;
-            if ( transferSize >= pclient->send.stk ) {
-                pclient->send.stk = 0;
+            unsigned pending = cas_send_pending ( pclient );
+            unsigned fromBuf = transferSize < pending ? transferSize : pending;
+
+            sendBufConsume ( &pclient->send, fromBuf );
+            if ( pExt ) {
+                pExt->sent += transferSize - fromBuf;
+            }
+            if ( ! cas_send_pending ( pclient ) && ! extRemaining ( pExt ) ) {
                 epicsTimeGetCurrent ( &pclient->time_at_last_send );
                 break;
             }
-            else {
-                unsigned bytesLeft = pclient->send.stk - transferSize;
-                memmove ( pclient->send.buf, &pclient->send.buf[transferSize],
-                    bytesLeft );
-                pclient->send.stk = bytesLeft;
-            }
         }
         else {
             int causeWasSocketHangup = 0;
@@ -85,7 +225,7 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
             char buf[64];
 
             if ( pclient->disconnect ) {
-                pclient->send.stk = 0u;
+                sendBufReset ( &pclient->send );
                 break;
             }
 
@@ -93,10 +233,35 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                 continue;
             }
 
+            /*
+             * Only reactor clients have non-blocking sockets.  Their
+             * reactor thread leaves the rest to be sent once the socket
+             * is writable, other threads wait without SEND_LOCK() so
+             * that the reactor never waits for them.
+             */
+            if ( anerrno == SOCK_EWOULDBLOCK ) {
+                if ( rsrv_reactor_is_self ( pclient ) ) {
+                    break;
+                }
+                rsrv_reactor_wait_send ( pclient );
+                continue;
+            }
+
             if ( anerrno == SOCK_ENOBUFS ) {
                 errlogPrintf (
                     "CAS: Out of network buffers, retrying send in 15 seconds\n" );
-                epicsThreadSleep ( 15.0 );
+                if ( rsrv_reactor_is_self ( pclient ) ) {
+                    pclient->reactorRetry = TRUE;
+                    break;
+                }
+                if ( pclient->reactor ) {
+                    SEND_UNLOCK ( pclient );
+                    epicsThreadSleep ( 15.0 );
+                    SEND_LOCK ( pclient );
+                }
+                else {
+                    epicsThreadSleep ( 15.0 );
+                }
                 continue;
             }
 
@@ -117,8 +282,7 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                     buf, sockErrBuf);
             }
             pclient->disconnect = TRUE;
-            pclient->send.stk = 0u;
-
+            sendBufReset ( &pclient->send );
             /*
              * wakeup the receive thread
              */
@@ -154,6 +318,99 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
             }
         }
     }
+}
+
+/*
+ *  casSendWaitRoom()
+ *
+ *  Send until a message of this size will fit.  Other threads also leave
+ *  the room which the client's reactor thread has reserved, and when the
+ *  ring is empty wait for cas_send_release() to signal sendReleased.  A
+ *  reactor thread never waits, so it may return without room.
+ *  SEND_LOCK() must be held.
+ */
+static void casSendWaitRoom ( struct client *pclient, unsigned size )
+{
+    const int self = rsrv_reactor_is_self ( pclient );
+
+    while ( ! pclient->disconnect ) {
+        unsigned need = self ? size : size + pclient->sendReserve;
+
+        if ( sendBufHasRoom ( &pclient->send, need ) ) {
+            break;
+        }
+        if ( cas_send_pending ( pclient ) ) {
+            /* only wait for as much room as this message needs */
+            casSendFlush ( pclient, need, NULL );
+            if ( self && ! sendBufHasRoom ( &pclient->send, need ) ) {
+                break;
+            }
+        }
+        else if ( self || ! pclient->sendReserve ) {
+            break;
+        }
+        else {
+            SEND_UNLOCK ( pclient );
+            epicsEventMustWait ( pclient->sendReleased );
+            SEND_LOCK ( pclient );
+            if ( ! pclient->sendReserve ) {
+                /* pass the wakeup on to any other thread waiting */
+                epicsEventSignal ( pclient->sendReleased );
+            }
+        }
+    }
+}
+
+/*
+ *  cas_send_reserve()
+ *
+ *  Called by a reactor thread before it handles a request whose replies
+ *  take at most size bytes.  Returns FALSE, without waiting, if the send
+ *  buffer can't take them yet.  Otherwise keeps that much room from the
+ *  other threads until cas_send_release().
+ */
+int cas_send_reserve ( struct client *pclient, unsigned size )
+{
+    int room;
+
+    SEND_LOCK ( pclient );
+    if ( cas_send_pending ( pclient ) &&
+            ! sendBufHasRoom ( &pclient->send, size ) ) {
+        casSendFlush ( pclient, size, NULL );
+    }
+    room = ! cas_send_pending ( pclient ) ||
+        sendBufHasRoom ( &pclient->send, size );
+    if ( room ) {
+        pclient->sendReserve = size;
+    }
+    SEND_UNLOCK ( pclient );
+
+    return room;
+}
+
+void cas_send_release ( struct client *pclient )
+{
+    SEND_LOCK ( pclient );
+    pclient->sendReserve = 0u;
+    epicsEventSignal ( pclient->sendReleased );
+    SEND_UNLOCK ( pclient );
+}
+
+/*
+ *  cas_send_bs_msg()
+ *
+ *  (channel access server send message)
+ *
+ *
+ * Set lock_needed=1 unless SEND_LOCK() is held by caller
+ */
+void cas_send_bs_msg ( struct client *pclient, int lock_needed )
+{
+    if ( lock_needed ) {
+        SEND_LOCK ( pclient );
+    }
+
+    casSendFlush ( pclient, 0u, NULL );
 
     if ( lock_needed ) {
         SEND_UNLOCK(pclient);
@@ -200,26 +457,32 @@ void cas_send_dg_msg ( struct client * pclient )
         sizeDG -= sizeof (caHdr);
     }
 
-    status = sendto ( pclient->sock, pDG, sizeDG, 0,
-       (struct sockaddr *)&pclient->addr, sizeof(pclient->addr) );
-    if ( status >= 0 ) {
-        if ( status >= sizeDG ) {
-            epicsTimeGetCurrent ( &pclient->time_at_last_send );
+    if ( pclient->udpBatch ) {
+        /* sent with the rest of the batch by cast_server() */
+        cas_batch_dg_msg ( pclient, pDG, (unsigned) sizeDG );
+    }
+    else {
+        status = sendto ( pclient->sock, pDG, sizeDG, 0,
+           (struct sockaddr *)&pclient->addr, sizeof(pclient->addr) );
+        if ( status >= 0 ) {
+            if ( status >= sizeDG ) {
+                epicsTimeGetCurrent ( &pclient->time_at_last_send );
+            }
+            else {
+                errlogPrintf (
+                    "CAS: System failed to send entire udp frame?\n" );
+            }
         }
         else {
-            errlogPrintf (
-                "CAS: System failed to send entire udp frame?\n" );
+            char sockErrBuf[64];
+            char buf[128];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            ipAddrToDottedIP ( &pclient->addr, buf, sizeof(buf) );
+            errlogPrintf( "CAS: UDP send to %s failed: %s\n",
+                buf, sockErrBuf);
         }
     }
-    else {
-        char sockErrBuf[64];
-        char buf[128];
-        epicsSocketConvertErrnoToString (
-            sockErrBuf, sizeof ( sockErrBuf ) );
-        ipAddrToDottedIP ( &pclient->addr, buf, sizeof(buf) );
-        errlogPrintf( "CAS: UDP send to %s failed: %s\n",
-            buf, sockErrBuf);
-    }
 
     pclient->send.stk = 0u;
 
@@ -247,10 +510,10 @@ void cas_send_dg_msg ( struct client * pclient )
  *  Returns a valid ptr to message body or NULL if the msg
  *  will not fit.
  */
-int cas_copy_in_header (
+static int copyInHeader (
     struct client *pclient, ca_uint16_t response, ca_uint32_t payloadSize,
     ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
-    ca_uint32_t responseSpecific, void **ppPayload )
+    ca_uint32_t responseSpecific, void **ppPayload, int external )
 {
     unsigned    msgSize;
     ca_uint32_t alignedPayloadSize;
@@ -262,7 +525,8 @@ int cas_copy_in_header (
 
     alignedPayloadSize = CA_MESSAGE_ALIGN ( payloadSize );
 
-    msgSize = alignedPayloadSize + sizeof ( caHdr );
+    /* an external payload only needs room for the header */
+    msgSize = ( external ? 0u : alignedPayloadSize ) + sizeof ( caHdr );
     if ( alignedPayloadSize >= 0xffff || nElem >= 0xffff ) {
         if ( ! CA_V49 ( pclient->minor_version_number ) ) {
             return ECA_16KARRAYCLIENT;
@@ -277,13 +541,22 @@ int cas_copy_in_header (
         }
     }
 
-    if ( pclient->send.stk > pclient->send.maxstk - msgSize ) {
+    if ( ! sendBufHasRoom ( &pclient->send, msgSize ) ) {
         if ( pclient->disconnect ) {
-            pclient->send.stk = 0;
+            sendBufReset ( &pclient->send );
         }
         else{
             if ( pclient->proto == IPPROTO_TCP) {
-                cas_send_bs_msg ( pclient, FALSE );
+                casSendWaitRoom ( pclient, msgSize );
+                if ( pclient->disconnect ) {
+                    sendBufReset ( &pclient->send );
+                }
+                else if ( ! sendBufHasRoom ( &pclient->send, msgSize ) ) {
+                    /* the reactor reserved too little, cf. camessage() */
+                    errlogPrintf ( "CAS: no room for a %u byte reply\n",
+                        msgSize );
+                    return ECA_TOLARGE;
+                }
             }
             else if ( pclient->proto == IPPROTO_UDP ) {
                 cas_send_dg_msg ( pclient );
@@ -294,6 +567,8 @@ int cas_copy_in_header (
         }
     }
 
+    sendBufReserve ( &pclient->send, msgSize );
+
     pMsg = (caHdr *) &pclient->send.buf[pclient->send.stk];
     pMsg->m_cmmd = htons(response);
     pMsg->m_dataType = htons(dataType);
@@ -316,7 +591,7 @@ int cas_copy_in_header (
     }
 
     /* zero out pad bytes */
-    if ( alignedPayloadSize > payloadSize ) {
+    if ( ! external && alignedPayloadSize > payloadSize ) {
         char *p = ( char * ) *ppPayload;
         memset ( p + payloadSize, '\0',
             alignedPayloadSize - payloadSize );
@@ -325,6 +600,62 @@ int cas_copy_in_header (
     return ECA_NORMAL;
 }
 
+int cas_copy_in_header (
+    struct client *pclient, ca_uint16_t response, ca_uint32_t payloadSize,
+    ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
+    ca_uint32_t responseSpecific, void **ppPayload )
+{
+    return copyInHeader ( pclient, response, payloadSize, dataType,
+        nElem, cid, responseSpecific, ppPayload, FALSE );
+}
+
+/*
+ *  cas_send_external()
+ *
+ *  Send a response whose payload goes to the socket directly from
+ *  pPayload instead of being copied into the send buffer.  The payload
+ *  must already be in network byte order, and must not change until
+ *  this returns.  Anything queued earlier is sent first, in the same
+ *  sendmsg() call where that is available.
+ *
+ *  TCP only, send lock must be on while in this routine.  Not for reactor
+ *  clients, whose sends may release the lock before pPayload is sent.
+ */
+int cas_send_external (
+    struct client *pclient, ca_uint16_t response, ca_uint32_t payloadSize,
+    ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
+    ca_uint32_t responseSpecific, const void *pPayload )
+{
+    casExtPayload ext;
+    caHdr *pMsg;
+    int status;
+
+    if ( pclient->proto != IPPROTO_TCP || pclient->reactor ) {
+        return ECA_INTERNAL;
+    }
+
+    status = copyInHeader ( pclient, response, payloadSize, dataType,
+        nElem, cid, responseSpecific, NULL, TRUE );
+    if ( status != ECA_NORMAL ) {
+        return status;
+    }
+
+    /* commit the header alone */
+    pMsg = ( caHdr * ) &pclient->send.buf[pclient->send.stk];
+    pclient->send.stk += sizeof ( caHdr );
+    if ( pMsg->m_postsize == htons ( 0xffff ) ) {
+        pclient->send.stk += 2 * sizeof ( ca_uint32_t );
+    }
+
+    ext.pData = ( const char * ) pPayload;
+    ext.dataSize = payloadSize;
+    ext.size = CA_MESSAGE_ALIGN ( payloadSize );
+    ext.sent = 0u;
+    casSendFlush ( pclient, 0u, &ext );
+
+    return ECA_NORMAL;
+}
+
 void cas_set_header_cid ( struct client *pClient, ca_uint32_t cid )
 {
     caHdr *pMsg = ( caHdr * ) &pClient->send.buf[pClient->send.stk];
@@ -106,6 +106,17 @@ static void req_server (void *pParm)
             ellAdd ( &clientQ, &pClient->node );
             UNLOCK_CLIENTQ;
 
+            if ( rsrvReactorCount ) {
+                if ( rsrv_reactor_add ( pClient ) != RSRV_OK ) {
+                    LOCK_CLIENTQ;
+                    ellDelete ( &clientQ, &pClient->node );
+                    UNLOCK_CLIENTQ;
+                    destroy_tcp_client ( pClient );
+                    epicsThreadSleep ( 15.0 );
+                }
+                continue;
+            }
+
             id = epicsThreadCreate ( "CAS-client", epicsThreadPriorityCAServerLow,
                     epicsThreadGetStackSize ( epicsThreadStackBig ),
                     camsgtask, pClient );
@@ -545,6 +556,11 @@ void rsrv_init (void)
 
     rsrv_build_addr_lists();
 
+    if ( casReactorThreads > 0 &&
+            rsrv_reactor_init ( (unsigned) casReactorThreads ) != RSRV_OK ) {
+        errlogPrintf ( "CAS: reactor unavailable, using a thread per client\n" );
+    }
+
     castcp_startStopEvent = epicsEventMustCreate(epicsEventEmpty);
     casudp_startStopEvent = epicsEventMustCreate(epicsEventEmpty);
     beacon_startStopEvent = epicsEventMustCreate(epicsEventEmpty);
@@ -554,8 +570,10 @@ void rsrv_init (void)
      * Now starting per interface
      *  TCP Listener: epicsThreadPriorityCAServerLow-2
      *  Name receiver: epicsThreadPriorityCAServerLow-4
+     *  Name search threads (optional): epicsThreadPriorityCAServerLow-4
      * Now starting global
      *  Beacon sender: epicsThreadPriorityCAServerLow-3
+     *  TCP reactors (optional): epicsThreadPriorityCAServerLow
      * Started later per TCP client
      *  TCP receiver: epicsThreadPriorityCAServerLow
      *  TCP sender : epicsThreadPriorityCAServerLow-1
@@ -615,7 +633,7 @@ void rsrv_init (void)
 
             ipAddrToDottedIP (&conf->tcpAddr.ia, ifaceName, sizeof(ifaceName));
 
-            conf->udp = conf->udpbcast = INVALID_SOCKET;
+            conf->udp = conf->udpbcast = conf->udpworker = INVALID_SOCKET;
 
             /* create and bind UDP name receiver socket(s) */
 
@@ -726,6 +744,55 @@ void rsrv_init (void)
 
             epicsEventMustWait(casudp_startStopEvent);
 
+#ifdef CAS_HAVE_RECVMMSG
+            /* additional name search threads, with their own sockets
+             * sharing the unicast port */
+            if ( casSearchThreads > 1 ) {
+                int w;
+
+                conf->wclients = callocMustSucceed ( casSearchThreads - 1,
+                    sizeof ( *conf->wclients ), "rsrv_init" );
+
+                for ( w = 1; w < casSearchThreads; w++ ) {
+                    char name[20];
+                    int yes = 1;
+
+                    conf->udpworker = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+                    if ( conf->udpworker == INVALID_SOCKET ) {
+                        errlogPrintf ( "CAS: %s ran out of udp sockets for search threads\n",
+                            ifaceName );
+                        break;
+                    }
+
+                    epicsSocketEnableAddressUseForDatagramFanout ( conf->udpworker );
+
+                    /* to tell unicast from broadcast, cf. cast_server.c */
+                    if ( setsockopt ( conf->udpworker, IPPROTO_IP, IP_PKTINFO,
+                            (char *) &yes, sizeof ( yes ) ) ||
+                        tryBind ( conf->udpworker, &conf->udpAddr,
+                            "UDP search thread socket" ) ) {
+                        errlogPrintf ( "CAS: %s unable to add search thread %d\n",
+                            ifaceName, w );
+                        epicsSocketDestroy ( conf->udpworker );
+                        conf->udpworker = INVALID_SOCKET;
+                        break;
+                    }
+
+                    conf->startworker = 1;
+
+                    epicsSnprintf ( name, sizeof ( name ), "CAS-UDP-%d", w );
+                    epicsThreadMustCreate ( name, threadPrios[4],
+                            epicsThreadGetStackSize(epicsThreadStackMedium),
+                            &cast_server, conf );
+
+                    epicsEventMustWait(casudp_startStopEvent);
+
+                    conf->startworker = 0;
+                    conf->udpworker = INVALID_SOCKET;
+                }
+            }
+#endif /* CAS_HAVE_RECVMMSG */
+
 #if !(defined(_WIN32) || defined(__CYGWIN__))
             if(conf->udpbcast != INVALID_SOCKET) {
                 conf->startbcast = 1;
@@ -867,12 +934,16 @@ static void log_one_client (struct client *client, unsigned level)
         printf(
         "\tUnprocessed request bytes = %u, Undelivered response bytes = %u\n",
             client->recv.cnt - client->recv.stk,
-            client->send.stk );
+            cas_send_pending ( client ) );
+        printf(
+        "\tResponse bytes copied within the send buffer = %llu\n",
+            (unsigned long long) client->sendBytesShuffled );
         printf(
         "\tState = %s%s%s\n",
             state[client->disconnect?1:0],
             client->send.type == mbtLargeTCP ? " jumbo-send-buf" : "",
             client->recv.type == mbtLargeTCP ? " jumbo-recv-buf" : "");
+        rsrv_udp_batch_show ( client, level );
     }
 
     if ( level >= 1u ) {
@@ -937,6 +1008,8 @@ void casr (unsigned level)
     }
     UNLOCK_CLIENTQ
 
+    rsrv_reactor_show ( level );
+
     if (level>=1) {
         rsrv_iface_config *iface = (rsrv_iface_config *) ellFirst ( &servers );
         while (iface) {
@@ -966,11 +1039,46 @@ void casr (unsigned level)
                     log_one_client(iface->bclient, level - 2);
             }
 #endif
+            if (iface->nworkers) {
+                unsigned w;
+
+                ipAddrToDottedIP (&iface->udpAddr.ia, buf, sizeof(buf));
+                printf("    %u additional CAS-UDP unicast name server%s on %s\n",
+                    iface->nworkers, iface->nworkers == 1u ? "" : "s", buf);
+                for (w = 0u; level >= 2 && w < iface->nworkers; w++)
+                    log_one_client(iface->wclients[w], level - 2);
+            }
 
             iface = (rsrv_iface_config *) ellNext(&iface->node);
         }
     }
 
+    if (level>=1) {
+        rsrv_iface_config *iface = (rsrv_iface_config *) ellFirst ( &servers );
+        unsigned long hits = 0, misses = 0;
+
+        while (iface) {
+            unsigned w;
+
+            hits += iface->client->nSearchHits;
+            misses += iface->client->nSearchMisses;
+            if (iface->bclient) {
+                hits += iface->bclient->nSearchHits;
+                misses += iface->bclient->nSearchMisses;
+            }
+            for (w = 0u; w < iface->nworkers; w++) {
+                hits += iface->wclients[w]->nSearchHits;
+                misses += iface->wclients[w]->nSearchMisses;
+            }
+            iface = (rsrv_iface_config *) ellNext(&iface->node);
+        }
+        printf("UDP name searches: %lu found, %lu for other servers",
+            hits, misses);
+        if (hits + misses)
+            printf(" (%.1f%%)", 100.0 * misses / (hits + misses));
+        printf("\n");
+    }
+
     if (level>=1) {
         osiSockAddrNode * pAddr;
         char buf[40];
@@ -1129,6 +1237,10 @@ void destroy_client ( struct client *client )
         epicsEventDestroy ( client->blockSem );
     }
 
+    if ( client->sendReleased ) {
+        epicsEventDestroy ( client->sendReleased );
+    }
+
     if ( client->pUserName ) {
         free ( client->pUserName );
     }
@@ -1261,12 +1373,14 @@ struct client * create_client ( SOCKET sock, int proto )
     client->proto = proto;
 
     client->blockSem = epicsEventCreate ( epicsEventEmpty );
+    client->sendReleased = epicsEventCreate ( epicsEventEmpty );
     client->lock = epicsMutexCreate();
     client->putNotifyLock = epicsMutexCreate();
     client->chanListLock = epicsMutexCreate();
     client->eventqLock = epicsMutexCreate();
-    if ( ! client->blockSem || ! client->lock || ! client->putNotifyLock ||
-        ! client->chanListLock || ! client->eventqLock ) {
+    if ( ! client->blockSem || ! client->sendReleased || ! client->lock ||
+        ! client->putNotifyLock || ! client->chanListLock ||
+        ! client->eventqLock ) {
         destroy_client ( client );
         return NULL;
     }
@@ -1301,6 +1415,8 @@ struct client * create_client ( SOCKET sock, int proto )
     }
     client->send.stk = 0u;
     client->send.cnt = 0u;
+    client->send.wrap = 0u;
+    client->sendBytesShuffled = 0u;
     client->recv.stk = 0u;
     client->recv.cnt = 0u;
     client->evuser = NULL;
@@ -1323,20 +1439,24 @@ void casAttachThreadToClient ( struct client *pClient )
     taskwdInsert ( pClient->tid, NULL, NULL );
 }
 
+/*
+ * Returns the number of bytes copied into the new buffer
+ */
 static
-void casExpandBuffer ( struct message_buffer *buf, ca_uint32_t size, int sendbuf )
+unsigned casExpandBuffer ( struct message_buffer *buf, ca_uint32_t size, int sendbuf )
 {
     char *newbuf = NULL;
     unsigned newsize;
+    unsigned copied = 0u;
     enum messageBufferType newtype;
 
     assert (size > MAX_TCP);
 
-    if ( size <= buf->maxstk || buf->type == mbtUDP ) return;
+    if ( size <= buf->maxstk || buf->type == mbtUDP ) return 0u;
 
     /* try to alloc new buffer */
     if (size <= MAX_TCP) {
-        return; /* shouldn't happen */
+        return 0u; /* shouldn't happen */
 
     } else if(!rsrvLargeBufFreeListTCP) {
         // round up to multiple of 4K
@@ -1361,11 +1481,21 @@ void casExpandBuffer ( struct message_buffer *buf, ca_uint32_t size, int sendbuf
     if (newbuf) {
         /* copy existing buffer */
         if (sendbuf) {
-            /* send buffer uses [0, stk) */
+            /* send buffer uses [cnt, stk) or [cnt, wrap) and [0, stk) */
             if (!rsrvLargeBufFreeListTCP && buf->type==mbtLargeTCP) {
-                /* realloc already copied */
+                /* realloc already copied, and the ring is still valid */
             } else {
-                memcpy ( newbuf, buf->buf, buf->stk );
+                unsigned first = ( buf->wrap ? buf->wrap : buf->stk ) - buf->cnt;
+
+                memcpy ( newbuf, &buf->buf[buf->cnt], first );
+                copied = first;
+                if ( buf->wrap ) {
+                    memcpy ( &newbuf[first], buf->buf, buf->stk );
+                    copied += buf->stk;
+                }
+                buf->stk = copied;
+                buf->cnt = 0u;
+                buf->wrap = 0u;
             }
         } else {
             /* recv buffer uses [stk, cnt) */
@@ -1375,6 +1505,7 @@ void casExpandBuffer ( struct message_buffer *buf, ca_uint32_t size, int sendbuf
 
             /* buf->buf may be the same as newbuf if realloc() used */
             memmove ( newbuf, &buf->buf[buf->stk], used );
+            copied = used;
 
             buf->cnt = used;
             buf->stk = 0;
@@ -1394,11 +1525,13 @@ void casExpandBuffer ( struct message_buffer *buf, ca_uint32_t size, int sendbuf
         buf->type = newtype;
         buf->maxstk = newsize;
     }
+
+    return copied;
 }
 
 void casExpandSendBuffer ( struct client *pClient, ca_uint32_t size )
 {
-    casExpandBuffer (&pClient->send, size, 1);
+    pClient->sendBytesShuffled += casExpandBuffer (&pClient->send, size, 1);
 }
 
 void casExpandRecvBuffer ( struct client *pClient, ca_uint32_t size )
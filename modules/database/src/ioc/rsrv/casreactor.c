@@ -0,0 +1,453 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Event driven CA server circuits.
+ *
+ *  Instead of spawning one camsgtask() thread per TCP client, the
+ *  client sockets are shared out between a small fixed pool of
+ *  reactor threads.  Each reactor waits for readiness on all of its
+ *  sockets and then runs the same receive, camessage() and
+ *  cas_send_bs_msg() sequence that camsgtask() would.
+ *
+ *  Each client is registered with exactly one reactor, so the receive
+ *  buffer is still only ever touched by a single thread.
+ *
+ *  A reactor never waits for one of its clients.  Their sockets are
+ *  non-blocking, and whatever a socket won't take is left in the send
+ *  buffer until epoll() reports it writable.  Before each request the
+ *  reactor reserves room for its replies, see cas_send_reserve(), and
+ *  stops reading from a client which hasn't got that much room.  The
+ *  client's event task waits for its socket without SEND_LOCK().  A
+ *  client which runs out of network buffers is set aside for a while.
+ *
+ *  Only implemented where epoll() is available, elsewhere
+ *  rsrv_reactor_init() fails and rsrv falls back to a thread per client.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __linux__
+#   include <unistd.h>
+#   include <poll.h>
+#   include <sys/epoll.h>
+#   define CAS_HAVE_EPOLL
+#endif
+
+#include "dbDefs.h"
+#include "ellLib.h"
+#include "epicsSignal.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "errlog.h"
+#include "osiSock.h"
+#include "taskwd.h"
+#include "cantProceed.h"
+
+#include "rsrv.h"
+#include "server.h"
+
+#ifdef CAS_HAVE_EPOLL
+
+#define REACTOR_MAX_EVENTS 64
+
+/* how long a client out of network buffers is set aside */
+#define REACTOR_RETRY_DELAY 15.0
+
+typedef struct rsrv_reactor {
+    epicsThreadId       tid;
+    int                 epfd;
+    unsigned            nclients;   /* locked by clientQlock */
+    unsigned long       nwakeups;   /* written by reactor thread only */
+    unsigned long       nevents;    /* written by reactor thread only */
+    ELLLIST             deferred;   /* reactor thread only, oldest first */
+} rsrv_reactor;
+
+static rsrv_reactor *reactors;
+
+/*
+ * reactorService()
+ *
+ * Returns RSRV_ERROR when the circuit should be shut down.
+ */
+static int reactorService ( struct client *client, unsigned events )
+{
+    osiSockIoctl_t check_nchars;
+    int status;
+
+    if ( castcp_ctl != ctlRun || client->disconnect ||
+            ( events & ( EPOLLERR | EPOLLHUP ) ) ) {
+        return RSRV_ERROR;
+    }
+
+    if ( events & EPOLLOUT ) {
+        /* as much as the socket will take */
+        cas_send_bs_msg ( client, TRUE );
+    }
+
+    if ( client->recvStalled ) {
+        /* the requests left over by camessage(), if there is room now */
+        if ( ! ( events & EPOLLOUT ) ) {
+            return RSRV_OK;
+        }
+        client->recvStalled = FALSE;
+        status = casClientProcess ( client );
+    }
+    else if ( events & ( EPOLLIN | EPOLLRDHUP ) ) {
+        status = casClientRecv ( client );
+    }
+    else {
+        return RSRV_OK;
+    }
+    if ( status != RSRV_OK || client->disconnect ) {
+        return RSRV_ERROR;
+    }
+
+    /*
+     * allow message to batch up if more are coming, the
+     * socket remains readable so we will be back shortly
+     */
+    status = socket_ioctl ( client->sock, FIONREAD, &check_nchars );
+    if ( status < 0 || check_nchars == 0 || client->recvStalled ) {
+        cas_send_bs_msg ( client, TRUE );
+    }
+
+    return RSRV_OK;
+}
+
+/*
+ * reactorArm()
+ *
+ * Wait for the socket to be readable unless the client has stalled, and
+ * for it to be writable while there is something left to send
+ */
+static void reactorArm ( rsrv_reactor *pReactor, struct client *client )
+{
+    struct epoll_event ev;
+    unsigned events = 0u;
+
+    if ( ! client->reactorRetry ) {
+        unsigned pending;
+
+        SEND_LOCK ( client );
+        pending = cas_send_pending ( client );
+        SEND_UNLOCK ( client );
+
+        if ( ! client->recvStalled ) {
+            events |= EPOLLIN | EPOLLRDHUP;
+        }
+        if ( pending || client->recvStalled ) {
+            events |= EPOLLOUT;
+        }
+    }
+    if ( events == client->reactorEvents ) {
+        return;
+    }
+
+    memset ( &ev, 0, sizeof ( ev ) );
+    ev.events = events;
+    ev.data.ptr = client;
+    if ( epoll_ctl ( pReactor->epfd, EPOLL_CTL_MOD, client->sock, &ev ) ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: epoll_ctl " ERL_ERROR ": %s\n",
+            sockErrBuf );
+        return;
+    }
+    client->reactorEvents = events;
+}
+
+/*
+ * reactorDefer()
+ *
+ * Set aside a client which is out of network buffers, instead of
+ * sleeping as camsgtask() does.  Only errors are reported until
+ * reactorResume() takes it back.
+ */
+static void reactorDefer ( rsrv_reactor *pReactor, struct client *client )
+{
+    epicsTimeGetCurrent ( &client->reactorResume );
+    epicsTimeAddSeconds ( &client->reactorResume, REACTOR_RETRY_DELAY );
+    ellAdd ( &pReactor->deferred, &client->reactorNode );
+    reactorArm ( pReactor, client );
+}
+
+/*
+ * reactorResume()
+ *
+ * Takes back the deferred clients which are due, and returns the
+ * epoll_wait() timeout until the next one is
+ */
+static int reactorResume ( rsrv_reactor *pReactor )
+{
+    struct client *client;
+
+    while ( ( client = (struct client *) ellFirst ( &pReactor->deferred ) ) ) {
+        epicsTimeStamp now;
+        double delay;
+
+        epicsTimeGetCurrent ( &now );
+        delay = epicsTimeDiffInSeconds ( &client->reactorResume, &now );
+        if ( delay > 0.0 ) {
+            return (int) ( delay * 1000.0 ) + 1;
+        }
+        ellDelete ( &pReactor->deferred, &client->reactorNode );
+        client->reactorRetry = FALSE;
+        reactorArm ( pReactor, client );
+    }
+
+    return -1;
+}
+
+static void reactorRemove ( rsrv_reactor *pReactor, struct client *client )
+{
+    if ( client->sock != INVALID_SOCKET ) {
+        epoll_ctl ( pReactor->epfd, EPOLL_CTL_DEL, client->sock, NULL );
+    }
+    if ( client->reactorRetry ) {
+        ellDelete ( &pReactor->deferred, &client->reactorNode );
+    }
+
+    LOCK_CLIENTQ;
+    ellDelete ( &clientQ, &client->node );
+    pReactor->nclients--;
+    UNLOCK_CLIENTQ;
+
+    destroy_tcp_client ( client );
+}
+
+static void reactorTask ( void *pParm )
+{
+    rsrv_reactor *pReactor = (rsrv_reactor *) pParm;
+    struct epoll_event events[REACTOR_MAX_EVENTS];
+
+    epicsSignalInstallSigAlarmIgnore ();
+    epicsSignalInstallSigPipeIgnore ();
+    taskwdInsert ( epicsThreadGetIdSelf (), NULL, NULL );
+
+    while ( TRUE ) {
+        int i, nevents;
+
+        nevents = epoll_wait ( pReactor->epfd, events,
+            NELEMENTS ( events ), reactorResume ( pReactor ) );
+        if ( nevents < 0 ) {
+            char sockErrBuf[64];
+
+            if ( errno == EINTR ) {
+                continue;
+            }
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            errlogPrintf ( "CAS: epoll_wait " ERL_ERROR ": %s\n",
+                sockErrBuf );
+            epicsThreadSleep ( 1.0 );
+            continue;
+        }
+
+        pReactor->nwakeups++;
+        pReactor->nevents += nevents;
+
+        for ( i = 0; i < nevents; i++ ) {
+            struct client *client = (struct client *) events[i].data.ptr;
+            int deferred = client->reactorRetry;
+            int status;
+
+            epicsThreadPrivateSet ( rsrvCurrentClient, client );
+            status = reactorService ( client, events[i].events );
+            epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
+
+            if ( status != RSRV_OK ) {
+                reactorRemove ( pReactor, client );
+            }
+            else if ( client->reactorRetry && ! deferred ) {
+                reactorDefer ( pReactor, client );
+            }
+            else {
+                reactorArm ( pReactor, client );
+            }
+        }
+    }
+}
+
+int rsrv_reactor_init ( unsigned nThreads )
+{
+    unsigned i;
+
+    if ( nThreads == 0u ) {
+        return RSRV_ERROR;
+    }
+
+    reactors = callocMustSucceed ( nThreads, sizeof ( *reactors ),
+        "rsrv_reactor_init" );
+
+    for ( i = 0u; i < nThreads; i++ ) {
+        char name[20];
+
+        ellInit ( &reactors[i].deferred );
+        reactors[i].epfd = epoll_create1 ( EPOLL_CLOEXEC );
+        if ( reactors[i].epfd < 0 ) {
+            char sockErrBuf[64];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            errlogPrintf ( "CAS: epoll_create " ERL_ERROR ": %s\n",
+                sockErrBuf );
+            break;
+        }
+
+        epicsSnprintf ( name, sizeof ( name ), "CAS-reactor%u", i );
+        reactors[i].tid = epicsThreadCreate ( name,
+            epicsThreadPriorityCAServerLow,
+            epicsThreadGetStackSize ( epicsThreadStackBig ),
+            reactorTask, &reactors[i] );
+        if ( ! reactors[i].tid ) {
+            errlogPrintf ( "CAS: reactor thread creation failed\n" );
+            close ( reactors[i].epfd );
+            break;
+        }
+    }
+
+    /* keep any reactors which did start */
+    rsrvReactorCount = i;
+
+    return i ? RSRV_OK : RSRV_ERROR;
+}
+
+int rsrv_reactor_add ( struct client *client )
+{
+    rsrv_reactor *pReactor;
+    struct epoll_event ev;
+    osiSockIoctl_t yes = TRUE;
+    unsigned i;
+
+    assert ( rsrvReactorCount > 0u );
+
+    /* least loaded reactor */
+    LOCK_CLIENTQ;
+    pReactor = &reactors[0];
+    for ( i = 1u; i < rsrvReactorCount; i++ ) {
+        if ( reactors[i].nclients < pReactor->nclients ) {
+            pReactor = &reactors[i];
+        }
+    }
+    pReactor->nclients++;
+    UNLOCK_CLIENTQ;
+
+    /* the event task may already be sending, and must know first */
+    client->reactor = pReactor;
+    if ( socket_ioctl ( client->sock, FIONBIO, &yes ) < 0 ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: FIONBIO " ERL_ERROR ": %s\n",
+            sockErrBuf );
+        goto fail;
+    }
+
+    /* the client may be serviced, even destroyed, as soon as this returns */
+    memset ( &ev, 0, sizeof ( ev ) );
+    ev.events = client->reactorEvents = EPOLLIN | EPOLLRDHUP;
+    ev.data.ptr = client;
+    if ( epoll_ctl ( pReactor->epfd, EPOLL_CTL_ADD, client->sock, &ev ) ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: epoll_ctl " ERL_ERROR ": %s\n",
+            sockErrBuf );
+        goto fail;
+    }
+
+    return RSRV_OK;
+
+fail:
+    LOCK_CLIENTQ;
+    pReactor->nclients--;
+    UNLOCK_CLIENTQ;
+    return RSRV_ERROR;
+}
+
+int rsrv_reactor_is_self ( const struct client *client )
+{
+    return client->reactor &&
+        client->reactor->tid == epicsThreadGetIdSelf ();
+}
+
+/*
+ * rsrv_reactor_wait_send()
+ *
+ * Wait a while for a reactor client's socket to become writable, without
+ * SEND_LOCK(), which the caller holds
+ */
+void rsrv_reactor_wait_send ( struct client *client )
+{
+    struct pollfd pfd;
+
+    pfd.fd = client->sock;
+    pfd.events = POLLOUT;
+    pfd.revents = 0;
+
+    SEND_UNLOCK ( client );
+    poll ( &pfd, 1, 1000 );
+    SEND_LOCK ( client );
+}
+
+void rsrv_reactor_show ( unsigned level )
+{
+    unsigned i;
+
+    if ( ! rsrvReactorCount ) {
+        return;
+    }
+
+    printf ( "CAS-TCP circuits served by %u reactor thread%s\n",
+        rsrvReactorCount, rsrvReactorCount == 1u ? "" : "s" );
+
+    if ( level < 2u ) {
+        return;
+    }
+
+    LOCK_CLIENTQ;
+    for ( i = 0u; i < rsrvReactorCount; i++ ) {
+        printf ( "    reactor %u: %u client%s, %lu wakeups, %lu events\n",
+            i, reactors[i].nclients, reactors[i].nclients == 1u ? "" : "s",
+            reactors[i].nwakeups, reactors[i].nevents );
+    }
+    UNLOCK_CLIENTQ;
+}
+
+#else /* CAS_HAVE_EPOLL */
+
+int rsrv_reactor_init ( unsigned nThreads )
+{
+    errlogPrintf ( "CAS: reactor mode is not supported on this target\n" );
+    return RSRV_ERROR;
+}
+
+int rsrv_reactor_add ( struct client *client )
+{
+    return RSRV_ERROR;
+}
+
+int rsrv_reactor_is_self ( const struct client *client )
+{
+    return FALSE;
+}
+
+void rsrv_reactor_wait_send ( struct client *client )
+{
+}
+
+void rsrv_reactor_show ( unsigned level )
+{
+}
+
+#endif /* CAS_HAVE_EPOLL */
@@ -45,6 +45,7 @@
 #include "freeList.h"
 #include "osiSock.h"
 #include "taskwd.h"
+#include "cantProceed.h"
 
 #include "rsrv.h"
 #include "server.h"
@@ -104,6 +105,442 @@ static void clean_addrq(struct client *client)
     }
 }
 
+/*
+ * castIgnore()
+ *
+ * TRUE if datagrams from this address are to be ignored
+ */
+static int castIgnore ( const struct sockaddr_in *addr )
+{
+    size_t idx;
+
+    for ( idx = 0; casIgnoreAddrs[idx]; idx++ ) {
+        if ( addr->sin_addr.s_addr == casIgnoreAddrs[idx] ) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/*
+ * castMessage()
+ *
+ * process one datagram of len bytes from addr, which has already
+ * been received into client->recv.buf at offset
+ */
+static void castMessage ( struct client *client,
+    const struct sockaddr_in *addr, unsigned offset, unsigned len )
+{
+    int status;
+    int count = 0;
+
+    client->recv.cnt = offset + len;
+    client->recv.stk = offset;
+    epicsTimeGetCurrent(&client->time_at_last_recv);
+
+    client->minor_version_number = CA_UKN_MINOR_VERSION;
+    client->seqNoOfReq = 0;
+
+    /*
+     * If we are talking to a new client flush to the old one
+     * in case we are holding UDP messages waiting to
+     * see if the next message is for this same client.
+     */
+    if (client->send.stk>sizeof(caHdr)) {
+        status = memcmp(&client->addr, addr, sizeof(*addr));
+        if(status){
+            /*
+             * if the address is different
+             */
+            cas_send_dg_msg(client);
+            client->addr = *addr;
+        }
+    }
+    else {
+        client->addr = *addr;
+    }
+
+    if (CASDEBUG>1) {
+        char    buf[40];
+
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+        errlogPrintf ("CAS: cast server msg of %u bytes from addr %s\n",
+            len, buf);
+    }
+
+    if (CASDEBUG>2)
+        count = ellCount (&client->chanList);
+
+    status = camessage ( client );
+    if(status == RSRV_OK){
+        if(client->recv.cnt !=
+            client->recv.stk){
+            char buf[40];
+
+            ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+
+            epicsPrintf ("CAS: partial (damaged?) UDP msg of %d bytes from %s ?\n",
+                client->recv.cnt - client->recv.stk, buf);
+
+            epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
+                &client->time_at_last_recv);
+            epicsPrintf ("CAS: message received at %s\n", buf);
+        }
+    }
+    else if (CASDEBUG>0){
+        char buf[40];
+
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+
+        epicsPrintf ("CAS: invalid (damaged?) UDP request from %s ?\n", buf);
+
+        epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
+            &client->time_at_last_recv);
+        epicsPrintf ("CAS: message received at %s\n", buf);
+    }
+
+    if (CASDEBUG>2) {
+        if ( ellCount (&client->chanList) ) {
+            errlogPrintf ("CAS: Fnd %d name matches (%d tot)\n",
+                ellCount(&client->chanList)-count,
+                ellCount(&client->chanList));
+        }
+    }
+}
+
+#ifdef CAS_HAVE_RECVMMSG
+
+/*
+ *  Batched name service.
+ *
+ *  Up to nslots datagrams are received with each recvmmsg() call, into
+ *  equal slices of client::recv, and the datagrams from each peer are
+ *  handled together so that their replies share datagrams.  Replies are
+ *  queued by cas_send_dg_msg() and sent with one sendmmsg() call at the
+ *  end of each batch.
+ *
+ *  Additional search threads (casSearchThreads) each own a socket bound
+ *  to the same unicast address, and the kernel spreads unicast requests
+ *  between these by peer address (SO_REUSEPORT).  Broadcast and multicast
+ *  datagrams are delivered to every socket, so these threads ignore
+ *  anything not sent to a unicast address (IP_PKTINFO) and leave it to
+ *  the first thread.
+ */
+typedef struct rsrv_udp_batch {
+    unsigned            nslots;
+    unsigned            slotSize;       /* bytes of client::recv per slot */
+    unsigned            nout;           /* replies queued */
+    int                 unicastOnly;
+    struct mmsghdr      *in, *out;
+    struct iovec        *iovin, *iovout;
+    struct sockaddr_in  *addrin, *addrout;
+    char                *cmsgin;
+    char                *bufout;
+    char                *done;
+    /* written by the owning thread only */
+    unsigned long       nrecvcalls, nrecv, nsendcalls, nsend;
+    unsigned long       nskipped, ntruncated;
+} rsrv_udp_batch;
+
+#define CAS_PKTINFO_SPACE CMSG_SPACE ( sizeof ( struct in_pktinfo ) )
+
+static rsrv_udp_batch * castBatchCreate ( struct client *client,
+    unsigned nslots, int unicastOnly )
+{
+    rsrv_udp_batch *pBatch;
+    unsigned i;
+
+    /* keep each slot large enough for an ethernet frame */
+    if ( nslots > client->recv.maxstk / ETHERNET_MAX_UDP ) {
+        nslots = client->recv.maxstk / ETHERNET_MAX_UDP;
+    }
+    if ( nslots == 0u ) {
+        nslots = 1u;
+    }
+
+    pBatch = callocMustSucceed ( 1, sizeof ( *pBatch ), "castBatchCreate" );
+    pBatch->nslots = nslots;
+    pBatch->slotSize = client->recv.maxstk / nslots;
+    pBatch->unicastOnly = unicastOnly;
+    pBatch->in = callocMustSucceed ( nslots, sizeof ( *pBatch->in ),
+        "castBatchCreate" );
+    pBatch->out = callocMustSucceed ( nslots, sizeof ( *pBatch->out ),
+        "castBatchCreate" );
+    pBatch->iovin = callocMustSucceed ( nslots, sizeof ( *pBatch->iovin ),
+        "castBatchCreate" );
+    pBatch->iovout = callocMustSucceed ( nslots, sizeof ( *pBatch->iovout ),
+        "castBatchCreate" );
+    pBatch->addrin = callocMustSucceed ( nslots, sizeof ( *pBatch->addrin ),
+        "castBatchCreate" );
+    pBatch->addrout = callocMustSucceed ( nslots, sizeof ( *pBatch->addrout ),
+        "castBatchCreate" );
+    pBatch->cmsgin = callocMustSucceed ( nslots, CAS_PKTINFO_SPACE,
+        "castBatchCreate" );
+    pBatch->bufout = callocMustSucceed ( nslots, client->send.maxstk,
+        "castBatchCreate" );
+    pBatch->done = callocMustSucceed ( nslots, 1, "castBatchCreate" );
+
+    for ( i = 0u; i < nslots; i++ ) {
+        struct msghdr *pHdr = &pBatch->out[i].msg_hdr;
+
+        pBatch->iovout[i].iov_base = &pBatch->bufout[i * client->send.maxstk];
+        pHdr->msg_name = &pBatch->addrout[i];
+        pHdr->msg_namelen = sizeof ( pBatch->addrout[i] );
+        pHdr->msg_iov = &pBatch->iovout[i];
+        pHdr->msg_iovlen = 1;
+    }
+
+    return pBatch;
+}
+
+static void castBatchDestroy ( rsrv_udp_batch *pBatch )
+{
+    if ( ! pBatch ) {
+        return;
+    }
+    free ( pBatch->in );
+    free ( pBatch->out );
+    free ( pBatch->iovin );
+    free ( pBatch->iovout );
+    free ( pBatch->addrin );
+    free ( pBatch->addrout );
+    free ( pBatch->cmsgin );
+    free ( pBatch->bufout );
+    free ( pBatch->done );
+    free ( pBatch );
+}
+
+/*
+ * castBatchFlush()
+ *
+ * send all queued replies, caller holds SEND_LOCK
+ */
+static void castBatchFlush ( struct client *client )
+{
+    rsrv_udp_batch *pBatch = client->udpBatch;
+    unsigned sent = 0u;
+
+    while ( sent < pBatch->nout ) {
+        int status = sendmmsg ( client->sock, &pBatch->out[sent],
+            pBatch->nout - sent, 0 );
+        if ( status > 0 ) {
+            pBatch->nsendcalls++;
+            pBatch->nsend += (unsigned) status;
+            sent += (unsigned) status;
+        }
+        else if ( status < 0 && SOCKERRNO == SOCK_EINTR ) {
+            continue;
+        }
+        else {
+            char sockErrBuf[64];
+            char buf[40];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            ipAddrToDottedIP ( &pBatch->addrout[sent], buf, sizeof(buf) );
+            errlogPrintf( "CAS: UDP send to %s failed: %s\n",
+                buf, sockErrBuf);
+            /* skip the one which failed */
+            sent++;
+        }
+    }
+
+    if ( sent ) {
+        epicsTimeGetCurrent ( &client->time_at_last_send );
+    }
+    pBatch->nout = 0u;
+}
+
+/*
+ * cas_batch_dg_msg()
+ *
+ * queue a reply datagram, caller holds SEND_LOCK
+ */
+void cas_batch_dg_msg ( struct client *pclient, const char *pDG,
+    unsigned sizeDG )
+{
+    rsrv_udp_batch *pBatch = pclient->udpBatch;
+    unsigned i;
+
+    assert ( sizeDG <= pclient->send.maxstk );
+
+    if ( pBatch->nout >= pBatch->nslots ) {
+        castBatchFlush ( pclient );
+    }
+
+    i = pBatch->nout++;
+    memcpy ( pBatch->iovout[i].iov_base, pDG, sizeDG );
+    pBatch->iovout[i].iov_len = sizeDG;
+    pBatch->addrout[i] = pclient->addr;
+}
+
+/*
+ * castBatchAccept()
+ *
+ * FALSE if the datagram in slot i is to be ignored
+ */
+static int castBatchAccept ( rsrv_udp_batch *pBatch, unsigned i )
+{
+    struct msghdr *pHdr = &pBatch->in[i].msg_hdr;
+
+    if ( pHdr->msg_flags & MSG_TRUNC ) {
+        pBatch->ntruncated++;
+        if ( CASDEBUG > 0 ) {
+            char buf[40];
+            ipAddrToDottedIP ( &pBatch->addrin[i], buf, sizeof(buf) );
+            errlogPrintf ( "CAS: UDP msg from %s longer than %u bytes ignored\n",
+                buf, pBatch->slotSize );
+        }
+        return FALSE;
+    }
+
+    if ( casudp_ctl != ctlRun || castIgnore ( &pBatch->addrin[i] ) ) {
+        return FALSE;
+    }
+
+    if ( pBatch->unicastOnly ) {
+        struct cmsghdr *pCmsg;
+
+        for ( pCmsg = CMSG_FIRSTHDR ( pHdr ); pCmsg;
+                pCmsg = CMSG_NXTHDR ( pHdr, pCmsg ) ) {
+            if ( pCmsg->cmsg_level == IPPROTO_IP &&
+                    pCmsg->cmsg_type == IP_PKTINFO ) {
+                struct in_pktinfo info;
+
+                memcpy ( &info, CMSG_DATA ( pCmsg ), sizeof ( info ) );
+                /* for broadcasts and multicasts the local address
+                 * differs from the destination */
+                if ( info.ipi_addr.s_addr != info.ipi_spec_dst.s_addr ) {
+                    pBatch->nskipped++;
+                    return FALSE;
+                }
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+/*
+ * castBatchLoop()
+ *
+ * does not return
+ */
+static void castBatchLoop ( struct client *client, SOCKET recv_sock )
+{
+    rsrv_udp_batch *pBatch = client->udpBatch;
+
+    while ( TRUE ) {
+        unsigned i, j, n;
+        int status;
+
+        for ( i = 0u; i < pBatch->nslots; i++ ) {
+            struct msghdr *pHdr = &pBatch->in[i].msg_hdr;
+
+            pBatch->iovin[i].iov_base =
+                &client->recv.buf[i * pBatch->slotSize];
+            pBatch->iovin[i].iov_len = pBatch->slotSize;
+            pHdr->msg_name = &pBatch->addrin[i];
+            pHdr->msg_namelen = sizeof ( pBatch->addrin[i] );
+            pHdr->msg_iov = &pBatch->iovin[i];
+            pHdr->msg_iovlen = 1;
+            if ( pBatch->unicastOnly ) {
+                pHdr->msg_control = &pBatch->cmsgin[i * CAS_PKTINFO_SPACE];
+                pHdr->msg_controllen = CAS_PKTINFO_SPACE;
+            }
+            else {
+                pHdr->msg_control = NULL;
+                pHdr->msg_controllen = 0;
+            }
+            pHdr->msg_flags = 0;
+        }
+
+        /* block for the first datagram only */
+        status = recvmmsg ( recv_sock, pBatch->in, pBatch->nslots,
+            MSG_WAITFORONE, NULL );
+        if ( status < 0 ) {
+            if (SOCKERRNO != SOCK_EINTR) {
+                char sockErrBuf[64];
+                epicsSocketConvertErrnoToString (
+                    sockErrBuf, sizeof ( sockErrBuf ) );
+                epicsPrintf ("CAS: UDP recv error: %s\n",
+                        sockErrBuf);
+                epicsThreadSleep(1.0);
+            }
+            continue;
+        }
+        n = (unsigned) status;
+        pBatch->nrecvcalls++;
+        pBatch->nrecv += n;
+
+        for ( i = 0u; i < n; i++ ) {
+            pBatch->done[i] = ! castBatchAccept ( pBatch, i );
+        }
+
+        /*
+         * handle all datagrams from one peer together so that the
+         * replies are combined
+         */
+        for ( i = 0u; i < n; i++ ) {
+            if ( pBatch->done[i] ) {
+                continue;
+            }
+            for ( j = i; j < n; j++ ) {
+                if ( pBatch->done[j] ||
+                        pBatch->addrin[j].sin_addr.s_addr !=
+                            pBatch->addrin[i].sin_addr.s_addr ||
+                        pBatch->addrin[j].sin_port !=
+                            pBatch->addrin[i].sin_port ) {
+                    continue;
+                }
+                pBatch->done[j] = 1;
+                castMessage ( client, &pBatch->addrin[j],
+                    j * pBatch->slotSize, pBatch->in[j].msg_len );
+            }
+        }
+
+        SEND_LOCK ( client );
+        cas_send_dg_msg ( client );
+        castBatchFlush ( client );
+        SEND_UNLOCK ( client );
+
+        /* fewer than requested, so the socket has been drained */
+        if ( n < pBatch->nslots ) {
+            clean_addrq ( client );
+        }
+    }
+}
+
+void rsrv_udp_batch_show ( const struct client *client, unsigned level )
+{
+    const rsrv_udp_batch *pBatch = client->udpBatch;
+
+    if ( ! pBatch ) {
+        return;
+    }
+
+    printf ( "\tBatched name service, up to %u datagrams of %u bytes%s\n",
+        pBatch->nslots, pBatch->slotSize,
+        pBatch->unicastOnly ? ", unicast only" : "" );
+    printf ( "\t%lu datagrams received in %lu calls, %lu sent in %lu calls\n",
+        pBatch->nrecv, pBatch->nrecvcalls,
+        pBatch->nsend, pBatch->nsendcalls );
+    printf ( "\t%lu broadcasts left to the first thread, %lu too long\n",
+        pBatch->nskipped, pBatch->ntruncated );
+}
+
+#else /* CAS_HAVE_RECVMMSG */
+
+void cas_batch_dg_msg ( struct client *pclient, const char *pDG,
+    unsigned sizeDG )
+{
+}
+
+void rsrv_udp_batch_show ( const struct client *client, unsigned level )
+{
+}
+
+#endif /* CAS_HAVE_RECVMMSG */
+
 /*
  * CAST_SERVER
  *
@@ -114,8 +551,8 @@ void cast_server(void *pParm)
 {
     rsrv_iface_config *conf = pParm;
     int                 status;
-    int                 count=0;
     int                 mysocket=0;
+    int                 worker = conf->startworker;
     struct sockaddr_in  new_recv_addr;
     osiSocklen_t        recv_addr_size;
     osiSockIoctl_t      nchars;
@@ -124,7 +561,7 @@ void cast_server(void *pParm)
 
     recv_addr_size = sizeof(new_recv_addr);
 
-    reply_sock = conf->udp;
+    reply_sock = worker ? conf->udpworker : conf->udp;
 
     /*
      * setup new client structure but reuse old structure if
@@ -138,7 +575,11 @@ void cast_server(void *pParm)
         }
         epicsThreadSleep(300.0);
     }
-    if (conf->startbcast) {
+    if (worker) {
+        recv_sock = conf->udpworker;
+        conf->wclients[conf->nworkers++] = client;
+    }
+    else if (conf->startbcast) {
         recv_sock = conf->udpbcast;
         conf->bclient = client;
     }
@@ -150,6 +591,13 @@ void cast_server(void *pParm)
 
     casAttachThreadToClient ( client );
 
+#ifdef CAS_HAVE_RECVMMSG
+    if ( casSearchBatch > 1 || worker ) {
+        client->udpBatch = castBatchCreate ( client,
+            casSearchBatch > 1 ? (unsigned) casSearchBatch : 1u, worker );
+    }
+#endif
+
     /*
      * add placeholder for the first version message should it be needed
      */
@@ -160,6 +608,12 @@ void cast_server(void *pParm)
 
     epicsEventSignal(casudp_startStopEvent);
 
+#ifdef CAS_HAVE_RECVMMSG
+    if ( client->udpBatch ) {
+        castBatchLoop ( client, recv_sock );
+    }
+#endif
+
     while (TRUE) {
         status = recvfrom (
             recv_sock,
@@ -178,91 +632,12 @@ void cast_server(void *pParm)
                 epicsThreadSleep(1.0);
             }
 
-        } else {
-            size_t idx;
-            for(idx=0; casIgnoreAddrs[idx]; idx++)
-            {
-                if(new_recv_addr.sin_addr.s_addr==casIgnoreAddrs[idx]) {
-                    status = -1; /* ignore */
-                    break;
-                }
-            }
+        } else if (castIgnore(&new_recv_addr)) {
+            status = -1; /* ignore */
         }
 
         if (status >= 0 && casudp_ctl == ctlRun) {
-            client->recv.cnt = (unsigned) status;
-            client->recv.stk = 0ul;
-            epicsTimeGetCurrent(&client->time_at_last_recv);
-
-            client->minor_version_number = CA_UKN_MINOR_VERSION;
-            client->seqNoOfReq = 0;
-
-            /*
-             * If we are talking to a new client flush to the old one
-             * in case we are holding UDP messages waiting to
-             * see if the next message is for this same client.
-             */
-            if (client->send.stk>sizeof(caHdr)) {
-                status = memcmp(&client->addr,
-                    &new_recv_addr, recv_addr_size);
-                if(status){
-                    /*
-                     * if the address is different
-                     */
-                    cas_send_dg_msg(client);
-                    client->addr = new_recv_addr;
-                }
-            }
-            else {
-                client->addr = new_recv_addr;
-            }
-
-            if (CASDEBUG>1) {
-                char    buf[40];
-
-                ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-                errlogPrintf ("CAS: cast server msg of %d bytes from addr %s\n",
-                    client->recv.cnt, buf);
-            }
-
-            if (CASDEBUG>2)
-                count = ellCount (&client->chanList);
-
-            status = camessage ( client );
-            if(status == RSRV_OK){
-                if(client->recv.cnt !=
-                    client->recv.stk){
-                    char buf[40];
-
-                    ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-
-                    epicsPrintf ("CAS: partial (damaged?) UDP msg of %d bytes from %s ?\n",
-                        client->recv.cnt - client->recv.stk, buf);
-
-                    epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
-                        &client->time_at_last_recv);
-                    epicsPrintf ("CAS: message received at %s\n", buf);
-                }
-            }
-            else if (CASDEBUG>0){
-                char buf[40];
-
-                ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-
-                epicsPrintf ("CAS: invalid (damaged?) UDP request from %s ?\n", buf);
-
-                epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
-                    &client->time_at_last_recv);
-                epicsPrintf ("CAS: message received at %s\n", buf);
-            }
-
-            if (CASDEBUG>2) {
-                if ( ellCount (&client->chanList) ) {
-                    errlogPrintf ("CAS: Fnd %d name matches (%d tot)\n",
-                        ellCount(&client->chanList)-count,
-                        ellCount(&client->chanList));
-                }
-            }
+            castMessage ( client, &new_recv_addr, 0u, (unsigned) status );
         }
 
         /*
@@ -283,6 +658,10 @@ void cast_server(void *pParm)
 
     /* ATM never reached, just a placeholder */
 
+#ifdef CAS_HAVE_RECVMMSG
+    castBatchDestroy ( client->udpBatch );
+    client->udpBatch = NULL;
+#endif
     if(!mysocket)
         client->sock = INVALID_SOCKET; /* only one cast_server should destroy the reply socket */
     destroy_client(client);
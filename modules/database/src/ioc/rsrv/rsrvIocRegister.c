@@ -38,4 +38,8 @@ void rsrvRegistrar(void)
 }
 
 epicsExportAddress(int, CASDEBUG);
+epicsExportAddress(int, casReactorThreads);
+epicsExportAddress(int, casZeroCopyMinBytes);
+epicsExportAddress(int, casSearchBatch);
+epicsExportAddress(int, casSearchThreads);
 epicsExportRegistrar(rsrvRegistrar);
@@ -61,6 +61,9 @@ struct message_buffer {
   /*! points to first unused byte in buffer (after filled bytes) */
   unsigned                  cnt;
   enum messageBufferType    type;
+  /*! TCP send only, end of the older unsent bytes when the ring has
+   *  wrapped, zero otherwise.  cf. cas_send_pending() */
+  unsigned                  wrap;
 };
 
 extern epicsThreadPrivateId rsrvCurrentClient;
@@ -92,6 +95,20 @@ typedef struct client {
   ca_uint32_t           seqNoOfReq; /* for udp  */
   unsigned              recvBytesToDrain;
   unsigned              priority;
+  epicsUInt64           sendBytesShuffled; /* copied within send buffer */
+  struct rsrv_udp_batch *udpBatch; /* UDP only, cf. cast_server.c */
+  unsigned long         nSearchHits, nSearchMisses; /* UDP only */
+  /*! TCP reactor mode only, cf. casreactor.c.  Set before the socket is
+   *  made non-blocking, the others are only used by the reactor thread */
+  struct rsrv_reactor   *reactor;
+  unsigned              reactorEvents; /* as registered with epoll */
+  ELLNODE               reactorNode; /* while deferred */
+  epicsTimeStamp        reactorResume; /* while deferred */
+  /*! guarded by SEND_LOCK(), room kept for the reactor thread's replies */
+  unsigned              sendReserve;
+  epicsEventId          sendReleased; /* signaled by cas_send_release() */
+  char                  recvStalled; /* no room for replies, cf. camessage() */
+  char                  reactorRetry; /* out of network buffers */
   char                  disconnect; /* disconnect detected */
 } client;
 
@@ -154,8 +171,13 @@ typedef struct {
                 udpbcastAddr; /* UDP name broadcast receiver endpoint */
     SOCKET tcp, udp, udpbcast;
     struct client *client, *bclient;
+    /* additional name search threads sharing udpAddr (SO_REUSEPORT) */
+    SOCKET udpworker;
+    struct client **wclients;
+    unsigned nworkers;
 
     unsigned int startbcast:1;
+    unsigned int startworker:1;
 } rsrv_iface_config;
 
 enum ctl {ctlInit, ctlRun, ctlPause, ctlExit};
@@ -207,8 +229,19 @@ GLBLTYPE volatile enum ctl  castcp_ctl;
 
 GLBLTYPE unsigned int       threadPrios[5];
 
+GLBLTYPE int                casReactorThreads; /* iocsh, 0 for thread per client */
+GLBLTYPE int                casZeroCopyMinBytes GLBLTYPE_INIT(16384); /* iocsh, 0 disables */
+GLBLTYPE int                casSearchBatch; /* iocsh, <=1 disables */
+GLBLTYPE int                casSearchThreads GLBLTYPE_INIT(1); /* iocsh, per interface */
+GLBLTYPE unsigned           rsrvReactorCount; /* read-only after rsrv_init() */
+
 #define CAS_HASH_TABLE_SIZE 4096
 
+/* batched name service, recvmmsg() and sendmmsg() */
+#ifdef __linux__
+#   define CAS_HAVE_RECVMMSG
+#endif
+
 #define SEND_LOCK(CLIENT) epicsMutexMustLock((CLIENT)->lock)
 #define SEND_UNLOCK(CLIENT) epicsMutexUnlock((CLIENT)->lock)
 
@@ -220,8 +253,21 @@ extern "C" {
 #endif
 
 void camsgtask (void *client);
+int casClientRecv ( struct client *client );
+int casClientProcess ( struct client *client );
+int rsrv_reactor_init ( unsigned nThreads );
+int rsrv_reactor_add ( struct client *client );
+int rsrv_reactor_is_self ( const struct client *client );
+void rsrv_reactor_wait_send ( struct client *client );
+void rsrv_reactor_show ( unsigned level );
 void cas_send_bs_msg ( struct client *pclient, int lock_needed );
+unsigned cas_send_pending ( const struct client *pclient );
+int cas_send_reserve ( struct client *pclient, unsigned size );
+void cas_send_release ( struct client *pclient );
 void cas_send_dg_msg ( struct client *pclient );
+void cas_batch_dg_msg ( struct client *pclient, const char *pDG,
+    unsigned sizeDG );
+void rsrv_udp_batch_show ( const struct client *client, unsigned level );
 void rsrv_online_notify_task (void *);
 void cast_server (void *);
 struct client *create_client ( SOCKET sock, int proto );
@@ -253,6 +299,9 @@ int cas_copy_in_header (
     ca_uint32_t responseSpecific, void **pPayload );
 void cas_set_header_cid ( struct client *pClient, ca_uint32_t );
 void cas_set_header_count (struct client *pClient, ca_uint32_t count);
+int cas_send_external ( struct client *pclient, ca_uint16_t response,
+    ca_uint32_t payloadSize, ca_uint16_t dataType, ca_uint32_t nElem,
+    ca_uint32_t cid, ca_uint32_t responseSpecific, const void *pPayload );
 void cas_commit_msg ( struct client *pClient, ca_uint32_t size );
 
 #ifdef __cplusplus
@@ -0,0 +1,148 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Reads the contention counters of a record's lock set into an ai record.
+ *
+ *  INP is "@<record> <counter>" where counter is one of
+ *      LOCKED      times the lock set was locked
+ *      CONTENDED   times a thread had to wait for it
+ *      CONTENTION  percentage of the times that a thread had to wait
+ *      WAIT        mean wait, in usec
+ *      WAITMAX     longest wait, in usec
+ *      HOLD        mean time held, in usec
+ *      HOLDMAX     longest time held, in usec
+ *  The times held are only counted while dbLockHoldTimes is set.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "alarm.h"
+#include "dbDefs.h"
+#include "dbAccess.h"
+#include "dbLock.h"
+#include "dbStaticLib.h"
+#include "recGbl.h"
+#include "devSup.h"
+#include "epicsString.h"
+
+#include "aiRecord.h"
+#include "epicsExport.h"
+
+#define DEVSUPNAME "devAiLockSet"
+
+enum { statLocked, statContended, statContention, statWait, statWaitMax,
+    statHold, statHoldMax };
+
+static const char * const statNames[] = {
+    "LOCKED", "CONTENDED", "CONTENTION", "WAIT", "WAITMAX", "HOLD", "HOLDMAX"
+};
+
+typedef struct {
+    dbCommon *precord;
+    int stat;
+} lockSetPvt;
+
+static long init_record(dbCommon *pcommon)
+{
+    aiRecord *prec = (aiRecord *)pcommon;
+    char *parm, *sep;
+    lockSetPvt *ppvt;
+    DBENTRY dbentry;
+    int i;
+
+    if (prec->inp.type != INST_IO) {
+        recGblRecordError(S_db_badField, (void *)prec,
+                          DEVSUPNAME ": Illegal INP field");
+        prec->pact = TRUE;
+        return S_db_badField;
+    }
+
+    parm = epicsStrDup(prec->inp.value.instio.string);
+    sep = strrchr(parm, ' ');
+    ppvt = calloc(1, sizeof(*ppvt));
+    if (!ppvt || !sep)
+        goto bad;
+    *sep++ = '\0';
+
+    for (i = 0; i < NELEMENTS(statNames); i++) {
+        if (!epicsStrCaseCmp(sep, statNames[i]))
+            break;
+    }
+    if (i == NELEMENTS(statNames))
+        goto bad;
+    ppvt->stat = i;
+
+    dbInitEntry(pdbbase, &dbentry);
+    if (!dbFindRecord(&dbentry, parm))
+        ppvt->precord = dbentry.precnode->precord;
+    dbFinishEntry(&dbentry);
+    if (!ppvt->precord)
+        goto bad;
+
+    free(parm);
+    prec->dpvt = ppvt;
+    return 0;
+
+bad:
+    recGblRecordError(S_db_badField, (void *)prec,
+                      DEVSUPNAME ": Bad parm, expected \"@<record> <counter>\"");
+    free(parm);
+    free(ppvt);
+    prec->pact = TRUE;
+    return S_db_badField;
+}
+
+static long read_ai(aiRecord *prec)
+{
+    lockSetPvt *ppvt = prec->dpvt;
+    dbLockStats stats;
+    double val = 0.0;
+
+    if (!ppvt || dbLockGetStats(ppvt->precord, &stats)) {
+        recGblSetSevr(prec, READ_ALARM, INVALID_ALARM);
+        return -1;
+    }
+
+    switch (ppvt->stat) {
+    case statLocked:
+        val = stats.nlock;
+        break;
+    case statContended:
+        val = stats.ncontended;
+        break;
+    case statContention:
+        if (stats.nlock)
+            val = 100.0 * stats.ncontended / stats.nlock;
+        break;
+    case statWait:
+        if (stats.ncontended)
+            val = stats.waitTotal * 1e-3 / stats.ncontended;
+        break;
+    case statWaitMax:
+        val = stats.waitMax * 1e-3;
+        break;
+    case statHold:
+        if (stats.nheld)
+            val = stats.holdTotal * 1e-3 / stats.nheld;
+        break;
+    case statHoldMax:
+        val = stats.holdMax * 1e-3;
+        break;
+    }
+    prec->val = val;
+    prec->udf = FALSE;
+    return 2;
+}
+
+aidset devAiLockSet = {
+    {6, NULL, NULL, init_record, NULL},
+    read_ai, NULL
+};
+epicsExportAddress(dset, devAiLockSet);
@@ -10,6 +10,9 @@
 /*  Usage
  *      {calc:{expr:"A*B", args:[{...}, ...], units:"mm"}}
  *  First link in 'args' is 'A', second is 'B', and so forth.
+ *
+ *  With nelm:N an input link returns up to N elements, evaluating the
+ *  expression for each element of the array arguments.
  */
 
 #include <string.h>
@@ -47,6 +50,7 @@ typedef struct calc_link {
         ps_prec,
         ps_units,
         ps_time,
+        ps_nelm,
         ps_error
     } pstate;
     epicsEnum16 stat;
@@ -59,6 +63,9 @@ typedef struct calc_link {
     char *post_expr;
     char *post_major;
     char *post_minor;
+    calcProgram *prog_expr;
+    calcProgram *prog_major;
+    calcProgram *prog_minor;
     char *units;
     short tinp;
     struct link inp[CALCPERFORM_NARGS];
@@ -67,6 +74,10 @@ typedef struct calc_link {
     epicsTimeStamp time;
     epicsUTag utag;
     double val;
+    long nelm;          /* Array elements, or 0 for a scalar */
+    double *vals;       /* nelm results */
+    double *argv[CALCPERFORM_NARGS];    /* nelm values of each arg */
+    long argn[CALCPERFORM_NARGS];       /* Elements in argv, 0 to use arg */
 } calc_link;
 
 static lset lnkCalc_lset;
@@ -114,7 +125,11 @@ static void lnkCalc_free(jlink *pjlink)
     free(clink->post_expr);
     free(clink->post_major);
     free(clink->post_minor);
+    calcProgramFree(clink->prog_expr);
+    calcProgramFree(clink->prog_major);
+    calcProgramFree(clink->prog_minor);
     free(clink->units);
+    free(clink->vals);
     free(clink);
 }
 
@@ -127,6 +142,15 @@ static jlif_result lnkCalc_integer(jlink *pjlink, long long num)
         return jlif_continue;
     }
 
+    if (clink->pstate == ps_nelm) {
+        if (num < 1 || num > 0x7fffffff) {
+            errlogPrintf("lnkCalc: Bad 'nelm' parameter %lld\n", num);
+            return jlif_stop;
+        }
+        clink->nelm = num;
+        return jlif_continue;
+    }
+
     if (clink->pstate != ps_args) {
         errlogPrintf("lnkCalc: Unexpected integer %lld\n", num);
         return jlif_stop;
@@ -224,6 +248,13 @@ static jlif_result lnkCalc_string(jlink *pjlink, const char *val, size_t len)
         return jlif_stop;
     }
 
+    if (clink->pstate == ps_major)
+        clink->prog_major = calcCompile(postbuf);
+    else if (clink->pstate == ps_minor)
+        clink->prog_minor = calcCompile(postbuf);
+    else
+        clink->prog_expr = calcCompile(postbuf);
+
     return jlif_continue;
 }
 
@@ -271,6 +302,9 @@ static jlif_result lnkCalc_map_key(jlink *pjlink, const char *key, size_t len)
             clink->pstate = ps_prec;
         else if (!strncmp(key, "time", len))
             clink->pstate = ps_time;
+        else if (!strncmp(key, "nelm", len) &&
+            clink->dbfType == DBF_INLINK && !clink->nelm)
+            clink->pstate = ps_nelm;
         else {
             errlogPrintf("lnkCalc: Unknown key \"%.4s\"\n", key);
             return jlif_stop;
@@ -312,6 +346,10 @@ static jlif_result lnkCalc_end_map(jlink *pjlink)
         errlogPrintf("lnkCalc: No output link ('out' key)\n");
         return jlif_stop;
     }
+    else if (clink->nelm && (clink->post_major || clink->post_minor)) {
+        errlogPrintf("lnkCalc: Alarm expressions can't be used with 'nelm'\n");
+        return jlif_stop;
+    }
 
     return jlif_continue;
 }
@@ -383,6 +421,9 @@ static void lnkCalc_report(const jlink *pjlink, int level, int indent)
         clink->expr, clink->prec, clink->val,
         clink->units ? clink->units : "");
 
+    if (level > 0 && clink->nelm)
+        printf("%*s  Array of up to %ld elements\n", indent, "", clink->nelm);
+
     if (level > 0) {
         if (clink->sevr)
             printf("%*s  Alarm: %s, %s, \"%s\"\n", indent, "",
@@ -410,8 +451,12 @@ static void lnkCalc_report(const jlink *pjlink, int level, int indent)
             jlink *child = plink->type == JSON_LINK ?
                 plink->value.json.jlink : NULL;
 
-            printf("%*s  Input %c: %g\n", indent, "",
-                i + 'A', clink->arg[i]);
+            if (clink->argn[i] > 1)
+                printf("%*s  Input %c: %ld elements\n", indent, "",
+                    i + 'A', clink->argn[i]);
+            else
+                printf("%*s  Input %c: %g\n", indent, "",
+                    i + 'A', clink->argn[i] ? clink->argv[i][0] : clink->arg[i]);
 
             if (child)
                 dbJLinkReport(child, level - 1, indent + 4);
@@ -452,11 +497,28 @@ static void lnkCalc_open(struct link *plink)
         struct calc_link, jlink);
     int i;
 
+    if (clink->nelm) {
+        clink->vals = calloc(clink->nArgs + 1, clink->nelm * sizeof(double));
+        if (!clink->vals)
+            errlogPrintf("lnkCalc: Out of memory for %s.%s\n",
+                plink->precord->name, dbLinkFieldName(plink));
+    }
+
     for (i = 0; i < clink->nArgs; i++) {
         struct link *child = &clink->inp[i];
 
         child->precord = plink->precord;
         dbJLinkInit(child);
+        if (clink->vals) {
+            long nReq = clink->nelm;
+
+            clink->argv[i] = clink->vals + (i + 1) * clink->nelm;
+            if (!dbLoadLinkArray(child, DBR_DOUBLE, clink->argv[i], &nReq) &&
+                nReq > 0) {
+                clink->argn[i] = nReq;
+                continue;
+            }
+        }
         dbLoadLink(child, DBR_DOUBLE, &clink->arg[i]);
     }
 
@@ -487,7 +549,11 @@ static void lnkCalc_remove(struct dbLocker *locker, struct link *plink)
     free(clink->post_expr);
     free(clink->post_major);
     free(clink->post_minor);
+    calcProgramFree(clink->prog_expr);
+    calcProgramFree(clink->prog_major);
+    calcProgramFree(clink->prog_minor);
     free(clink->units);
+    free(clink->vals);
     free(clink);
     plink->value.json.jlink = NULL;
 }
@@ -525,7 +591,10 @@ static int lnkCalc_getDBFtype(const struct link *plink)
 
 static long lnkCalc_getElements(const struct link *plink, long *nelements)
 {
-    *nelements = 1;
+    calc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct calc_link, jlink);
+
+    *nelements = clink->nelm ? clink->nelm : 1;
     return 0;
 }
 
@@ -534,13 +603,13 @@ struct lcvt {
     double *pval;
     epicsTimeStamp *ptime;
     epicsUTag *ptag;
+    long nReq;
 };
 
 static long readLocked(struct link *pinp, void *vvt)
 {
     struct lcvt *pvt = (struct lcvt *) vvt;
-    long nReq = 1;
-    long status = dbGetLink(pinp, DBR_DOUBLE, pvt->pval, NULL, &nReq);
+    long status = dbGetLink(pinp, DBR_DOUBLE, pvt->pval, NULL, &pvt->nReq);
 
     if (!status && pvt->ptime)
         dbGetTimeStampTag(pinp, pvt->ptime, pvt->ptag);
@@ -548,6 +617,105 @@ static long readLocked(struct link *pinp, void *vvt)
     return status;
 }
 
+/* Run the compiled expression if there is one */
+static long doCalc(const calcProgram *pprog, const char *ppostfix,
+    double *parg, double *presult)
+{
+    if (pprog)
+        return calcProgramPerform(pprog, parg, presult);
+    return calcPerform(parg, presult, ppostfix);
+}
+
+/* Evaluate the expression for each element of the array arguments */
+static long getArray(struct link *plink, short dbrType, void *pbuffer,
+    long *pnRequest)
+{
+    calc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct calc_link, jlink);
+    dbCommon *prec = plink->precord;
+    const double *parg[CALCPERFORM_NARGS] = {NULL};
+    unsigned long arrays = 0;
+    long n = clink->nelm, size = dbValueSize(dbrType), j;
+    int i, scalar = 1;
+    long status = 0;
+    FASTCONVERTFUNC conv = dbFastPutConvertRoutine[DBR_DOUBLE][dbrType];
+
+    if (!clink->vals)
+        return S_db_noMemory;
+
+    /* Any link errors will trigger a LINK/INVALID alarm in the child link */
+    for (i = 0; i < clink->nArgs; i++) {
+        struct link *child = &clink->inp[i];
+        long nReq = clink->nelm;
+
+        /* Constants were loaded by lnkCalc_open() */
+        if (!dbLinkIsConstant(child)) {
+            long lstat;
+
+            if (i == clink->tinp) {
+                struct lcvt vt = {clink->argv[i], &clink->time, &clink->utag,
+                    clink->nelm};
+
+                lstat = dbLinkDoLocked(child, readLocked, &vt);
+                if (lstat == S_db_noLSET)
+                    lstat = readLocked(child, &vt);
+                nReq = vt.nReq;
+
+                if (dbLinkIsConstant(&prec->tsel) &&
+                    prec->tse == epicsTimeEventDeviceTime) {
+                    prec->time = clink->time;
+                    prec->utag = clink->utag;
+                }
+            }
+            else
+                lstat = dbGetLink(child, DBR_DOUBLE, clink->argv[i], NULL,
+                    &nReq);
+
+            /* A failed or empty read falls back to the scalar arg[i] */
+            clink->argn[i] = lstat || nReq < 0 ? 0 : nReq;
+        }
+
+        /* Arguments with one element are used for every element */
+        if (clink->argn[i] > 1) {
+            arrays |= 1ul << i;
+            if (scalar || clink->argn[i] < n)
+                n = clink->argn[i];
+            scalar = 0;
+        }
+        parg[i] = clink->argn[i] ? clink->argv[i] : &clink->arg[i];
+    }
+    clink->stat = 0;
+    clink->sevr = 0;
+    clink->amsg[0] = '\0';
+
+    if (scalar || !pnRequest)
+        n = 1;
+    else if (*pnRequest < n)
+        n = *pnRequest;
+
+    if (clink->prog_expr)
+        status = calcProgramPerformArray(clink->prog_expr, parg, arrays,
+            clink->vals, n);
+    else {
+        for (j = 0; !status && j < n; j++) {
+            double args[CALCPERFORM_NARGS] = {0.0};
+
+            for (i = 0; i < clink->nArgs; i++)
+                args[i] = parg[i][arrays & (1ul << i) ? j : 0];
+            status = calcPerform(args, &clink->vals[j], clink->post_expr);
+        }
+    }
+    if (status)
+        return status;
+
+    clink->val = clink->vals[0];
+    for (j = 0; !status && j < n; j++)
+        status = conv(&clink->vals[j], (char *) pbuffer + j * size, NULL);
+    if (!status && pnRequest)
+        *pnRequest = n;
+    return status;
+}
+
 static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
     long *pnRequest)
 {
@@ -561,6 +729,9 @@ static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
     if(INVALID_DB_REQ(dbrType))
         return S_db_badDbrtype;
 
+    if (clink->nelm)
+        return getArray(plink, dbrType, pbuffer, pnRequest);
+
     conv = dbFastPutConvertRoutine[DBR_DOUBLE][dbrType];
 
     /* Any link errors will trigger a LINK/INVALID alarm in the child link */
@@ -569,7 +740,7 @@ static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
         long nReq = 1;
 
         if (i == clink->tinp) {
-            struct lcvt vt = {&clink->arg[i], &clink->time, &clink->utag};
+            struct lcvt vt = {&clink->arg[i], &clink->time, &clink->utag, 1};
 
             status = dbLinkDoLocked(child, readLocked, &vt);
             if (status == S_db_noLSET)
@@ -589,7 +760,8 @@ static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
     clink->amsg[0] = '\0';
 
     if (clink->post_expr) {
-        status = calcPerform(clink->arg, &clink->val, clink->post_expr);
+        status = doCalc(clink->prog_expr, clink->post_expr,
+            clink->arg, &clink->val);
         if (!status)
             status = conv(&clink->val, pbuffer, NULL);
         if (!status && pnRequest)
@@ -604,7 +776,8 @@ static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
     if (!status && clink->post_major) {
         double alval = clink->val;
 
-        status = calcPerform(clink->arg, &alval, clink->post_major);
+        status = doCalc(clink->prog_major, clink->post_major,
+            clink->arg, &alval);
         if (!status && alval) {
             clink->stat = LINK_ALARM;
             clink->sevr = MAJOR_ALARM;
@@ -616,7 +789,8 @@ static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
     if (!status && !clink->sevr && clink->post_minor) {
         double alval = clink->val;
 
-        status = calcPerform(clink->arg, &alval, clink->post_minor);
+        status = doCalc(clink->prog_minor, clink->post_minor,
+            clink->arg, &alval);
         if (!status && alval) {
             clink->stat = LINK_ALARM;
             clink->sevr = MINOR_ALARM;
@@ -649,7 +823,7 @@ static long lnkCalc_putValue(struct link *plink, short dbrType,
         long nReq = 1;
 
         if (i == clink->tinp) {
-            struct lcvt vt = {&clink->arg[i], &clink->time, &clink->utag};
+            struct lcvt vt = {&clink->arg[i], &clink->time, &clink->utag, 1};
 
             status = dbLinkDoLocked(child, readLocked, &vt);
             if (status == S_db_noLSET)
@@ -672,12 +846,14 @@ static long lnkCalc_putValue(struct link *plink, short dbrType,
     status = conv(pbuffer, &clink->val, NULL);
 
     if (!status && clink->post_expr)
-        status = calcPerform(clink->arg, &clink->val, clink->post_expr);
+        status = doCalc(clink->prog_expr, clink->post_expr,
+            clink->arg, &clink->val);
 
     if (!status && clink->post_major) {
         double alval = clink->val;
 
-        status = calcPerform(clink->arg, &alval, clink->post_major);
+        status = doCalc(clink->prog_major, clink->post_major,
+            clink->arg, &alval);
         if (!status && alval) {
             clink->stat = LINK_ALARM;
             clink->sevr = MAJOR_ALARM;
@@ -689,7 +865,8 @@ static long lnkCalc_putValue(struct link *plink, short dbrType,
     if (!status && !clink->sevr && clink->post_minor) {
         double alval = clink->val;
 
-        status = calcPerform(clink->arg, &alval, clink->post_minor);
+        status = doCalc(clink->prog_minor, clink->post_minor,
+            clink->arg, &alval);
         if (!status && alval) {
             clink->stat = LINK_ALARM;
             clink->sevr = MINOR_ALARM;
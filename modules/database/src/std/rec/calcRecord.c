@@ -108,6 +108,8 @@ static long init_record(struct dbCommon *pcommon, int pass)
         errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
                      prec->name, calcErrorStr(error_number), prec->calc);
     }
+    else
+        prec->cprg = calcCompile(prec->rpcl);
     return 0;
 }
 
@@ -118,7 +120,8 @@ static long process(struct dbCommon *pcommon)
 
     prec->pact = TRUE;
     if (fetch_values(prec) == 0) {
-        if (calcPerform(&prec->a, &prec->val, prec->rpcl)) {
+        if (prec->cprg ? calcProgramPerform(prec->cprg, &prec->a, &prec->val) :
+                calcPerform(&prec->a, &prec->val, prec->rpcl)) {
             recGblSetSevr(prec, CALC_ALARM, INVALID_ALARM);
         } else
             prec->udf = isnan(prec->val);
@@ -143,6 +146,8 @@ static long special(DBADDR *paddr, int after)
 
     if (!after) return 0;
     if (paddr->special == SPC_CALC) {
+        calcProgramFree(prec->cprg);
+        prec->cprg = NULL;
         if (postfix(prec->calc, prec->rpcl, &error_number)) {
             recGblRecordError(S_db_badField, (void *)prec,
                               "calc: Illegal CALC field");
@@ -150,6 +155,7 @@ static long special(DBADDR *paddr, int after)
                          prec->name, calcErrorStr(error_number), prec->calc);
             return S_db_badField;
         }
+        prec->cprg = calcCompile(prec->rpcl);
         return 0;
     }
     recGblDbaddrError(S_db_badChoice, paddr, "calc::special - bad special value!");
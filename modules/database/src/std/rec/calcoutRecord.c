@@ -195,6 +195,8 @@ static long init_record(struct dbCommon *pcommon, int pass)
         errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
                      prec->name, calcErrorStr(error_number), prec->calc);
     }
+    else
+        prec->cprg = calcCompile(prec->rpcl);
 
     prec->oclv = postfix(prec->ocal, prec->orpc, &error_number);
     if (prec->dopt == calcoutDOPT_Use_OVAL && prec->oclv){
@@ -203,6 +205,8 @@ static long init_record(struct dbCommon *pcommon, int pass)
         errlogPrintf("%s.OCAL: %s in expression \"%s\"\n",
                      prec->name, calcErrorStr(error_number), prec->ocal);
     }
+    if (!prec->oclv)
+        prec->oprg = calcCompile(prec->orpc);
 
     prpvt = prec->rpvt;
     callbackSetCallback(checkLinksCallback, &prpvt->checkLinkCb);
@@ -235,7 +239,9 @@ static long process(struct dbCommon *pcommon)
             checkLinks(prec);
         }
         if (fetch_values(prec) == 0) {
-            if (calcPerform(&prec->a, &prec->val, prec->rpcl)) {
+            if (prec->cprg ?
+                    calcProgramPerform(prec->cprg, &prec->a, &prec->val) :
+                    calcPerform(&prec->a, &prec->val, prec->rpcl)) {
                 recGblSetSevrMsg(prec, CALC_ALARM, INVALID_ALARM, "calcPerform");
             } else {
                 prec->udf = isnan(prec->val);
@@ -323,6 +329,8 @@ static long special(DBADDR *paddr, int after)
     if (!after) return 0;
     switch(fieldIndex) {
       case(calcoutRecordCALC):
+        calcProgramFree(prec->cprg);
+        prec->cprg = NULL;
         prec->clcv = postfix(prec->calc, prec->rpcl, &error_number);
         if (prec->clcv){
             recGblRecordError(S_db_badField, (void *)prec,
@@ -330,10 +338,14 @@ static long special(DBADDR *paddr, int after)
             errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
                          prec->name, calcErrorStr(error_number), prec->calc);
         }
+        else
+            prec->cprg = calcCompile(prec->rpcl);
         db_post_events(prec, &prec->clcv, DBE_VALUE);
         return 0;
 
       case(calcoutRecordOCAL):
+        calcProgramFree(prec->oprg);
+        prec->oprg = NULL;
         prec->oclv = postfix(prec->ocal, prec->orpc, &error_number);
         if (prec->dopt == calcoutDOPT_Use_OVAL && prec->oclv){
             recGblRecordError(S_db_badField, (void *)prec,
@@ -341,6 +353,8 @@ static long special(DBADDR *paddr, int after)
             errlogPrintf("%s.OCAL: %s in expression \"%s\"\n",
                          prec->name, calcErrorStr(error_number), prec->ocal);
         }
+        if (!prec->oclv)
+            prec->oprg = calcCompile(prec->orpc);
         db_post_events(prec, &prec->oclv, DBE_VALUE);
         return 0;
       case(calcoutRecordINPA):
@@ -609,7 +623,9 @@ static void execOutput(calcoutRecord *prec)
         prec->oval = prec->val;
         break;
     case calcoutDOPT_Use_OVAL:
-        if (calcPerform(&prec->a, &prec->oval, prec->orpc)) {
+        if (prec->oprg ?
+                calcProgramPerform(prec->oprg, &prec->a, &prec->oval) :
+                calcPerform(&prec->a, &prec->oval, prec->orpc)) {
             recGblSetSevrMsg(prec, CALC_ALARM, INVALID_ALARM, "OCAL calcPerform");
         } else {
             prec->udf = isnan(prec->oval);
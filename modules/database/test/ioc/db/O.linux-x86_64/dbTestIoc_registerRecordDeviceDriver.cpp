@@ -0,0 +1,178 @@
+/* THIS IS A GENERATED FILE. DO NOT EDIT! */
+/* Generated from ../O.Common/dbTestIoc.dbd */
+
+#include <string.h>
+#ifndef USE_TYPED_RSET
+#  define USE_TYPED_RSET
+#endif
+#include "compilerDependencies.h"
+#include "epicsStdlib.h"
+#include "iocsh.h"
+#include "iocshRegisterCommon.h"
+#include "registryCommon.h"
+#include "recSup.h"
+#include "shareLib.h"
+
+extern "C" {
+
+epicsShareExtern typed_rset *pvar_rset_arrRSET, *pvar_rset_xRSET;
+
+typedef int (*rso_func)(dbRecordType *pdbRecordType);
+epicsShareExtern rso_func pvar_func_arrRecordSizeOffset,
+    pvar_func_xRecordSizeOffset;
+
+static const char * const recordTypeNames[] = {
+    "arr", "x"
+};
+
+static const recordTypeLocation rtl[] = {
+    {(struct typed_rset *)pvar_rset_arrRSET, pvar_func_arrRecordSizeOffset},
+    {(struct typed_rset *)pvar_rset_xRSET, pvar_func_xRecordSizeOffset}
+};
+
+epicsShareExtern dset *pvar_dset_devxSoft,
+    *pvar_dset_devxScanIO_excessively_long_symbol_name_for_testing_code_generation,
+    *pvar_dset_devxInitThread, *pvar_dset_devxLTestJSON_LINK,
+    *pvar_dset_devxLTestVME_IO, *pvar_dset_devxLTestCAMAC_IO,
+    *pvar_dset_devxLTestAB_IO, *pvar_dset_devxLTestGPIB_IO,
+    *pvar_dset_devxLTestBITBUS_IO, *pvar_dset_devxLTestINST_IO,
+    *pvar_dset_devxLTestBBGPIB_IO, *pvar_dset_devxLTestRF_IO,
+    *pvar_dset_devxLTestVXI_IO;
+
+static const char * const deviceSupportNames[] = {
+    "devxSoft",
+    "devxScanIO_excessively_long_symbol_name_for_testing_code_generation",
+    "devxInitThread", "devxLTestJSON_LINK", "devxLTestVME_IO",
+    "devxLTestCAMAC_IO", "devxLTestAB_IO", "devxLTestGPIB_IO",
+    "devxLTestBITBUS_IO", "devxLTestINST_IO", "devxLTestBBGPIB_IO",
+    "devxLTestRF_IO", "devxLTestVXI_IO"
+};
+
+static const dset * const devsl[] = {
+    pvar_dset_devxSoft,
+    pvar_dset_devxScanIO_excessively_long_symbol_name_for_testing_code_generation,
+    pvar_dset_devxInitThread, pvar_dset_devxLTestJSON_LINK,
+    pvar_dset_devxLTestVME_IO, pvar_dset_devxLTestCAMAC_IO,
+    pvar_dset_devxLTestAB_IO, pvar_dset_devxLTestGPIB_IO,
+    pvar_dset_devxLTestBITBUS_IO, pvar_dset_devxLTestINST_IO,
+    pvar_dset_devxLTestBBGPIB_IO, pvar_dset_devxLTestRF_IO,
+    pvar_dset_devxLTestVXI_IO
+};
+
+epicsShareExtern jlif *pvar_jlif_jlifZ, *pvar_jlif_xlinkIf;
+
+static struct jlif *jlifsl[] = {
+    pvar_jlif_jlifZ,
+    pvar_jlif_xlinkIf};
+
+epicsShareExtern int * const pvar_int_CASDEBUG;
+epicsShareExtern int * const pvar_int_asCaDebug;
+epicsShareExtern int * const pvar_int_atExitDebug;
+epicsShareExtern int * const pvar_int_callbackParallelThreadsDefault;
+epicsShareExtern int * const pvar_int_casReactorThreads;
+epicsShareExtern int * const pvar_int_casSearchBatch;
+epicsShareExtern int * const pvar_int_casSearchThreads;
+epicsShareExtern int * const pvar_int_casZeroCopyMinBytes;
+epicsShareExtern int * const pvar_int_dbAccessDebugPUTF;
+epicsShareExtern int * const pvar_int_dbBptNotMonotonic;
+epicsShareExtern int * const pvar_int_dbCaWorkers;
+epicsShareExtern int * const pvar_int_dbConvertStrict;
+epicsShareExtern int * const pvar_int_dbEventQueueEntries;
+epicsShareExtern int * const pvar_int_dbEventQueueMaxBytes;
+epicsShareExtern int * const pvar_int_dbEventSnapshotMinBytes;
+epicsShareExtern int * const pvar_int_dbInitThreads;
+epicsShareExtern int * const pvar_int_dbJLinkDebug;
+epicsShareExtern int * const pvar_int_dbLockHoldTimes;
+epicsShareExtern int * const pvar_int_dbQuietMacroWarnings;
+epicsShareExtern int * const pvar_int_dbRecordsAbcSorted;
+epicsShareExtern int * const pvar_int_dbRecordsOnceOnly;
+epicsShareExtern int * const pvar_int_dbTemplateMaxVars;
+epicsShareExtern int * const pvar_int_dbThreadRealtimeLock;
+epicsShareExtern int * const pvar_int_logClientDebug;
+
+static struct iocshVarDef vardefs[] = {
+    {"CASDEBUG", iocshArgInt, pvar_int_CASDEBUG},
+    {"asCaDebug", iocshArgInt, pvar_int_asCaDebug},
+    {"atExitDebug", iocshArgInt, pvar_int_atExitDebug},
+    {"callbackParallelThreadsDefault", iocshArgInt, pvar_int_callbackParallelThreadsDefault},
+    {"casReactorThreads", iocshArgInt, pvar_int_casReactorThreads},
+    {"casSearchBatch", iocshArgInt, pvar_int_casSearchBatch},
+    {"casSearchThreads", iocshArgInt, pvar_int_casSearchThreads},
+    {"casZeroCopyMinBytes", iocshArgInt, pvar_int_casZeroCopyMinBytes},
+    {"dbAccessDebugPUTF", iocshArgInt, pvar_int_dbAccessDebugPUTF},
+    {"dbBptNotMonotonic", iocshArgInt, pvar_int_dbBptNotMonotonic},
+    {"dbCaWorkers", iocshArgInt, pvar_int_dbCaWorkers},
+    {"dbConvertStrict", iocshArgInt, pvar_int_dbConvertStrict},
+    {"dbEventQueueEntries", iocshArgInt, pvar_int_dbEventQueueEntries},
+    {"dbEventQueueMaxBytes", iocshArgInt, pvar_int_dbEventQueueMaxBytes},
+    {"dbEventSnapshotMinBytes", iocshArgInt, pvar_int_dbEventSnapshotMinBytes},
+    {"dbInitThreads", iocshArgInt, pvar_int_dbInitThreads},
+    {"dbJLinkDebug", iocshArgInt, pvar_int_dbJLinkDebug},
+    {"dbLockHoldTimes", iocshArgInt, pvar_int_dbLockHoldTimes},
+    {"dbQuietMacroWarnings", iocshArgInt, pvar_int_dbQuietMacroWarnings},
+    {"dbRecordsAbcSorted", iocshArgInt, pvar_int_dbRecordsAbcSorted},
+    {"dbRecordsOnceOnly", iocshArgInt, pvar_int_dbRecordsOnceOnly},
+    {"dbTemplateMaxVars", iocshArgInt, pvar_int_dbTemplateMaxVars},
+    {"dbThreadRealtimeLock", iocshArgInt, pvar_int_dbThreadRealtimeLock},
+    {"logClientDebug", iocshArgInt, pvar_int_logClientDebug},
+    {NULL, iocshArgInt, NULL}
+};
+
+int dbTestIoc_registerRecordDeviceDriver(DBBASE *pbase)
+{
+    static int executed = 0;
+    const char *bldTop = "/root/repo";
+    const char *envTop = getenv("TOP");
+
+    if (envTop && strcmp(envTop, bldTop)) {
+        printf("Warning: IOC is booting with TOP = \"%s\"\n"
+               "          but was built with TOP = \"%s\"\n",
+               envTop, bldTop);
+    }
+
+    if (!pbase) {
+        printf("pdbbase is NULL; you must load a DBD file first.\n");
+        return -1;
+    }
+
+    if (executed) {
+        printf("Warning: Registration already done.\n");
+    }
+    executed = 1;
+
+    registerRecordTypes(pbase, NELEMENTS(rtl), recordTypeNames, rtl);
+    registerDevices(pbase, NELEMENTS(devsl), deviceSupportNames, devsl);
+    registerJLinks(pbase, NELEMENTS(jlifsl), jlifsl);
+    iocshRegisterVariable(vardefs);
+    return 0;
+}
+
+/* dbTestIoc_registerRecordDeviceDriver */
+static const iocshArg rrddArg0 = {"pdbbase", iocshArgPdbbase};
+static const iocshArg *rrddArgs[] = {&rrddArg0};
+static const iocshFuncDef rrddFuncDef = {
+    "dbTestIoc_registerRecordDeviceDriver",
+    1,
+    rrddArgs,
+    "Register the various records, devices, for this DBD.\n\n"
+    "These are registered into the database given as first argument,\n"
+    "which should always be 'pdbbase'.\n\n"
+    "Example: dbTestIoc_registerRecordDeviceDriver pdbbase\n",
+};
+static void rrddCallFunc(const iocshArgBuf *)
+{
+    iocshSetError(dbTestIoc_registerRecordDeviceDriver(*iocshPpdbbase));
+}
+
+} // extern "C"
+
+/*
+ * Register commands on application startup
+ */
+static int Registration() {
+    iocshRegisterCommon();
+    iocshRegister(&rrddFuncDef, rrddCallFunc);
+    return 0;
+}
+
+static int done EPICS_UNUSED = Registration();
@@ -0,0 +1,89 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure the byte-swapping of numeric arrays between host and network
+ * byte order done by the CA client and server, into another buffer and
+ * in place.  The array lengths may be overridden with a comma separated
+ * list in $CONVERT_BENCH_ELEMENTS.
+ */
+
+#include <stdlib.h>
+
+#include "cantProceed.h"
+#include "dbDefs.h"
+#include "epicsTime.h"
+#include "epicsTypes.h"
+#include "caerr.h"
+#include "db_access.h"
+#include "net_convert.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NRUNS 5
+
+static void benchSwap(unsigned type, void *src, void *dst, long n)
+{
+    double best = 0.0;
+    int run;
+
+    for (run = 0; run < NRUNS; run++) {
+        epicsUInt64 t0 = epicsMonotonicGet();
+        double dt;
+
+        if (caNetConvert(type, src, dst, src != dst, n) != ECA_NORMAL)
+            testAbort("caNetConvert(%s) failed", dbr_type_to_text(type));
+        dt = (double) (epicsMonotonicGet() - t0) / n;
+        if (run == 0 || dt < best)
+            best = dt;
+    }
+    testDiag("  %-15s %-14s %6.3f nsec/element", dbr_type_to_text(type),
+        src == dst ? "ntoh in place" : "hton", best);
+}
+
+static void runBench(long n)
+{
+    static const unsigned types[] = {
+        DBR_SHORT, DBR_LONG, DBR_FLOAT, DBR_DOUBLE, DBR_TIME_DOUBLE
+    };
+    void *src = callocMustSucceed(n + 2, sizeof(epicsFloat64),
+        "benchCaNetConvert");
+    void *dst = callocMustSucceed(n + 2, sizeof(epicsFloat64),
+        "benchCaNetConvert");
+    unsigned i;
+
+    testDiag("%ld elements", n);
+    for (i = 0; i < NELEMENTS(types); i++) {
+        benchSwap(types[i], src, dst, n);
+        benchSwap(types[i], src, src, n);
+    }
+    free(src);
+    free(dst);
+}
+
+MAIN(benchCaNetConvert)
+{
+    long counts[16] = { 1000, 2000000 };
+    unsigned nCounts = 2, i;
+    const char *env = getenv("CONVERT_BENCH_ELEMENTS");
+
+    if (env) {
+        char *end;
+
+        nCounts = 0;
+        while (*env && nCounts < NELEMENTS(counts)) {
+            counts[nCounts++] = strtol(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+    for (i = 0; i < nCounts; i++)
+        runBench(counts[i]);
+    return testDone();
+}
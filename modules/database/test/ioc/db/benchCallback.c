@@ -0,0 +1,251 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure callbacks/sec and the 99th percentile time from
+ * callbackRequest() to the callback running, for bursts of requests from
+ * several scan priority threads to the medium priority callback queue.
+ *
+ * Compares the callback queue with a copy of its previous implementation,
+ * a locked epicsRingPointer with a wakeup sent for every request and
+ * another after every callback taken from a non-empty queue.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsRingPointer.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "callback.h"
+#include "dbAccess.h"
+#include "dbUnitTest.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NPRODUCERS  4
+#define NROUNDS     2000
+#define BURST       50
+#define NTOTAL      (NPRODUCERS * NROUNDS * BURST)
+#define QUEUE_SIZE  2000
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+typedef int (*requestFunc)(epicsCallback *);
+
+typedef struct producer producer;
+
+typedef struct benchCallback {
+    epicsCallback cb;
+    epicsUInt64 requested;
+    producer *prod;
+} benchCallback;
+
+struct producer {
+    requestFunc request;
+    int pending;
+    epicsEventId done;
+    benchCallback cbs[BURST];
+};
+
+static epicsUInt64 *latencies;
+static size_t nlatencies;
+
+static void benchRun(epicsCallback *pcb)
+{
+    benchCallback *pbc = (benchCallback *) pcb;
+    epicsUInt64 now = epicsMonotonicGet();
+    size_t i = epicsAtomicIncrSizeT(&nlatencies) - 1;
+
+    latencies[i] = now - pbc->requested;
+    if (!epicsAtomicDecrIntT(&pbc->prod->pending))
+        epicsEventMustTrigger(pbc->prod->done);
+}
+
+/* The previous callback queue */
+
+static struct {
+    epicsRingPointerId queue;
+    epicsEventId semWakeUp;
+    int shutdown;
+    int nthreads;
+    epicsThreadId threads[8];
+} legacy;
+
+static void legacyTask(void *arg)
+{
+    while (!epicsAtomicGetIntT(&legacy.shutdown)) {
+        void *ptr;
+        if (epicsRingPointerIsEmpty(legacy.queue))
+            epicsEventMustWait(legacy.semWakeUp);
+
+        while ((ptr = epicsRingPointerPop(legacy.queue))) {
+            epicsCallback *pcallback = (epicsCallback *) ptr;
+            if (!epicsRingPointerIsEmpty(legacy.queue))
+                epicsEventMustTrigger(legacy.semWakeUp);
+            (*pcallback->callback)(pcallback);
+        }
+    }
+}
+
+static int legacyRequest(epicsCallback *pcallback)
+{
+    if (!epicsRingPointerPush(legacy.queue, pcallback))
+        return S_db_bufFull;
+    epicsEventSignal(legacy.semWakeUp);
+    return 0;
+}
+
+static void legacyStart(int nthreads)
+{
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    int i;
+
+    legacy.queue = epicsRingPointerLockedCreate(QUEUE_SIZE);
+    legacy.semWakeUp = epicsEventMustCreate(epicsEventEmpty);
+    legacy.shutdown = 0;
+    legacy.nthreads = nthreads;
+    opts.joinable = 1;
+    opts.priority = epicsThreadPriorityScanLow + 4;
+    opts.stackSize = epicsThreadStackBig;
+    for (i = 0; i < nthreads; i++) {
+        legacy.threads[i] = epicsThreadCreateOpt("legacyCb", legacyTask,
+            NULL, &opts);
+    }
+}
+
+static void legacyStop(void)
+{
+    int i;
+
+    epicsAtomicSetIntT(&legacy.shutdown, 1);
+    for (i = 0; i < legacy.nthreads; i++) {
+        epicsEventSignal(legacy.semWakeUp);
+    }
+    for (i = 0; i < legacy.nthreads; i++) {
+        epicsEventSignal(legacy.semWakeUp);
+        epicsThreadMustJoin(legacy.threads[i]);
+    }
+    epicsEventDestroy(legacy.semWakeUp);
+    epicsRingPointerDelete(legacy.queue);
+}
+
+static void producerTask(void *arg)
+{
+    producer *prod = arg;
+    int round, i;
+
+    for (round = 0; round < NROUNDS; round++) {
+        epicsAtomicSetIntT(&prod->pending, BURST);
+        for (i = 0; i < BURST; i++) {
+            benchCallback *pbc = &prod->cbs[i];
+
+            pbc->requested = epicsMonotonicGet();
+            while (prod->request(&pbc->cb))
+                epicsThreadSleep(0.001);
+        }
+        epicsEventMustWait(prod->done);
+    }
+}
+
+static int cmpLatency(const void *a, const void *b)
+{
+    epicsUInt64 x = *(const epicsUInt64 *) a, y = *(const epicsUInt64 *) b;
+
+    return x < y ? -1 : x > y;
+}
+
+static void runBench(const char *name, requestFunc request)
+{
+    producer prods[NPRODUCERS];
+    epicsThreadId tids[NPRODUCERS];
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    epicsUInt64 t0, t1;
+    int i, j;
+
+    nlatencies = 0;
+    opts.joinable = 1;
+    opts.priority = epicsThreadPriorityScanHigh;
+
+    t0 = epicsMonotonicGet();
+    for (i = 0; i < NPRODUCERS; i++) {
+        producer *prod = &prods[i];
+
+        prod->request = request;
+        prod->done = epicsEventMustCreate(epicsEventEmpty);
+        for (j = 0; j < BURST; j++) {
+            callbackSetCallback(benchRun, &prod->cbs[j].cb);
+            callbackSetPriority(priorityMedium, &prod->cbs[j].cb);
+            prod->cbs[j].prod = prod;
+        }
+        tids[i] = epicsThreadCreateOpt("benchProducer", producerTask,
+            prod, &opts);
+    }
+    for (i = 0; i < NPRODUCERS; i++) {
+        epicsThreadMustJoin(tids[i]);
+        epicsEventDestroy(prods[i].done);
+    }
+    t1 = epicsMonotonicGet();
+
+    testOk(nlatencies == NTOTAL, "%s, %lu of %u callbacks run", name,
+        (unsigned long) nlatencies, NTOTAL);
+    qsort(latencies, nlatencies, sizeof(*latencies), cmpLatency);
+    testDiag("  %10.0f callbacks/sec, latency median %.1f usec, "
+        "p99 %.1f usec", NTOTAL * 1e9 / (t1 - t0),
+        latencies[nlatencies / 2] * 1e-3,
+        latencies[nlatencies * 99 / 100] * 1e-3);
+}
+
+static void runCallbackQueue(int nthreads)
+{
+    char name[40];
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    callbackParallelThreads(nthreads, "*");
+    testIocInitOk();
+
+    sprintf(name, "callback queue, %d thread%s", nthreads,
+        nthreads > 1 ? "s" : "");
+    runBench(name, callbackRequest);
+
+    testIocShutdownOk();
+    testdbCleanup();
+}
+
+static void runLegacy(int nthreads)
+{
+    char name[40];
+
+    sprintf(name, "previous queue, %d thread%s", nthreads,
+        nthreads > 1 ? "s" : "");
+    legacyStart(nthreads);
+    runBench(name, legacyRequest);
+    legacyStop();
+}
+
+MAIN(benchCallback)
+{
+    testPlan(0);
+    latencies = malloc(NTOTAL * sizeof(*latencies));
+    if (!latencies)
+        testAbort("Out of memory");
+
+    testDiag("%d producers, bursts of %d", NPRODUCERS, BURST);
+    runLegacy(1);
+    runCallbackQueue(1);
+    runLegacy(2);
+    runCallbackQueue(2);
+
+    free(latencies);
+    return testDone();
+}
@@ -0,0 +1,252 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure the throughput of large DBR_CHAR array monitors from RSRV,
+ * with the arrays copied into each client's send buffer as before
+ * (casZeroCopyMinBytes = 0) and sent directly from a shared snapshot.
+ *
+ * The number of clients defaults to 4, and may be overridden with a
+ * comma separated list in $RSRV_BENCH_CLIENTS.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "envDefs.h"
+#include "caProto.h"
+#include "db_access.h"
+#include "caeventmask.h"
+#include "dbEvent.h"
+#include "dbUnitTest.h"
+
+#include "arrRecord.h"
+#include "rsrvBench.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NELM        (4 * 1024 * 1024)
+#define NUPDATES    50
+
+typedef struct {
+    int created;
+    epicsUInt32 sid;
+    unsigned long nupdates;
+    unsigned long nbad;
+} benchClient;
+
+static char *expected;
+
+/* arr records don't post monitors themselves */
+static void postArray(struct arrRecord *prec)
+{
+    db_post_events(prec, &prec->val, DBE_VALUE | DBE_LOG);
+}
+
+static void atIocInit(void)
+{
+    arrRecord *prec = (arrRecord *) testdbRecordPtr("bench:img");
+
+    prec->clbk = &postArray;
+}
+
+static void onMsg(benchCircuit *circ, const benchMsg *msg)
+{
+    benchClient *client = (benchClient *) circ->pvt;
+
+    if (msg->cmmd == CA_PROTO_CREATE_CHAN) {
+        client->sid = msg->available;
+        client->created = 1;
+    }
+    else if (msg->cmmd == CA_PROTO_EVENT_ADD) {
+        /* the initial update, before the array is written, is empty */
+        if (msg->count == NELM && msg->postsize >= NELM &&
+                memcmp(msg->payload, expected, NELM) == 0)
+            client->nupdates++;
+        else
+            client->nbad++;
+    }
+}
+
+/* read from every circuit until each has nupdates updates */
+static int drainUntil(benchCircuit *circs, benchClient *clients,
+    unsigned n, int created, unsigned long nupdates, double timeout)
+{
+    double deadline = benchNow() + timeout;
+
+    while (benchNow() < deadline) {
+        unsigned i, ndone = 0;
+        for (i = 0; i < n; i++) {
+            if (benchCircuitRead(&circs[i], onMsg) < 0)
+                return -1;
+            if (created ? clients[i].created :
+                    clients[i].nupdates >= nupdates)
+                ndone++;
+        }
+        if (ndone == n)
+            return 0;
+        benchCircuitPoll(circs, n, 0.01);
+    }
+    return -1;
+}
+
+static unsigned long countBad(const benchClient *clients, unsigned n)
+{
+    unsigned long bad = 0;
+    unsigned i;
+
+    for (i = 0; i < n; i++) {
+        bad += clients[i].nbad;
+    }
+    return bad;
+}
+
+static void runBench(unsigned nclients, int zeroCopy)
+{
+    const char *mode = zeroCopy ? "zero copy" : "copied";
+    benchIoc ioc;
+    benchCircuit *circs, writer[2];
+    benchClient *clients, wclients[2];
+    unsigned i;
+    unsigned long bad;
+    double cpu0, cpu1, t0, t1, mbytes;
+    epicsInt32 one = htonl(1);
+
+    testDiag("%u clients, %s", nclients, mode);
+
+    if (benchIocStart(&ioc, "benchRsrvArrays.db", NULL, zeroCopy ?
+            "var casZeroCopyMinBytes 16384" : "var casZeroCopyMinBytes 0")) {
+        testFail("Unable to start IOC");
+        return;
+    }
+
+    circs = calloc(nclients, sizeof(*circs));
+    clients = calloc(nclients, sizeof(*clients));
+    if (!circs || !clients) {
+        testAbort("Out of memory");
+    }
+    memset(writer, 0, sizeof(writer));
+    memset(wclients, 0, sizeof(wclients));
+    for (i = 0; i < NELEMENTS(writer); i++) {
+        writer[i].sock = -1;
+        writer[i].pvt = &wclients[i];
+    }
+
+    for (i = 0; i < nclients; i++) {
+        circs[i].sock = -1;
+        circs[i].pvt = &clients[i];
+        if (benchCircuitConnect(&circs[i], ioc.port) ||
+            benchCreateChan(&circs[i], "bench:img", i)) {
+            testFail("Unable to connect client %u", i);
+            goto done;
+        }
+    }
+    if (drainUntil(circs, clients, nclients, 1, 0, 10.0)) {
+        testFail("Channel creation timeout");
+        goto done;
+    }
+    for (i = 0; i < nclients; i++) {
+        benchEventAdd(&circs[i], DBR_CHAR, NELM, clients[i].sid, i,
+            DBE_VALUE);
+    }
+
+    /* writer[0] fills the array once, then writer[1] only processes
+     * the record for each update.  Both writes post an update. */
+    if (benchCircuitConnect(&writer[0], ioc.port) ||
+        benchCreateChan(&writer[0], "bench:img", 0) ||
+        benchCircuitConnect(&writer[1], ioc.port) ||
+        benchCreateChan(&writer[1], "bench:img.PROC", 0) ||
+        drainUntil(writer, wclients, 2, 1, 0, 10.0)) {
+        testFail("Unable to connect writers");
+        goto done;
+    }
+
+    benchCircuitSend(&writer[0], CA_PROTO_WRITE, DBR_CHAR, NELM,
+        wclients[0].sid, 0, expected, NELM);
+    if (drainUntil(circs, clients, nclients, 0, 1, 30.0)) {
+        testFail("Initial update timeout");
+        goto done;
+    }
+
+    bad = countBad(clients, nclients);
+    cpu0 = benchIocCpuSeconds(&ioc);
+    t0 = benchNow();
+
+    for (i = 0; i < NUPDATES; i++) {
+        benchCircuitSend(&writer[1], CA_PROTO_WRITE, DBR_LONG, 1,
+            wclients[1].sid, 0, &one, sizeof(one));
+        if (drainUntil(circs, clients, nclients, 0, i + 2, 30.0)) {
+            testFail("Update timeout");
+            goto done;
+        }
+    }
+
+    t1 = benchNow();
+    cpu1 = benchIocCpuSeconds(&ioc);
+    bad = countBad(clients, nclients) - bad;
+    mbytes = (double) nclients * NUPDATES * NELM / 1e6;
+
+    testOk(bad == 0, "%u clients, %s, all updates intact", nclients, mode);
+    testDiag("  %.0f MB in %.3f sec, %.1f MB/sec",
+        mbytes, t1 - t0, mbytes / (t1 - t0));
+    testDiag("  IOC CPU %.3f sec, %.2f msec per client update",
+        cpu1 - cpu0, (cpu1 - cpu0) * 1e3 / (nclients * NUPDATES));
+
+done:
+    for (i = 0; i < NELEMENTS(writer); i++) {
+        benchCircuitClose(&writer[i]);
+    }
+    for (i = 0; i < nclients; i++) {
+        benchCircuitClose(&circs[i]);
+    }
+    free(circs);
+    free(clients);
+    benchIocStop(&ioc);
+}
+
+MAIN(benchRsrvArrays)
+{
+    unsigned counts[16] = {4};
+    unsigned ncounts = 1, i;
+    const char *env = getenv("RSRV_BENCH_CLIENTS");
+
+    benchIocMain(atIocInit);
+
+    if (env) {
+        char *end;
+        ncounts = 0;
+        while (*env && ncounts < NELEMENTS(counts)) {
+            counts[ncounts++] = strtoul(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+#ifndef __linux__
+    testSkip(1, "Only implemented for Linux");
+#else
+    expected = malloc(NELM);
+    if (!expected)
+        testAbort("Out of memory");
+    for (i = 0; i < NELM; i++) {
+        expected[i] = (char) (i * 7u + (i >> 12));
+    }
+
+    /* the copying path needs send buffers big enough for the array */
+    epicsEnvSet("EPICS_CA_MAX_ARRAY_BYTES", "5000000");
+
+    for (i = 0; i < ncounts; i++) {
+        runBench(counts[i], 0);
+        runBench(counts[i], 1);
+    }
+    free(expected);
+#endif
+    return testDone();
+}
@@ -0,0 +1,241 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure IOC thread count and CPU time per delivered monitor update
+ * with many CA clients, for both the thread per client RSRV and the
+ * reactor (casReactorThreads) mode.
+ *
+ * Client counts default to 1000, 5000 and 10000, and may be overridden
+ * with a comma separated list in $RSRV_BENCH_CLIENTS.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsThread.h"
+#include "caProto.h"
+#include "db_access.h"
+#include "caeventmask.h"
+
+#include "rsrvBench.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NUPDATES 100
+
+typedef struct {
+    int created;
+    int subscribed;
+    epicsUInt32 sid;
+    epicsInt32 last;
+    unsigned long nupdates;
+} benchClient;
+
+static void onMsg(benchCircuit *circ, const benchMsg *msg)
+{
+    benchClient *client = (benchClient *) circ->pvt;
+
+    if (msg->cmmd == CA_PROTO_CREATE_CHAN) {
+        client->sid = msg->available;
+        client->created = 1;
+    }
+    else if (msg->cmmd == CA_PROTO_EVENT_ADD && msg->postsize >= 4) {
+        epicsInt32 val;
+        memcpy(&val, msg->payload, sizeof(val));
+        client->last = (epicsInt32) ntohl((epicsUInt32) val);
+        client->subscribed = 1;
+        client->nupdates++;
+    }
+}
+
+/* read from every circuit until pred() holds for all of them */
+static int drainUntil(benchCircuit *circs, benchClient *clients,
+    unsigned n, int (*pred)(const benchClient *, epicsInt32),
+    epicsInt32 arg, double timeout)
+{
+    double deadline = benchNow() + timeout;
+
+    while (benchNow() < deadline) {
+        unsigned i, ndone = 0;
+        for (i = 0; i < n; i++) {
+            if (benchCircuitRead(&circs[i], onMsg) < 0)
+                return -1;
+            ndone += (*pred)(&clients[i], arg);
+        }
+        if (ndone == n)
+            return 0;
+        epicsThreadSleep(0.001);
+    }
+    return -1;
+}
+
+static int isCreated(const benchClient *c, epicsInt32 arg)
+{
+    return c->created;
+}
+
+static int isSubscribed(const benchClient *c, epicsInt32 arg)
+{
+    return c->subscribed;
+}
+
+static int hasValue(const benchClient *c, epicsInt32 arg)
+{
+    return c->last == arg;
+}
+
+static void runBench(unsigned nclients, int nreactors)
+{
+    benchIoc ioc;
+    char cmds[64];
+    benchCircuit *circs, writer;
+    benchClient *clients;
+    unsigned i, connected = 0;
+    unsigned long delivered = 0;
+    double cpu0, cpu1, t0, t1;
+    int threads;
+
+    testDiag("%u clients, %s", nclients,
+        nreactors ? "reactor" : "thread per client");
+    if (nreactors)
+        testDiag("casReactorThreads = %d", nreactors);
+
+    sprintf(cmds, "var casReactorThreads %d", nreactors);
+    if (benchIocStart(&ioc, "benchRsrvClients.db", NULL, cmds)) {
+        testFail("Unable to start IOC");
+        return;
+    }
+
+    circs = calloc(nclients, sizeof(*circs));
+    clients = calloc(nclients, sizeof(*clients));
+    if (!circs || !clients) {
+        testAbort("Out of memory");
+    }
+
+    for (i = 0; i < nclients; i++) {
+        circs[i].sock = -1;
+        if (benchCircuitConnect(&circs[i], ioc.port))
+            break;
+        circs[i].pvt = &clients[i];
+        if (benchCreateChan(&circs[i], "bench:x", i))
+            break;
+        connected++;
+    }
+    if (connected < nclients) {
+        testDiag("Only %u clients connected, check the fd limit", connected);
+        nclients = connected;
+    }
+
+    if (drainUntil(circs, clients, nclients, isCreated, 0, 60.0)) {
+        testFail("Channel creation timeout");
+        goto done;
+    }
+    for (i = 0; i < nclients; i++) {
+        benchEventAdd(&circs[i], DBR_LONG, 1, clients[i].sid, i, DBE_VALUE);
+    }
+    if (drainUntil(circs, clients, nclients, isSubscribed, 0, 60.0)) {
+        testFail("Subscription timeout");
+        goto done;
+    }
+    for (i = 0; i < nclients; i++) {
+        clients[i].nupdates = 0;
+    }
+
+    if (benchCircuitConnect(&writer, ioc.port) ||
+        benchCreateChan(&writer, "bench:x", 0)) {
+        testFail("Unable to connect writer");
+        goto done;
+    }
+    {
+        benchClient wclient;
+        memset(&wclient, 0, sizeof(wclient));
+        writer.pvt = &wclient;
+        if (drainUntil(&writer, &wclient, 1, isCreated, 0, 10.0)) {
+            testFail("Writer channel creation timeout");
+            goto done;
+        }
+
+        threads = benchIocThreads(&ioc);
+        cpu0 = benchIocCpuSeconds(&ioc);
+        t0 = benchNow();
+
+        for (i = 1; i <= NUPDATES; i++) {
+            epicsInt32 val = htonl(i);
+            benchCircuitSend(&writer, CA_PROTO_WRITE, DBR_LONG, 1,
+                wclient.sid, i, &val, sizeof(val));
+            benchCircuitRead(&writer, NULL);
+            drainUntil(circs, clients, nclients, hasValue, 0, 0.0);
+        }
+    }
+
+    if (drainUntil(circs, clients, nclients, hasValue, NUPDATES, 60.0))
+        testDiag("Not all clients received the final update");
+
+    t1 = benchNow();
+    cpu1 = benchIocCpuSeconds(&ioc);
+
+    for (i = 0; i < nclients; i++) {
+        delivered += clients[i].nupdates;
+    }
+
+    testPass("%u clients, %s", nclients,
+        nreactors ? "reactor" : "thread per client");
+    testDiag("  IOC threads      %d", threads);
+    testDiag("  updates          %lu delivered in %.3f sec",
+        delivered, t1 - t0);
+    testDiag("  IOC CPU          %.3f sec, %.2f usec per update",
+        cpu1 - cpu0, delivered ? (cpu1 - cpu0) * 1e6 / delivered : 0.0);
+
+    benchCircuitClose(&writer);
+done:
+    for (i = 0; i < nclients; i++) {
+        benchCircuitClose(&circs[i]);
+    }
+    free(circs);
+    free(clients);
+    benchIocStop(&ioc);
+}
+
+MAIN(benchRsrvClients)
+{
+    unsigned counts[16] = {1000, 5000, 10000};
+    unsigned ncounts = 3, i, maxcount = 0;
+    const char *env = getenv("RSRV_BENCH_CLIENTS");
+
+    benchIocMain(NULL);
+
+    if (env) {
+        char *end;
+        ncounts = 0;
+        while (*env && ncounts < NELEMENTS(counts)) {
+            counts[ncounts++] = strtoul(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+#ifndef __linux__
+    testSkip(1, "Only implemented for Linux");
+#else
+    for (i = 0; i < ncounts; i++) {
+        if (counts[i] > maxcount)
+            maxcount = counts[i];
+    }
+    testDiag("File descriptor limit %lu",
+        benchRaiseFdLimit(2 * maxcount + 64));
+
+    for (i = 0; i < ncounts; i++) {
+        runBench(counts[i], 0);
+        runBench(counts[i], 4);
+    }
+#endif
+    return testDone();
+}
@@ -0,0 +1,291 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Replay a search storm, like that after a site wide power failure,
+ * against an IOC with 200k PVs.  100k UDP name searches, half of them
+ * for names the IOC doesn't have, are sent as fast as possible from a
+ * number of client sockets.  Unanswered searches are repeated until
+ * every existing name has been found.
+ *
+ * Compares receiving one datagram at a time, batched receive and send
+ * (casSearchBatch), and additional search threads (casSearchThreads).
+ *
+ * The number of PVs may be overridden with $RSRV_BENCH_PVS.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsThread.h"
+
+#include "rsrvBench.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NSEARCHES   100000
+#define PERDG       4       /* searches per datagram */
+#define NSOCKS      16      /* client source ports */
+#define MAXROUNDS   20
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#define CA_MINOR_PROTOCOL_REVISION 13
+#include "caProto.h"
+
+static const char *dbFile = "benchRsrvSearchGen.db";
+
+static unsigned npvs = 200000;
+static unsigned *pvIndex;       /* PV searched for, >= npvs is missing */
+static char *answered;
+static unsigned long nfalse;
+
+static int writeDb(void)
+{
+    FILE *fp = fopen(dbFile, "w");
+    unsigned i;
+
+    if (!fp)
+        return -1;
+    for (i = 0; i < npvs; i++) {
+        fprintf(fp, "record(x, \"bench:pv%u\") {}\n", i);
+    }
+    return fclose(fp);
+}
+
+static char *appendHdr(char *p, unsigned cmmd, unsigned postsize,
+    unsigned dataType, unsigned count, epicsUInt32 cid, epicsUInt32 avail)
+{
+    caHdr hdr;
+
+    hdr.m_cmmd = htons(cmmd);
+    hdr.m_postsize = htons(postsize);
+    hdr.m_dataType = htons(dataType);
+    hdr.m_count = htons(count);
+    hdr.m_cid = htonl(cid);
+    hdr.m_available = htonl(avail);
+    memcpy(p, &hdr, sizeof(hdr));
+    return p + sizeof(hdr);
+}
+
+/* returns the number of searches answered */
+static unsigned long drainReplies(const int *socks)
+{
+    unsigned long nfound = 0;
+    unsigned i;
+
+    for (i = 0; i < NSOCKS; i++) {
+        char buf[MAX_UDP_RECV];
+        ssize_t n;
+
+        while ((n = recv(socks[i], buf, sizeof(buf), MSG_DONTWAIT)) > 0) {
+            const char *p = buf;
+
+            while (p + sizeof(caHdr) <= buf + n) {
+                caHdr hdr;
+                epicsUInt32 cid;
+
+                memcpy(&hdr, p, sizeof(hdr));
+                p += sizeof(hdr) + ntohs(hdr.m_postsize);
+                if (ntohs(hdr.m_cmmd) != CA_PROTO_SEARCH)
+                    continue;
+                cid = ntohl(hdr.m_available);
+                if (cid >= NSEARCHES || pvIndex[cid] >= npvs) {
+                    nfalse++;
+                }
+                else if (!answered[cid]) {
+                    answered[cid] = 1;
+                    nfound++;
+                }
+            }
+        }
+    }
+    return nfound;
+}
+
+/* kernel wide UDP receive buffer overflows */
+static unsigned long udpRcvbufErrors(void)
+{
+    char line[512], vals[512];
+    unsigned long errs = 0;
+    FILE *fp = fopen("/proc/net/snmp", "r");
+
+    if (!fp)
+        return 0;
+    while (fgets(line, sizeof(line), fp)) {
+        if (strncmp(line, "Udp:", 4) == 0 && fgets(vals, sizeof(vals), fp)) {
+            /* InDatagrams NoPorts InErrors OutDatagrams RcvbufErrors */
+            sscanf(vals, "Udp: %*u %*u %*u %*u %lu", &errs);
+            break;
+        }
+    }
+    fclose(fp);
+    return errs;
+}
+
+static void runBench(const char *mode, const char *cmds, unsigned nhits)
+{
+    benchIoc ioc;
+    struct sockaddr_in dest;
+    int socks[NSOCKS];
+    unsigned i, round;
+    unsigned long found = 0, firstRound = 0, ndgrams = 0, drops;
+    double cpu0, cpu1, t0, t1;
+
+    testDiag("%s: %s", mode, cmds);
+
+    if (benchIocStart(&ioc, dbFile, NULL, cmds)) {
+        testFail("Unable to start IOC");
+        return;
+    }
+
+    memset(&dest, 0, sizeof(dest));
+    dest.sin_family = AF_INET;
+    dest.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    dest.sin_port = htons(ioc.port);
+
+    for (i = 0; i < NSOCKS; i++) {
+        int size = 4 * 1024 * 1024;
+
+        socks[i] = socket(AF_INET, SOCK_DGRAM, 0);
+        if (socks[i] < 0)
+            testAbort("Unable to create socket");
+        setsockopt(socks[i], SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+    }
+
+    memset(answered, 0, NSEARCHES);
+    nfalse = 0;
+    drops = udpRcvbufErrors();
+    cpu0 = benchIocCpuSeconds(&ioc);
+    t0 = benchNow();
+
+    for (round = 1; round <= MAXROUNDS && found < nhits; round++) {
+        double quiet;
+        unsigned next = 0;
+
+        while (next < NSEARCHES) {
+            char dg[MAX_UDP_SEND], *p = dg;
+            unsigned nnames = 0;
+            int sock = socks[ndgrams % NSOCKS];
+
+            p = appendHdr(p, CA_PROTO_VERSION, 0, 0,
+                CA_MINOR_PROTOCOL_REVISION, (epicsUInt32) ndgrams, 0);
+            for (; next < NSEARCHES && nnames < PERDG; next++) {
+                char name[32];
+                size_t len;
+
+                if (answered[next])
+                    continue;
+                len = sprintf(name, "bench:pv%u", pvIndex[next]) + 1;
+                len = (len + 7u) & ~7u;
+                memset(name + strlen(name), 0, len - strlen(name));
+                p = appendHdr(p, CA_PROTO_SEARCH, len, DONTREPLY,
+                    CA_MINOR_PROTOCOL_REVISION, next, next);
+                memcpy(p, name, len);
+                p += len;
+                nnames++;
+            }
+            if (!nnames)
+                break;
+
+            while (sendto(sock, dg, p - dg, 0,
+                    (struct sockaddr *) &dest, sizeof(dest)) < 0) {
+                if (errno != EAGAIN && errno != ENOBUFS && errno != EINTR)
+                    testAbort("UDP send failed: %s", strerror(errno));
+                found += drainReplies(socks);
+            }
+            if (++ndgrams % 64u == 0u)
+                found += drainReplies(socks);
+        }
+
+        /* collect replies until there are no more for a while */
+        quiet = benchNow() + 0.25;
+        while (benchNow() < quiet && found < nhits) {
+            unsigned long n = drainReplies(socks);
+            found += n;
+            if (n)
+                quiet = benchNow() + 0.25;
+            else
+                epicsThreadSleep(0.001);
+        }
+        if (round == 1)
+            firstRound = found;
+    }
+
+    t1 = benchNow();
+    cpu1 = benchIocCpuSeconds(&ioc);
+    drops = udpRcvbufErrors() - drops;
+
+    testOk(found == nhits && nfalse == 0,
+        "%s, found %lu of %u names, %lu false replies",
+        mode, found, nhits, nfalse);
+    testDiag("  %.1f%% found by the first round, all after %u round%s",
+        100.0 * firstRound / nhits, round - 1, round == 2 ? "" : "s");
+    testDiag("  %lu datagrams sent, %lu UDP receive buffer overflows",
+        ndgrams, drops);
+    testDiag("  %.3f sec, IOC CPU %.3f sec, %.2f usec per datagram",
+        t1 - t0, cpu1 - cpu0, (cpu1 - cpu0) * 1e6 / ndgrams);
+
+    for (i = 0; i < NSOCKS; i++) {
+        close(socks[i]);
+    }
+    benchIocStop(&ioc);
+}
+
+#endif /* __linux__ */
+
+MAIN(benchRsrvSearch)
+{
+    benchIocMain(NULL);
+
+    testPlan(0);
+#ifndef __linux__
+    testSkip(1, "Only implemented for Linux");
+#else
+    {
+        unsigned i, nhits = 0;
+        epicsUInt32 seed = 12345u;
+        const char *env = getenv("RSRV_BENCH_PVS");
+
+        if (env)
+            npvs = strtoul(env, NULL, 10);
+
+        pvIndex = malloc(NSEARCHES * sizeof(*pvIndex));
+        answered = malloc(NSEARCHES);
+        if (!pvIndex || !answered)
+            testAbort("Out of memory");
+        for (i = 0; i < NSEARCHES; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            pvIndex[i] = (seed >> 8) % (2u * npvs);
+            nhits += pvIndex[i] < npvs;
+        }
+
+        if (writeDb())
+            testAbort("Unable to write %s", dbFile);
+
+        runBench("one at a time", "var casSearchBatch 0", nhits);
+        runBench("batched", "var casSearchBatch 32", nhits);
+        runBench("batched, 4 threads",
+            "var casSearchBatch 32;var casSearchThreads 4", nhits);
+
+        remove(dbFile);
+        free(pvIndex);
+        free(answered);
+    }
+#endif
+    return testDone();
+}
@@ -0,0 +1,135 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure connecting many CA links, from when iocInit lets the workers run
+ * until all are connected, then putting through all of them until the puts have been
+ * sent, with different numbers of dbCa worker threads.  The numbers of
+ * workers may be overridden with a comma separated list in
+ * $CA_BENCH_WORKERS.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#define EPICS_DBCA_PRIVATE_API
+
+#include "dbDefs.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "errlog.h"
+#include "initHooks.h"
+#include "dbAccess.h"
+#include "dbCa.h"
+#include "dbCaTest.h"
+#include "dbLink.h"
+#include "dbUnitTest.h"
+
+#include "xRecord.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NRUNS   3
+#define NLINKS  5000
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static xRecord *psrc[NLINKS];
+static epicsUInt64 tRun;
+
+static void initHook(initHookState state)
+{
+    if (state == initHookAtIocRun)
+        tRun = epicsMonotonicGet();
+}
+
+static void runOnce(unsigned workers, double *pconnect, double *pput)
+{
+    epicsUInt64 t0;
+    unsigned i;
+    int chans, discon;
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    for (i = 0; i < NLINKS; i++) {
+        char buf[20];
+
+        sprintf(buf, "N=%u", i);
+        testdbReadDatabase("dbCaLinkTest4.db", NULL, buf);
+        sprintf(buf, "source%u", i);
+        psrc[i] = (xRecord *) testdbRecordPtr(buf);
+    }
+
+    initHookRegister(initHook);
+    dbCaWorkers = workers;
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+    dbCaWorkers = 1;
+    do {
+        dbcaStats(&chans, &discon);
+        if (discon)
+            epicsThreadSleep(0.001);
+    } while (discon);
+    *pconnect = (epicsMonotonicGet() - tRun) * 1e-6;
+
+    t0 = epicsMonotonicGet();
+    for (i = 0; i < NLINKS; i++) {
+        epicsInt32 val = i;
+
+        dbScanLock((dbCommon *) psrc[i]);
+        dbPutLink(&psrc[i]->lnk, DBR_LONG, &val, 1);
+        dbScanUnlock((dbCommon *) psrc[i]);
+    }
+    dbCaSync();
+    *pput = (epicsMonotonicGet() - t0) * 1e-6;
+
+    testIocShutdownOk();
+    testdbCleanup();
+}
+
+static void runBench(unsigned workers)
+{
+    double connect = 0.0, put = 0.0;
+    unsigned run;
+
+    for (run = 0; run < NRUNS; run++) {
+        double c, p;
+
+        runOnce(workers, &c, &p);
+        if (run == 0 || c < connect)
+            connect = c;
+        if (run == 0 || p < put)
+            put = p;
+    }
+    testDiag("%d links, %2u workers: connect %8.3f msec, put %8.3f msec",
+        NLINKS, workers, connect, put);
+}
+
+MAIN(benchdbCaWorkers)
+{
+    unsigned workers[16] = { 1, 2, 4 };
+    unsigned nWorkers = 3, i;
+    const char *env = getenv("CA_BENCH_WORKERS");
+
+    if (env) {
+        char *end;
+
+        nWorkers = 0;
+        while (*env && nWorkers < NELEMENTS(workers)) {
+            workers[nWorkers++] = strtoul(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+    for (i = 0; i < nWorkers; i++)
+        runBench(workers[i]);
+    return testDone();
+}
@@ -0,0 +1,155 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure the array conversions done by dbGet() and dbPut() between
+ * numeric field and request types, also reading a ring buffer from the
+ * middle so it wraps.  The array lengths may be overridden with a comma
+ * separated list in $CONVERT_BENCH_ELEMENTS.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "cantProceed.h"
+#include "dbDefs.h"
+#include "epicsTime.h"
+#include "epicsTypes.h"
+#include "dbAddr.h"
+#include "dbConvert.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NRUNS 5
+
+static void *src, *dst;
+
+static void fill(short type, long n)
+{
+    long i;
+
+    for (i = 0; i < n; i++) {
+        int v = i % 1000;
+
+        switch (type) {
+        case DBF_UCHAR:  ((epicsUInt8 *) src)[i] = (epicsUInt8) v; break;
+        case DBF_SHORT:  ((epicsInt16 *) src)[i] = (epicsInt16) v; break;
+        case DBF_LONG:   ((epicsInt32 *) src)[i] = v; break;
+        case DBF_FLOAT:  ((epicsFloat32 *) src)[i] = (epicsFloat32) v; break;
+        case DBF_DOUBLE: ((epicsFloat64 *) src)[i] = v; break;
+        }
+    }
+}
+
+static const char *dbfName(short type)
+{
+    switch (type) {
+    case DBF_UCHAR:  return "UCHAR";
+    case DBF_SHORT:  return "SHORT";
+    case DBF_LONG:   return "LONG";
+    case DBF_FLOAT:  return "FLOAT";
+    case DBF_DOUBLE: return "DOUBLE";
+    }
+    return "?";
+}
+
+static void benchGet(short from, short to, long n, long offset)
+{
+    /* the DBR_ codes of numeric types are the same as their DBF_ codes */
+    GETCONVERTFUNC get = dbGetConvertRoutine[from][to];
+    dbAddr addr;
+    double best = 0.0;
+    int run;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.field_type = from;
+    addr.no_elements = n;
+    addr.pfield = src;
+    fill(from, n);
+
+    for (run = 0; run < NRUNS; run++) {
+        epicsUInt64 t0 = epicsMonotonicGet();
+        double dt;
+
+        get(&addr, dst, n, n, offset);
+        dt = (double) (epicsMonotonicGet() - t0) / n;
+        if (run == 0 || dt < best)
+            best = dt;
+    }
+    testDiag("  get %-6s -> %-6s%s %6.3f nsec/element",
+        dbfName(from), dbfName(to), offset ? " wrapped" : "        ", best);
+}
+
+static void benchPut(short from, short to, long n)
+{
+    PUTCONVERTFUNC put = dbPutConvertRoutine[from][to];
+    dbAddr addr;
+    double best = 0.0;
+    int run;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.field_type = to;
+    addr.no_elements = n;
+    addr.pfield = dst;
+    fill(from, n);
+
+    for (run = 0; run < NRUNS; run++) {
+        epicsUInt64 t0 = epicsMonotonicGet();
+        double dt;
+
+        put(&addr, src, n, n, 0);
+        dt = (double) (epicsMonotonicGet() - t0) / n;
+        if (run == 0 || dt < best)
+            best = dt;
+    }
+    testDiag("  put %-6s -> %-6s         %6.3f nsec/element",
+        dbfName(from), dbfName(to), best);
+}
+
+static void runBench(long n)
+{
+    src = callocMustSucceed(n, sizeof(epicsFloat64), "benchdbConvertArrays");
+    dst = callocMustSucceed(n, sizeof(epicsFloat64), "benchdbConvertArrays");
+
+    testDiag("%ld elements", n);
+    benchGet(DBF_SHORT, DBF_DOUBLE, n, 0);
+    benchGet(DBF_SHORT, DBF_DOUBLE, n, n / 2);
+    benchGet(DBF_UCHAR, DBF_SHORT, n, 0);
+    benchGet(DBF_SHORT, DBF_LONG, n, 0);
+    benchGet(DBF_LONG, DBF_DOUBLE, n, 0);
+    benchGet(DBF_FLOAT, DBF_DOUBLE, n, 0);
+    benchGet(DBF_DOUBLE, DBF_FLOAT, n, 0);
+    benchGet(DBF_DOUBLE, DBF_LONG, n, 0);
+    benchPut(DBF_SHORT, DBF_DOUBLE, n);
+    benchPut(DBF_DOUBLE, DBF_SHORT, n);
+
+    free(src);
+    free(dst);
+}
+
+MAIN(benchdbConvertArrays)
+{
+    long counts[16] = { 1000, 2000000 };
+    unsigned nCounts = 2, i;
+    const char *env = getenv("CONVERT_BENCH_ELEMENTS");
+
+    if (env) {
+        char *end;
+
+        nCounts = 0;
+        while (*env && nCounts < NELEMENTS(counts)) {
+            counts[nCounts++] = strtol(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+    for (i = 0; i < nCounts; i++)
+        runBench(counts[i]);
+    return testDone();
+}
@@ -0,0 +1,172 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure the cost of posting updates to subscriptions sharing an event
+ * queue, and of the event task delivering them, with the event task at a
+ * lower priority than the posting thread (so updates pile up and are
+ * drained together) and at a higher one (so each is delivered as soon as
+ * it is posted).  The burst sizes may be overridden with a comma separated
+ * list in $QUEUE_BENCH_BURSTS.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "caeventmask.h"
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "dbLock.h"
+#include "dbUnitTest.h"
+
+#include "xRecord.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NSUBS       4
+#define NUPDATES    100000
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static xRecord *prec;
+static size_t ndelivered;
+static epicsUInt64 tLast;
+
+static void onUpdate(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    epicsAtomicIncrSizeT(&ndelivered);
+    if (!eventsRemaining)
+        tLast = epicsMonotonicGet();
+}
+
+typedef struct {
+    unsigned burst;
+    epicsUInt64 tPost, tDrain;
+} postArgs;
+
+static void postTask(void *arg)
+{
+    postArgs *pargs = arg;
+    size_t expect = 0;
+    int i = 0;
+
+    pargs->tPost = pargs->tDrain = 0;
+    while (i < NUPDATES) {
+        epicsUInt64 t0 = epicsMonotonicGet(), t1;
+        unsigned j;
+
+        for (j = 0; j < pargs->burst; j++, i++) {
+            dbScanLock((dbCommon *) prec);
+            prec->val = i;
+            db_post_events(prec, &prec->val, DBE_VALUE);
+            dbScanUnlock((dbCommon *) prec);
+        }
+        t1 = epicsMonotonicGet();
+        pargs->tPost += t1 - t0;
+
+        /* let the event task deliver the burst */
+        expect += (size_t) pargs->burst * NSUBS;
+        while (epicsAtomicGetSizeT(&ndelivered) < expect)
+            epicsThreadSleep(0.001);
+        if (tLast > t1)
+            pargs->tDrain += tLast - t1;
+    }
+}
+
+static void runBench(unsigned burst, unsigned evPriority)
+{
+    dbEventCtx ctx;
+    dbChannel *chans[NSUBS];
+    dbEventSubscription subs[NSUBS];
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    postArgs args;
+    int i;
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("xRecord.db", NULL, NULL);
+    testIocInitOk();
+
+    prec = (xRecord *) testdbRecordPtr("x");
+    ndelivered = 0;
+    tLast = 0;
+
+    ctx = db_init_events();
+    if (!ctx)
+        testAbort("Can't create event user");
+    for (i = 0; i < NSUBS; i++) {
+        chans[i] = dbChannelCreate("x.VAL");
+        if (!chans[i] || dbChannelOpen(chans[i]))
+            testAbort("Can't open x.VAL");
+        subs[i] = db_add_event(ctx, chans[i], onUpdate, NULL, DBE_VALUE);
+        /* room for a whole burst, so nothing is replaced */
+        if (!subs[i] || db_event_queue_entries(subs[i], burst + 1))
+            testAbort("Can't subscribe");
+        db_event_enable(subs[i]);
+    }
+    db_start_events(ctx, "benchEv", NULL, NULL, evPriority);
+
+    args.burst = burst;
+    opts.joinable = 1;
+    opts.priority = epicsThreadPriorityScanLow;
+    epicsThreadMustJoin(epicsThreadCreateOpt("benchPost", postTask, &args,
+        &opts));
+
+    testOk(ndelivered == (size_t) NUPDATES * NSUBS,
+        "%u updates in bursts of %u, event task %s the poster: "
+        "%lu delivered", NUPDATES, burst,
+        evPriority > epicsThreadPriorityScanLow ? "above" : "below",
+        (unsigned long) ndelivered);
+    if (evPriority > epicsThreadPriorityScanLow)
+        testDiag("  post and deliver %6.1f nsec/update",
+            args.tPost / ((double) NUPDATES * NSUBS));
+    else
+        testDiag("  post %6.1f nsec/update, deliver %6.1f nsec/update",
+            args.tPost / ((double) NUPDATES * NSUBS),
+            args.tDrain / ((double) NUPDATES * NSUBS));
+
+    for (i = 0; i < NSUBS; i++) {
+        db_cancel_event(subs[i]);
+        dbChannelDelete(chans[i]);
+    }
+    db_close_events(ctx);
+
+    testIocShutdownOk();
+    testdbCleanup();
+}
+
+MAIN(benchdbEventQueue)
+{
+    unsigned bursts[16] = { 1, 10, 100, 1000 };
+    unsigned nBursts = 4, i;
+    const char *env = getenv("QUEUE_BENCH_BURSTS");
+
+    if (env) {
+        char *end;
+
+        nBursts = 0;
+        while (*env && nBursts < NELEMENTS(bursts)) {
+            bursts[nBursts++] = strtoul(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+    for (i = 0; i < nBursts; i++) {
+        runBench(bursts[i], epicsThreadPriorityCAServerLow);
+        runBench(bursts[i], epicsThreadPriorityScanHigh);
+    }
+    return testDone();
+}
@@ -0,0 +1,210 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure the processing time of a 1 MB array record and the updates
+ * lost by 1, 10 and 50 subscribers to it, with field logs referring to
+ * the record (dbEventSnapshotMinBytes = 0) and with one snapshot of each
+ * update shared by all the subscribers.
+ *
+ * Every subscriber has its own event task and reads each update the way
+ * RSRV does, through dbChannel_get_count().  The subscriber counts may be
+ * overridden with a comma separated list in $EVENT_BENCH_SUBSCRIBERS.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "caeventmask.h"
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "dbLock.h"
+#include "db_access_routines.h"
+#include "dbUnitTest.h"
+
+#include "arrRecord.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+/* from db_access.h, which can't be included with dbAccess.h */
+#define oldDBR_LONG 5
+
+#define NELM        (256 * 1024)
+#define NUPDATES    500
+#define PERIOD      0.002
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+typedef struct {
+    dbEventCtx ctx;
+    dbChannel *chan;
+    dbEventSubscription sub;
+    epicsInt32 *buf;
+    int last;
+    unsigned long nupdates;
+    unsigned long ntorn;
+} subscriber;
+
+static arrRecord *prec;
+static epicsUInt64 tProcess, tMax;
+
+/* arr records don't post monitors themselves */
+static void postArray(struct arrRecord *prec)
+{
+    db_post_events(prec, &prec->val, DBE_VALUE | DBE_LOG);
+}
+
+static void onUpdate(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    subscriber *psub = user_arg;
+    long n = NELM;
+
+    if (dbChannel_get_count(chan, oldDBR_LONG, psub->buf, &n, pfl) ||
+            n != NELM)
+        return;
+    /* both ends are written with each update */
+    if (psub->buf[0] != psub->buf[NELM - 1])
+        psub->ntorn++;
+    else if (psub->buf[0] > psub->last) {
+        psub->last = psub->buf[0];
+        psub->nupdates++;
+    }
+}
+
+/* Process the record at a scan thread's priority */
+static void scanTask(void *arg)
+{
+    epicsInt32 *bptr = prec->bptr;
+    int j;
+
+    tProcess = tMax = 0;
+    for (j = 1; j <= NUPDATES; j++) {
+        epicsUInt64 t0 = epicsMonotonicGet(), dt;
+
+        dbScanLock((dbCommon *) prec);
+        bptr[0] = bptr[NELM - 1] = j;
+        memset(bptr + 1, j, (NELM - 2) * sizeof(epicsInt32));
+        prec->nord = NELM;
+        dbProcess((dbCommon *) prec);
+        dbScanUnlock((dbCommon *) prec);
+        dt = epicsMonotonicGet() - t0;
+        tProcess += dt;
+        if (dt > tMax)
+            tMax = dt;
+        epicsThreadSleep(PERIOD);
+    }
+}
+
+static void runBench(unsigned nsubs, int minBytes)
+{
+    subscriber *subs = calloc(nsubs, sizeof(*subs));
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    epicsUInt64 t0;
+    unsigned long nupdates = 0, ntorn = 0, nlost;
+    unsigned i;
+
+    testDiag("%u subscriber%s, dbEventSnapshotMinBytes = %d", nsubs,
+        nsubs > 1 ? "s" : "", minBytes);
+
+    if (!subs)
+        testAbort("Out of memory");
+    dbEventSnapshotMinBytes = minBytes;
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("benchdbEventSnapshot.db", NULL, NULL);
+    testIocInitOk();
+
+    prec = (arrRecord *) testdbRecordPtr("bench:wf");
+    prec->clbk = &postArray;
+
+    for (i = 0; i < nsubs; i++) {
+        subscriber *psub = &subs[i];
+
+        psub->buf = malloc(NELM * sizeof(epicsInt32));
+        psub->ctx = db_init_events();
+        psub->chan = dbChannelCreate("bench:wf");
+        if (!psub->buf || !psub->ctx || !psub->chan ||
+                dbChannelOpen(psub->chan))
+            testAbort("Can't subscribe");
+        db_start_events(psub->ctx, "benchEv", NULL, NULL,
+            epicsThreadPriorityCAServerLow);
+        psub->sub = db_add_event(psub->ctx, psub->chan, onUpdate, psub,
+            DBE_VALUE);
+        db_event_enable(psub->sub);
+    }
+
+    opts.joinable = 1;
+    opts.priority = epicsThreadPriorityScanLow;
+    epicsThreadMustJoin(epicsThreadCreateOpt("benchScan", scanTask, NULL,
+        &opts));
+
+    /* let the subscribers catch up with the last update */
+    t0 = epicsMonotonicGet();
+    for (i = 0; i < nsubs; i++) {
+        while (epicsAtomicGetIntT(&subs[i].last) != NUPDATES &&
+                epicsMonotonicGet() - t0 < 10000000000ull)
+            epicsThreadSleep(0.01);
+    }
+
+    for (i = 0; i < nsubs; i++) {
+        subscriber *psub = &subs[i];
+
+        db_cancel_event(psub->sub);
+        db_close_events(psub->ctx);
+        dbChannelDelete(psub->chan);
+        free(psub->buf);
+        nupdates += psub->nupdates;
+        ntorn += psub->ntorn;
+    }
+
+    nlost = (unsigned long) nsubs * NUPDATES - nupdates;
+    testOk(ntorn == 0, "%lu torn updates", ntorn);
+    testDiag("  process %8.1f usec mean, %8.1f usec max, %6.0f updates/sec",
+        tProcess * 1e-3 / NUPDATES, tMax * 1e-3,
+        NUPDATES * 1e9 / tProcess);
+    testDiag("  %lu of %lu updates lost (%.1f%%)", nlost,
+        (unsigned long) nsubs * NUPDATES,
+        nlost * 100.0 / ((double) nsubs * NUPDATES));
+
+    testIocShutdownOk();
+    testdbCleanup();
+    free(subs);
+}
+
+MAIN(benchdbEventSnapshot)
+{
+    unsigned counts[16] = { 1, 10, 50 };
+    unsigned nCounts = 3, i;
+    const char *env = getenv("EVENT_BENCH_SUBSCRIBERS");
+
+    if (env) {
+        char *end;
+
+        nCounts = 0;
+        while (*env && nCounts < NELEMENTS(counts)) {
+            counts[nCounts++] = strtoul(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+    for (i = 0; i < nCounts; i++) {
+        runBench(counts[i], 0);
+        runBench(counts[i], 1024);
+    }
+    return testDone();
+}
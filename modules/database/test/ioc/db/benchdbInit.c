@@ -0,0 +1,106 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure initializing the database in turn and in parallel, for many
+ * records whose device support takes no time, and for fewer records whose
+ * device support waits 1 msec as if setting up I/O.  The numbers of
+ * threads may be overridden with a comma separated list in
+ * $INIT_BENCH_THREADS, 0 initializing the records in turn.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "dbDefs.h"
+#include "epicsTime.h"
+#include "initHooks.h"
+#include "dbAccess.h"
+#include "iocInit.h"
+#include "dbUnitTest.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NRUNS       3
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static epicsUInt64 tStart, tDone;
+
+/* time from before the lock sets are made until after init_record pass 1 */
+static void initHook(initHookState state)
+{
+    if (state == initHookAfterInitDevSup)
+        tStart = epicsMonotonicGet();
+    else if (state == initHookAfterInitDatabase)
+        tDone = epicsMonotonicGet();
+}
+
+static double runInit(unsigned nrecs, unsigned delay, unsigned threads)
+{
+    unsigned i;
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    for (i = 0; i < nrecs; i++) {
+        char macros[40];
+
+        sprintf(macros, "N=%u,D=%u", i, delay);
+        testdbReadDatabase("benchdbInit.db", NULL, macros);
+    }
+    if (dbInitThreadSafe("x", NULL) || dbInitThreadSafe("x", "Init Thread"))
+        testAbort("Can't declare x records thread-safe");
+
+    initHookRegister(initHook);
+    dbInitThreads = threads;
+    testIocInitOk();
+    dbInitThreads = 0;
+    testIocShutdownOk();
+    testdbCleanup();
+    return (tDone - tStart) * 1e-6;
+}
+
+static void runBench(unsigned nrecs, unsigned delay, unsigned threads)
+{
+    double best = 0.0;
+    unsigned run;
+
+    for (run = 0; run < NRUNS; run++) {
+        double dt = runInit(nrecs, delay, threads);
+
+        if (run == 0 || dt < best)
+            best = dt;
+    }
+    testDiag("%6u records taking %4u usec, %2u threads: %9.3f msec",
+        nrecs, delay, threads, best);
+}
+
+MAIN(benchdbInit)
+{
+    unsigned threads[16] = { 0, 1, 4, 16 };
+    unsigned nThreads = 4, i;
+    const char *env = getenv("INIT_BENCH_THREADS");
+
+    if (env) {
+        char *end;
+
+        nThreads = 0;
+        while (*env && nThreads < NELEMENTS(threads)) {
+            threads[nThreads++] = strtoul(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+    for (i = 0; i < nThreads; i++)
+        runBench(20000, 0, threads[i]);
+    for (i = 0; i < nThreads; i++)
+        runBench(1000, 1000, threads[i]);
+    return testDone();
+}
@@ -0,0 +1,102 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure the time taken to lock and unlock a record, and two records in
+ * different lock sets with a dbLocker, when no other thread holds the locks.
+ * Each is measured without and with dbLockHoldTimes set.  The best of
+ * several runs is shown.
+ */
+
+#include "epicsTime.h"
+#include "dbAccess.h"
+#include "dbLock.h"
+#include "dbUnitTest.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NLOCK       1000000
+#define NRUNS       5
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static double benchScanLock(dbCommon *prec)
+{
+    double best = 0.0;
+    int run, i;
+
+    for (run = 0; run < NRUNS; run++) {
+        epicsUInt64 t0 = epicsMonotonicGet();
+        double dt;
+
+        for (i = 0; i < NLOCK; i++) {
+            dbScanLock(prec);
+            dbScanUnlock(prec);
+        }
+        dt = (epicsMonotonicGet() - t0) / (double) NLOCK;
+        if (run == 0 || dt < best)
+            best = dt;
+    }
+    return best;
+}
+
+static double benchLockMany(dbLocker *locker)
+{
+    double best = 0.0;
+    int run, i;
+
+    for (run = 0; run < NRUNS; run++) {
+        epicsUInt64 t0 = epicsMonotonicGet();
+        double dt;
+
+        for (i = 0; i < NLOCK; i++) {
+            dbScanLockMany(locker);
+            dbScanUnlockMany(locker);
+        }
+        dt = (epicsMonotonicGet() - t0) / (double) NLOCK;
+        if (run == 0 || dt < best)
+            best = dt;
+    }
+    return best;
+}
+
+MAIN(benchdbLock)
+{
+    dbCommon *precs[2];
+    dbLocker *locker;
+
+    testPlan(0);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+    testIocInitOk();
+
+    precs[0] = testdbRecordPtr("reca");
+    precs[1] = testdbRecordPtr("recg");
+    locker = dbLockerAlloc(precs, 2, 0);
+    if (!locker)
+        testAbort("dbLockerAlloc() failed");
+
+    for (dbLockHoldTimes = 0; dbLockHoldTimes <= 1; dbLockHoldTimes++) {
+        testDiag("dbLockHoldTimes = %d, best of %d x %d:",
+            dbLockHoldTimes, NRUNS, NLOCK);
+        testDiag("  dbScanLock() and dbScanUnlock()         %6.1f nsec",
+            benchScanLock(precs[0]));
+        testDiag("  dbScanLockMany() and dbScanUnlockMany() %6.1f nsec",
+            benchLockMany(locker));
+    }
+    dbLockHoldTimes = 0;
+
+    dbLockerFree(locker);
+    testIocShutdownOk();
+    testdbCleanup();
+
+    return testDone();
+}
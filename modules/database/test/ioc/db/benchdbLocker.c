@@ -0,0 +1,135 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure locking 2, 16 and 256 records together with a dbLocker, when
+ * each record is in a lock set of its own and when they are all in one
+ * lock set.  A new dbLocker allocated for each lock is compared with
+ * one dbLocker kept and used again.  The record counts may be overridden
+ * with a comma separated list in $LOCKER_BENCH_RECORDS.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "dbDefs.h"
+#include "epicsTime.h"
+#include "dbAccess.h"
+#include "dbLock.h"
+#include "dbUnitTest.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define MAXRECORDS  256
+#define NRUNS       5
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static dbCommon *ind[MAXRECORDS], *chain[MAXRECORDS];
+
+static double benchFresh(dbCommon **precs, unsigned nrecs, unsigned nlock)
+{
+    double best = 0.0;
+    unsigned run, i;
+
+    for (run = 0; run < NRUNS; run++) {
+        epicsUInt64 t0 = epicsMonotonicGet();
+        double dt;
+
+        for (i = 0; i < nlock; i++) {
+            dbLocker *locker = dbLockerAlloc(precs, nrecs, 0);
+
+            dbScanLockMany(locker);
+            dbScanUnlockMany(locker);
+            dbLockerFree(locker);
+        }
+        dt = (epicsMonotonicGet() - t0) / (double) nlock;
+        if (run == 0 || dt < best)
+            best = dt;
+    }
+    return best;
+}
+
+static double benchKept(dbCommon **precs, unsigned nrecs, unsigned nlock)
+{
+    dbLocker *locker = dbLockerAlloc(precs, nrecs, 0);
+    double best = 0.0;
+    unsigned run, i;
+
+    for (run = 0; run < NRUNS; run++) {
+        epicsUInt64 t0 = epicsMonotonicGet();
+        double dt;
+
+        for (i = 0; i < nlock; i++) {
+            dbScanLockMany(locker);
+            dbScanUnlockMany(locker);
+        }
+        dt = (epicsMonotonicGet() - t0) / (double) nlock;
+        if (run == 0 || dt < best)
+            best = dt;
+    }
+    dbLockerFree(locker);
+    return best;
+}
+
+MAIN(benchdbLocker)
+{
+    unsigned counts[16] = { 2, 16, 256 };
+    unsigned nCounts = 3, i;
+    const char *env = getenv("LOCKER_BENCH_RECORDS");
+
+    if (env) {
+        char *end;
+
+        nCounts = 0;
+        while (*env && nCounts < NELEMENTS(counts)) {
+            counts[nCounts] = strtoul(env, &end, 10);
+            if (counts[nCounts] > 0 && counts[nCounts] <= MAXRECORDS)
+                nCounts++;
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    for (i = 0; i < MAXRECORDS; i++) {
+        char macros[40];
+
+        sprintf(macros, "N=%u,P=%u", i, i ? i - 1 : 0);
+        testdbReadDatabase("benchdbLocker.db", NULL, macros);
+    }
+    testIocInitOk();
+
+    for (i = 0; i < MAXRECORDS; i++) {
+        char name[20];
+
+        sprintf(name, "ind%u", i);
+        ind[i] = testdbRecordPtr(name);
+        sprintf(name, "chain%u", i);
+        chain[i] = testdbRecordPtr(name);
+    }
+
+    testDiag("Lock and unlock, best of %d runs, nsec:", NRUNS);
+    testDiag("%8s %12s %12s %12s %12s", "records",
+        "own: new", "own: kept", "one: new", "one: kept");
+    for (i = 0; i < nCounts; i++) {
+        unsigned n = counts[i], nlock = 2000000 / n;
+
+        testDiag("%8u %12.1f %12.1f %12.1f %12.1f", n,
+            benchFresh(ind, n, nlock), benchKept(ind, n, nlock),
+            benchFresh(chain, n, nlock), benchKept(chain, n, nlock));
+    }
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    return testDone();
+}
@@ -0,0 +1,157 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure the cost of db_post_events() for a field with one subscriber,
+ * and for a field with none, as the number of subscriptions to the
+ * record's other fields grows.  The counts may be overridden with a comma
+ * separated list in $POST_BENCH_SUBSCRIPTIONS.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "dbDefs.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "caeventmask.h"
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "dbLock.h"
+#include "dbUnitTest.h"
+
+#include "xRecord.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NPOSTS 200000
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static const char * const others[] = {
+    "x.C8", "x.U8", "x.I16", "x.I32", "x.U32", "x.I64", "x.U64",
+    "x.F32", "x.F64", "x.OTST"
+};
+
+static unsigned long nupdates;
+
+static void onUpdate(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    nupdates++;
+}
+
+typedef struct {
+    xRecord *prec;
+    void *pfield;
+    double ns;
+} postArgs;
+
+static void postTask(void *arg)
+{
+    postArgs *pargs = arg;
+    epicsUInt64 t0 = epicsMonotonicGet();
+    int i;
+
+    for (i = 0; i < NPOSTS; i++) {
+        dbScanLock((dbCommon *) pargs->prec);
+        db_post_events(pargs->prec, pargs->pfield, DBE_VALUE | DBE_LOG);
+        dbScanUnlock((dbCommon *) pargs->prec);
+    }
+    pargs->ns = (double) (epicsMonotonicGet() - t0) / NPOSTS;
+}
+
+/* Post from a thread at a scan thread's priority */
+static double nsPerPost(xRecord *prec, void *pfield)
+{
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    postArgs args;
+
+    args.prec = prec;
+    args.pfield = pfield;
+    opts.joinable = 1;
+    opts.priority = epicsThreadPriorityScanLow;
+    epicsThreadMustJoin(epicsThreadCreateOpt("benchPost", postTask, &args,
+        &opts));
+    return args.ns;
+}
+
+static void runBench(unsigned nsubs)
+{
+    dbEventCtx ctx;
+    dbChannel **chans = calloc(nsubs + 1, sizeof(*chans));
+    dbEventSubscription *subs = calloc(nsubs + 1, sizeof(*subs));
+    xRecord *prec;
+    unsigned i;
+
+    if (!chans || !subs)
+        testAbort("Out of memory");
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("xRecord.db", NULL, NULL);
+    testIocInitOk();
+
+    prec = (xRecord *) testdbRecordPtr("x");
+    ctx = db_init_events();
+    db_start_events(ctx, "benchEv", NULL, NULL,
+        epicsThreadPriorityCAServerLow);
+
+    for (i = 0; i <= nsubs; i++) {
+        chans[i] = dbChannelCreate(i == nsubs ? "x.VAL" :
+            others[i % NELEMENTS(others)]);
+        if (!chans[i] || dbChannelOpen(chans[i]))
+            testAbort("Can't subscribe");
+        subs[i] = db_add_event(ctx, chans[i], onUpdate, NULL,
+            DBE_VALUE | DBE_ALARM);
+        db_event_enable(subs[i]);
+    }
+
+    testDiag("%u subscriptions to other fields", nsubs);
+    testDiag("  field with a subscriber    %8.1f ns per post",
+        nsPerPost(prec, &prec->val));
+    testDiag("  field without subscribers  %8.1f ns per post",
+        nsPerPost(prec, &prec->u16));
+
+    for (i = 0; i <= nsubs; i++) {
+        db_cancel_event(subs[i]);
+        dbChannelDelete(chans[i]);
+    }
+    db_close_events(ctx);
+    free(chans);
+    free(subs);
+
+    testIocShutdownOk();
+    testdbCleanup();
+}
+
+MAIN(benchdbPostEvents)
+{
+    unsigned counts[16] = { 0, 10, 100, 1000 };
+    unsigned nCounts = 4, i;
+    const char *env = getenv("POST_BENCH_SUBSCRIPTIONS");
+
+    if (env) {
+        char *end;
+
+        nCounts = 0;
+        while (*env && nCounts < NELEMENTS(counts)) {
+            counts[nCounts++] = strtoul(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+    for (i = 0; i < nCounts; i++) {
+        runBench(counts[i]);
+    }
+    testOk(nupdates > 0, "%lu updates delivered", nupdates);
+    return testDone();
+}
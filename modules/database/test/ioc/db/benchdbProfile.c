@@ -0,0 +1,77 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure the time dbProcess() takes for a record which does nothing,
+ * with the record profiler stopped and running.  The best of several runs
+ * is shown, as the difference being measured is a few nsec.
+ */
+
+#include "epicsTime.h"
+#include "dbAccess.h"
+#include "dbLock.h"
+#include "dbProfile.h"
+#include "dbUnitTest.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NPROCESS    1000000
+#define NRUNS       5
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static double bench(dbCommon *prec)
+{
+    double best = 0.0;
+    int run, i;
+
+    for (run = 0; run < NRUNS; run++) {
+        epicsUInt64 t0 = epicsMonotonicGet();
+        double dt;
+
+        dbScanLock(prec);
+        for (i = 0; i < NPROCESS; i++)
+            dbProcess(prec);
+        dbScanUnlock(prec);
+        dt = (epicsMonotonicGet() - t0) / (double) NPROCESS;
+        if (run == 0 || dt < best)
+            best = dt;
+    }
+    return best;
+}
+
+MAIN(benchdbProfile)
+{
+    dbCommon *prec;
+    double tOff, tOn;
+
+    testPlan(0);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("xRecord.db", NULL, NULL);
+    testIocInitOk();
+
+    prec = testdbRecordPtr("x");
+
+    tOff = bench(prec);
+    dbProfileEnable(1);
+    tOn = bench(prec);
+    dbProfileEnable(0);
+
+    testDiag("dbProcess() of a record doing nothing, best of %d x %d:",
+        NRUNS, NPROCESS);
+    testDiag("  profiler stopped %6.1f nsec", tOff);
+    testDiag("  profiler running %6.1f nsec", tOn);
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    return testDone();
+}
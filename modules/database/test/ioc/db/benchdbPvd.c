@@ -0,0 +1,193 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure process variable directory lookups per second with 10k, 100k
+ * and 1M records, for names which exist and names which don't, and
+ * while another thread adds and deletes records.
+ *
+ * The record counts may be overridden with a comma separated list in
+ * $PVD_BENCH_RECORDS.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "dbAccess.h"
+#include "dbStaticLib.h"
+#include "dbUnitTest.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NLOOKUPS 1000000
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static int stopWriter;
+static size_t nwrites;
+static epicsEventId writerDone;
+
+static double now(void)
+{
+    epicsTimeStamp ts;
+
+    epicsTimeGetCurrent(&ts);
+    return ts.secPastEpoch + ts.nsec * 1e-9;
+}
+
+static long createRecord(DBENTRY *pdbentry, const char *name)
+{
+    long status = dbFindRecordType(pdbentry, "x");
+
+    if (!status)
+        status = dbCreateRecord(pdbentry, name);
+    return status;
+}
+
+/* Returns the number of names found */
+static unsigned long lookups(unsigned nrecords, int missing, double *rate)
+{
+    DBENTRY dbentry;
+    epicsUInt32 seed = 12345u;
+    unsigned long nfound = 0;
+    unsigned i;
+    double t0, t1;
+
+    dbInitEntry(pdbbase, &dbentry);
+    t0 = now();
+    for (i = 0; i < NLOOKUPS; i++) {
+        char name[32];
+
+        seed = seed * 1664525u + 1013904223u;
+        sprintf(name, "bench:pv%u", (seed >> 8) % nrecords +
+            (missing ? nrecords : 0));
+        nfound += dbFindRecord(&dbentry, name) == 0;
+    }
+    t1 = now();
+    dbFinishEntry(&dbentry);
+    *rate = NLOOKUPS / (t1 - t0);
+    return nfound;
+}
+
+/* Add and delete up to 10000 records/sec which aren't looked up.  They
+ * are never initialized, so all are deleted again before iocShutdown().
+ */
+static void writer(void *arg)
+{
+    DBENTRY dbentry;
+    unsigned i = 0;
+
+    dbInitEntry(pdbbase, &dbentry);
+    while (!epicsAtomicGetIntT(&stopWriter)) {
+        char name[32];
+
+        sprintf(name, "bench:new%u", i++ % 1000);
+        if (dbFindRecord(&dbentry, name) == 0)
+            dbDeleteRecord(&dbentry);
+        else
+            createRecord(&dbentry, name);
+        nwrites++;
+        epicsThreadSleep(0.0001);
+    }
+    for (i = 0; i < 1000; i++) {
+        char name[32];
+
+        sprintf(name, "bench:new%u", i);
+        if (dbFindRecord(&dbentry, name) == 0)
+            dbDeleteRecord(&dbentry);
+    }
+    dbFinishEntry(&dbentry);
+    epicsEventMustTrigger(writerDone);
+}
+
+static void runBench(unsigned nrecords)
+{
+    DBENTRY dbentry;
+    unsigned i;
+    unsigned long nfound;
+    double t0, t1, rate;
+
+    testDiag("%u records", nrecords);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    dbInitEntry(pdbbase, &dbentry);
+    t0 = now();
+    for (i = 0; i < nrecords; i++) {
+        char name[32];
+
+        sprintf(name, "bench:pv%u", i);
+        if (createRecord(&dbentry, name))
+            testAbort("Unable to create %s", name);
+    }
+    t1 = now();
+    dbFinishEntry(&dbentry);
+    testDiag("  created in %.3f sec", t1 - t0);
+
+    testIocInitOk();
+
+    nfound = lookups(nrecords, 0, &rate);
+    testOk(nfound == NLOOKUPS, "%u records, found %lu of %u names",
+        nrecords, nfound, NLOOKUPS);
+    testDiag("  existing names  %10.0f lookups/sec", rate);
+
+    nfound = lookups(nrecords, 1, &rate);
+    testOk(nfound == 0, "%u records, found %lu missing names",
+        nrecords, nfound);
+    testDiag("  missing names   %10.0f lookups/sec", rate);
+
+    epicsAtomicSetIntT(&stopWriter, 0);
+    nwrites = 0;
+    epicsThreadMustCreate("benchWriter", epicsThreadPriorityMedium,
+        epicsThreadGetStackSize(epicsThreadStackMedium), writer, NULL);
+    nfound = lookups(nrecords, 0, &rate);
+    epicsAtomicSetIntT(&stopWriter, 1);
+    epicsEventMustWait(writerDone);
+    testOk(nfound == NLOOKUPS, "%u records, found %lu of %u names "
+        "during %lu additions and deletions",
+        nrecords, nfound, NLOOKUPS, (unsigned long) nwrites);
+    testDiag("  during updates  %10.0f lookups/sec", rate);
+
+    if (nrecords <= 100000)
+        dbPvdDump(pdbbase, 0);
+
+    testIocShutdownOk();
+    testdbCleanup();
+}
+
+MAIN(benchdbPvd)
+{
+    unsigned counts[16] = {10000, 100000, 1000000};
+    unsigned ncounts = 3, i;
+    const char *env = getenv("PVD_BENCH_RECORDS");
+
+    if (env) {
+        char *end;
+        ncounts = 0;
+        while (*env && ncounts < NELEMENTS(counts)) {
+            counts[ncounts++] = strtoul(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+    writerDone = epicsEventMustCreate(epicsEventEmpty);
+    for (i = 0; i < ncounts; i++) {
+        runBench(counts[i]);
+    }
+    epicsEventDestroy(writerDone);
+    return testDone();
+}
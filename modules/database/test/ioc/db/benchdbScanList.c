@@ -0,0 +1,118 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure how many records per second a pass over a scan list of 100000
+ * records processes, with records doing nothing but their own processing.
+ * The records are on a named event's list, and each pass is started with
+ * postEvent() and timed until the record with the last phase has been
+ * processed.  The record counts may be overridden with a comma separated
+ * list of multiples of 10 in $SCAN_BENCH_RECORDS.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "dbDefs.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "dbAccess.h"
+#include "dbScan.h"
+#include "dbUnitTest.h"
+#include "errlog.h"
+
+#include "xRecord.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NPASSES 20
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static epicsEventId passDone;
+static epicsUInt64 tDone;
+
+static void onLast(xRecord *prec)
+{
+    tDone = epicsMonotonicGet();
+    epicsEventMustTrigger(passDone);
+}
+
+static void runBench(unsigned nrecs)
+{
+    EVENTPVT pel;
+    xRecord *plast;
+    epicsUInt64 tTotal = 0, tMin = 0;
+    unsigned i;
+
+    testDiag("%u records", nrecs);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    for (i = 0; i < nrecs / 10; i++) {
+        char macros[16];
+
+        sprintf(macros, "N=%u", i);
+        testdbReadDatabase("benchdbScanList.db", NULL, macros);
+    }
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    /* processed last */
+    plast = (xRecord *) testdbRecordPtr("bench:list00");
+    testdbPutFieldOk("bench:list00.PHAS", DBF_LONG, 1);
+    plast->clbk = onLast;
+
+    pel = eventNameToHandle("benchScanList");
+    for (i = 0; i < NPASSES; i++) {
+        epicsUInt64 t0 = epicsMonotonicGet(), dt;
+
+        postEvent(pel);
+        epicsEventMustWait(passDone);
+        dt = tDone - t0;
+        tTotal += dt;
+        if (!tMin || dt < tMin)
+            tMin = dt;
+    }
+
+    testDiag("  %.0f records/sec mean, %.0f best",
+        (double) nrecs * NPASSES * 1e9 / tTotal, nrecs * 1e9 / tMin);
+
+    eltc(0);
+    testIocShutdownOk();
+    eltc(1);
+    testdbCleanup();
+}
+
+MAIN(benchdbScanList)
+{
+    unsigned counts[16] = { 1000, 100000 };
+    unsigned nCounts = 2, i;
+    const char *env = getenv("SCAN_BENCH_RECORDS");
+
+    if (env) {
+        char *end;
+
+        nCounts = 0;
+        while (*env && nCounts < NELEMENTS(counts)) {
+            counts[nCounts++] = strtoul(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    passDone = epicsEventMustCreate(epicsEventEmpty);
+    testPlan(0);
+    for (i = 0; i < nCounts; i++)
+        runBench(counts[i]);
+    epicsEventDestroy(passDone);
+    return testDone();
+}
@@ -0,0 +1,125 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Measure how many records a ".1 second" periodic scan list gets through
+ * when its passes are shared by 1, 2, 4 and 8 threads.  Each of the 4000
+ * records spins for 50 usec when processed, so one thread needs 0.2 sec
+ * for a pass and over-runs, and 2 CPUs are needed to keep up.  The thread
+ * counts may be overridden with a comma separated list in
+ * $SCAN_BENCH_THREADS.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "dbAccess.h"
+#include "dbScan.h"
+#include "dbUnitTest.h"
+#include "errlog.h"
+
+#include "xRecord.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NRECS       4000
+#define WORK_NSEC   50000
+#define RUN_SEC     3.0
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static size_t nprocessed;
+
+static void onProcess(xRecord *prec)
+{
+    epicsUInt64 t0 = epicsMonotonicGet();
+
+    while (epicsMonotonicGet() - t0 < WORK_NSEC)
+        ;
+    prec->i32++;
+    epicsAtomicIncrSizeT(&nprocessed);
+}
+
+static void runBench(int nthreads)
+{
+    xRecord *pfirst;
+    epicsUInt64 t0, dt;
+    size_t n0, n;
+    int i, passes0;
+
+    testDiag("%d thread%s, %u CPUs", nthreads, nthreads > 1 ? "s" : "",
+        (unsigned) epicsThreadGetCPUs());
+
+    if (scanPeriodicThreads(nthreads, 0.1))
+        testAbort("scanPeriodicThreads() failed");
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    for (i = 0; i < NRECS; i++) {
+        char macros[16];
+
+        sprintf(macros, "N=%d", i);
+        testdbReadDatabase("benchdbScanThreads.db", NULL, macros);
+    }
+    for (i = 0; i < NRECS; i++) {
+        char name[32];
+
+        sprintf(name, "bench:scan%d", i);
+        ((xRecord *) testdbRecordPtr(name))->clbk = onProcess;
+    }
+    pfirst = (xRecord *) testdbRecordPtr("bench:scan0");
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    /* skip the first pass */
+    epicsThreadSleep(0.5);
+    t0 = epicsMonotonicGet();
+    n0 = epicsAtomicGetSizeT(&nprocessed);
+    passes0 = pfirst->i32;
+    epicsThreadSleep(RUN_SEC);
+    dt = epicsMonotonicGet() - t0;
+    n = epicsAtomicGetSizeT(&nprocessed) - n0;
+
+    testOk(n > 0, "%.0f records/sec, %.1f passes/sec of 10",
+        n * 1e9 / dt, (pfirst->i32 - passes0) * 1e9 / dt);
+
+    eltc(0);
+    testIocShutdownOk();
+    eltc(1);
+    testdbCleanup();
+}
+
+MAIN(benchdbScanThreads)
+{
+    int threads[16] = { 1, 2, 4, 8 };
+    unsigned nThreads = 4, i;
+    const char *env = getenv("SCAN_BENCH_THREADS");
+
+    if (env) {
+        char *end;
+
+        nThreads = 0;
+        while (*env && nThreads < NELEMENTS(threads)) {
+            threads[nThreads++] = strtol(env, &end, 10);
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan(0);
+    for (i = 0; i < nThreads; i++)
+        runBench(threads[i]);
+    scanPeriodicThreads(1, 0.0);
+    return testDone();
+}
@@ -0,0 +1,155 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Read an array through a CA input link while the record it links to
+ * updates at 10 kHz, checking that no read sees a partly copied update and
+ * measuring how long the reads take.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define EPICS_DBCA_PRIVATE_API
+
+#include "cantProceed.h"
+#include "dbAccess.h"
+#include "dbCa.h"
+#include "dbEvent.h"
+#include "dbLink.h"
+#include "dbUnitTest.h"
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "errlog.h"
+
+#include "arrRecord.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NELM 20000
+#define PERIOD 100000       /* nsec between source updates */
+#define DURATION 2.0        /* sec */
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static arrRecord *psrc;
+static int stop;
+static epicsEventId done;
+static unsigned long nPosted;
+
+/* Update the source at 10 kHz, setting every element to the count */
+static void writer(void *junk)
+{
+    epicsUInt64 next = epicsMonotonicGet();
+
+    while (!epicsAtomicGetIntT(&stop)) {
+        epicsUInt64 now = epicsMonotonicGet();
+        epicsFloat64 *pval = psrc->bptr;
+        unsigned i;
+
+        if (now < next) {
+            epicsThreadSleep((next - now) * 1e-9);
+            continue;
+        }
+        next += PERIOD;
+        if (next < now)
+            next = now;
+
+        dbScanLock((dbCommon *) psrc);
+        nPosted++;
+        for (i = 0; i < NELM; i++)
+            pval[i] = nPosted;
+        psrc->nord = NELM;
+        db_post_events(psrc, &psrc->val, DBE_VALUE | DBE_ALARM);
+        dbScanUnlock((dbCommon *) psrc);
+    }
+    epicsEventMustTrigger(done);
+}
+
+MAIN(dbCaLinkStressTest)
+{
+    char macros[40];
+    arrRecord *ptarg;
+    epicsFloat64 *buf;
+    epicsUInt64 start, total = 0, worst = 0;
+    unsigned long nRead = 0, nSlow = 0, nTorn = 0, nShort = 0;
+    double last = 0.0;
+    int backwards = 0;
+
+    testPlan(4);
+
+    sprintf(macros, "NELM=%d", NELM);
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbCaLinkStress.db", NULL, macros);
+
+    psrc = (arrRecord *) testdbRecordPtr("source");
+    ptarg = (arrRecord *) testdbRecordPtr("target");
+    buf = callocMustSucceed(NELM, sizeof(*buf), "dbCaLinkStressTest");
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+    testdbCaWaitForUpdateCount(&ptarg->inp, 1);
+
+    done = epicsEventMustCreate(epicsEventEmpty);
+    epicsThreadMustCreate("writer", epicsThreadPriorityMedium,
+        epicsThreadGetStackSize(epicsThreadStackSmall), writer, NULL);
+
+    start = epicsMonotonicGet();
+    while (epicsMonotonicGet() - start < DURATION * 1e9) {
+        long nReq = NELM, status, i;
+        epicsUInt64 t0, dt;
+
+        dbScanLock((dbCommon *) ptarg);
+        t0 = epicsMonotonicGet();
+        status = dbGetLink(&ptarg->inp, DBR_DOUBLE, buf, NULL, &nReq);
+        dt = epicsMonotonicGet() - t0;
+        dbScanUnlock((dbCommon *) ptarg);
+
+        if (status || buf[0] == 0.0)
+            continue;
+        nRead++;
+        total += dt;
+        if (dt > worst)
+            worst = dt;
+        nSlow += dt > 1000000;
+        nShort += nReq != NELM;
+        for (i = 1; i < nReq; i++) {
+            if (buf[i] != buf[0]) {
+                nTorn++;
+                break;
+            }
+        }
+        backwards |= buf[0] < last;
+        last = buf[0];
+        epicsThreadSleep(0.0);
+    }
+    epicsAtomicSetIntT(&stop, 1);
+    epicsEventMustWait(done);
+
+    testDiag("%lu updates posted in %.1f sec, %.0f Hz",
+        nPosted, DURATION, nPosted / DURATION);
+    if (nRead)
+        testDiag("%lu reads of %d elements, mean %.1f usec, max %.1f usec, "
+            "%lu over 1 msec", nRead, NELM, total * 1e-3 / nRead,
+            worst * 1e-3, nSlow);
+    testOk(nRead > 0, "link read %lu times", nRead);
+    testOk(nTorn == 0, "%lu reads saw a partial update", nTorn);
+    testOk(nShort == 0, "%lu reads were short", nShort);
+    testOk(!backwards, "updates read in order");
+
+    testIocShutdownOk();
+    testdbCleanup();
+    epicsEventDestroy(done);
+    free(buf);
+    return testDone();
+}
@@ -301,6 +301,85 @@ static void testCP(void)
     waitEvent = NULL;
 }
 
+#define NWORKERLINKS 16
+
+static void testWorkers(void)
+{
+    xRecord *psrc[NWORKERLINKS], *ptarg[NWORKERLINKS];
+    unsigned i, nshards;
+    int nlinks = 0, nused = 0, ngot = 0, nput = 0;
+
+    testDiag("CA links shared between worker threads");
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    for (i = 0; i < NWORKERLINKS; i++) {
+        char buf[20];
+
+        epicsSnprintf(buf, sizeof(buf), "N=%u", i);
+        testdbReadDatabase("dbCaLinkTest4.db", NULL, buf);
+        epicsSnprintf(buf, sizeof(buf), "source%u", i);
+        psrc[i] = (xRecord*)testdbRecordPtr(buf);
+        epicsSnprintf(buf, sizeof(buf), "target%u", i);
+        ptarg[i] = (xRecord*)testdbRecordPtr(buf);
+    }
+
+    dbCaWorkers = 4;
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+    dbCaWorkers = 1;
+
+    nshards = dbCaShardCount();
+    testOp("%u",nshards,==,4u);
+    for (i = 0; i < nshards; i++) {
+        int n, depth, maxDepth;
+
+        dbCaShardStats(i, &n, &depth, &maxDepth);
+        nlinks += n;
+        nused += n > 0;
+    }
+    testOp("%d",nlinks,==,NWORKERLINKS);
+    testOk(nused > 1, "links on %d workers", nused);
+
+    for (i = 0; i < NWORKERLINKS; i++) {
+        testdbCaWaitForUpdateCount(&psrc[i]->lnk, 1);
+        dbScanLock((dbCommon*)ptarg[i]);
+        ptarg[i]->val = 100 + i;
+        db_post_events(ptarg[i], &ptarg[i]->val, DBE_VALUE|DBE_ALARM);
+        dbScanUnlock((dbCommon*)ptarg[i]);
+    }
+    for (i = 0; i < NWORKERLINKS; i++) {
+        epicsInt32 temp = 0, val = 200 + i;
+        long nReq = 1;
+
+        testdbCaWaitForUpdateCount(&psrc[i]->lnk, 2);
+        dbScanLock((dbCommon*)psrc[i]);
+        if (dbGetLink(&psrc[i]->lnk, DBR_LONG, &temp, NULL, &nReq) == 0 &&
+            temp == 100 + i)
+            ngot++;
+        dbPutLink(&psrc[i]->lnk, DBR_LONG, &val, 1);
+        dbScanUnlock((dbCommon*)psrc[i]);
+    }
+    testOp("%d",ngot,==,NWORKERLINKS);
+
+    /* dbCaSync() waits for every worker */
+    dbCaSync();
+    for (i = 0; i < NWORKERLINKS; i++) {
+        dbScanLock((dbCommon*)ptarg[i]);
+        nput += ptarg[i]->val == 200 + i;
+        dbScanUnlock((dbCommon*)ptarg[i]);
+    }
+    testOp("%d",nput,==,NWORKERLINKS);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
 static void fillArray(epicsInt32 *buf, unsigned count, epicsInt32 first)
 {
     for(;count;count--,first++)
@@ -612,10 +691,11 @@ static void testCAC(void)
 
 MAIN(dbCaLinkTest)
 {
-    testPlan(101);
+    testPlan(106);
     testNativeLink();
     testStringLink();
     testCP();
+    testWorkers();
     testArrayLink(1,1);
     testArrayLink(10,1);
     testArrayLink(1,10);
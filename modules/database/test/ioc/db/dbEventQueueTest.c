@@ -0,0 +1,203 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Updates delivered and replaced with different event queue sizes, and
+ * with updates posted faster than the event task takes them.
+ */
+
+#define EPICS_PRIVATE_API
+
+#include <string.h>
+
+#include "epicsAtomic.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "caeventmask.h"
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "db_field_log.h"
+#include "dbLock.h"
+#include "dbUnitTest.h"
+
+#include "xRecord.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static xRecord *prec;
+
+typedef struct {
+    int delivered;
+    int last;
+    double delay;
+} monitor;
+
+static void onUpdate(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    monitor *mon = user_arg;
+
+    epicsAtomicSetIntT(&mon->last, pfl->u.v.field.dbf_long);
+    epicsAtomicIncrIntT(&mon->delivered);
+    if (mon->delay > 0.0)
+        epicsThreadSleep(mon->delay);
+}
+
+static void postValue(int value)
+{
+    dbScanLock((dbCommon *) prec);
+    prec->val = value;
+    db_post_events(prec, &prec->val, DBE_VALUE);
+    dbScanUnlock((dbCommon *) prec);
+}
+
+/* wait for every update not replaced to be delivered */
+static void waitDelivered(monitor *mon, evSubscrip *pevent, int nposts)
+{
+    epicsUInt64 t0 = epicsMonotonicGet();
+
+    while (epicsAtomicGetIntT(&mon->delivered) + (int) pevent->nreplace !=
+            nposts && epicsMonotonicGet() - t0 < 10000000000ull)
+        epicsThreadSleep(0.01);
+}
+
+/* Post nposts updates before the event task starts */
+static void testBurst(const char *what, int nposts, unsigned nentries,
+    int flowCtrl, int expectDelivered)
+{
+    dbEventCtx ctx = db_init_events();
+    dbChannel *chan = dbChannelCreate("x.VAL");
+    monitor mon;
+    evSubscrip *pevent;
+    int i;
+
+    memset(&mon, 0, sizeof(mon));
+    if (!ctx || !chan || dbChannelOpen(chan))
+        testAbort("Can't subscribe");
+    pevent = db_add_event(ctx, chan, onUpdate, &mon, DBE_VALUE);
+    if (nentries)
+        testOk(db_event_queue_entries(pevent, nentries) == DB_EVENT_OK,
+            "reserve %u entries", nentries);
+    db_event_enable(pevent);
+
+    if (flowCtrl)
+        db_event_flow_ctrl_mode_on(ctx);
+    for (i = 1; i <= nposts; i++) {
+        postValue(i);
+    }
+    if (flowCtrl)
+        db_event_flow_ctrl_mode_off(ctx);
+
+    db_start_events(ctx, "testEvent", NULL, NULL,
+        epicsThreadPriorityCAServerLow);
+    waitDelivered(&mon, pevent, nposts);
+
+    testOk(mon.delivered == expectDelivered &&
+        (int) pevent->nreplace == nposts - expectDelivered,
+        "%s: %d delivered, %lu replaced", what, mon.delivered,
+        pevent->nreplace);
+    testOk(mon.last == nposts, "last update delivered (%d)", mon.last);
+
+    db_cancel_event(pevent);
+    db_close_events(ctx);
+    dbChannelDelete(chan);
+}
+
+/* Post updates every period while the event task takes 1 ms for each */
+static void testRate(double period)
+{
+    dbEventCtx ctx = db_init_events();
+    dbChannel *chan = dbChannelCreate("x.VAL");
+    const int nposts = 300;
+    monitor mon;
+    evSubscrip *pevent;
+    epicsUInt64 t0;
+    int i;
+
+    memset(&mon, 0, sizeof(mon));
+    mon.delay = 0.001;
+    if (!ctx || !chan || dbChannelOpen(chan))
+        testAbort("Can't subscribe");
+    db_start_events(ctx, "testEvent", NULL, NULL,
+        epicsThreadPriorityCAServerLow);
+    pevent = db_add_event(ctx, chan, onUpdate, &mon, DBE_VALUE);
+    db_event_enable(pevent);
+
+    t0 = epicsMonotonicGet();
+    for (i = 1; i <= nposts; i++) {
+        postValue(i);
+        epicsThreadSleep(period);
+    }
+    testDiag("posted at %.0f Hz", nposts * 1e9 / (epicsMonotonicGet() - t0));
+    waitDelivered(&mon, pevent, nposts);
+
+    testOk(mon.delivered + (int) pevent->nreplace == nposts,
+        "%d delivered, %lu replaced", mon.delivered, pevent->nreplace);
+    testOk(mon.last == nposts, "last update delivered (%d)", mon.last);
+
+    db_cancel_event(pevent);
+    db_close_events(ctx);
+    dbChannelDelete(chan);
+}
+
+MAIN(dbEventQueueTest)
+{
+    testPlan(27);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("xRecord.db", NULL, NULL);
+    testIocInitOk();
+
+    prec = (xRecord *) testdbRecordPtr("x");
+
+    testDiag("Default queue of 4 x 36 entries");
+    testBurst("100 updates", 100, 0, 0, 100);
+    /* unless the queue may grow, EVENTSPERQUE entries stay free */
+    testBurst("108 updates", 108, 0, 0, 108);
+    testBurst("200 updates", 200, 0, 0, 108);
+    testBurst("flow control", 50, 0, 1, 1);
+
+    testDiag("Per subscription hint");
+    testBurst("300 entries reserved", 200, 300, 0, 200);
+
+    testDiag("dbEventQueueEntries = 8");
+    dbEventQueueEntries = 8;
+    testBurst("8 x 36 entries", 200, 0, 0, 200);
+
+    testDiag("dbEventQueueEntries = 1");
+    /* raised to 2, leaving 36 entries beyond the EVENTSPERQUE kept free */
+    dbEventQueueEntries = 1;
+    testBurst("2 x 36 entries", 200, 0, 0, 36);
+    dbEventQueueEntries = 4;
+
+    testDiag("dbEventQueueMaxBytes = 1000000");
+    dbEventQueueMaxBytes = 1000000;
+    testBurst("queue grows", 1000, 0, 0, 1000);
+    /* one entry stays free for each subscription using the queue */
+    dbEventQueueMaxBytes = 1;
+    testBurst("too small to grow", 200, 0, 0, 143);
+    dbEventQueueMaxBytes = 0;
+
+    testDiag("Posting at different rates");
+    testRate(0.01);
+    testRate(0.001);
+    testRate(0.0);
+    dbEventQueueMaxBytes = 1000000;
+    testRate(0.0);
+    dbEventQueueMaxBytes = 0;
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    return testDone();
+}
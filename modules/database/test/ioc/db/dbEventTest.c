@@ -0,0 +1,162 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* db_post_events() reaches exactly the subscriptions to the posted field
+ * whose mask matches, as subscriptions to several fields come and go.
+ */
+
+#include <string.h>
+
+#include "caeventmask.h"
+#include "dbAccess.h"
+#include "dbEvent.h"
+#include "dbLock.h"
+#include "dbUnitTest.h"
+
+#include "xRecord.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+enum { mVal, mVal2, mValAlarm, mI32, mF64, nMons };
+
+static xRecord *prec, *psentinel;
+static testMonitor *mons[nMons];
+static testMonitor *sentinel;
+
+static void postTo(xRecord *prec, void *pfield, unsigned mask)
+{
+    dbScanLock((dbCommon *) prec);
+    db_post_events(prec, pfield, mask);
+    dbScanUnlock((dbCommon *) prec);
+}
+
+static void post(void *pfield, unsigned mask)
+{
+    postTo(prec, pfield, mask);
+}
+
+/* The event task delivers updates in order, so once the sentinel's has
+ * arrived so have all those posted before it.
+ */
+static void sync(void)
+{
+    postTo(psentinel, &psentinel->val, DBE_VALUE);
+    testMonitorWait(sentinel);
+    testMonitorCount(sentinel, 1);
+}
+
+static void testCounts(const char *what, const unsigned *expect)
+{
+    int i, ok = 1;
+
+    sync();
+    for (i = 0; i < nMons; i++) {
+        unsigned count = mons[i] ? testMonitorCount(mons[i], 1) : 0;
+
+        if (count != expect[i]) {
+            testDiag("monitor %d got %u updates, expected %u",
+                i, count, expect[i]);
+            ok = 0;
+        }
+    }
+    testOk(ok, "%s", what);
+}
+
+MAIN(dbEventTest)
+{
+    testPlan(9);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+    testIocInitOk();
+
+    prec = (xRecord *) testdbRecordPtr("reca");
+    psentinel = (xRecord *) testdbRecordPtr("recb");
+
+    mons[mVal] = testMonitorCreate("reca.VAL", DBE_VALUE, 0);
+    mons[mVal2] = testMonitorCreate("reca.VAL", DBE_VALUE, 0);
+    mons[mValAlarm] = testMonitorCreate("reca.VAL", DBE_ALARM, 0);
+    mons[mI32] = testMonitorCreate("reca.I32", DBE_VALUE | DBE_LOG, 0);
+    mons[mF64] = testMonitorCreate("reca.F64", DBE_PROPERTY, 0);
+    sentinel = testMonitorCreate("recb.VAL", DBE_VALUE, 0);
+
+    {
+        static const unsigned expect[nMons] = { 1, 1, 0, 0, 0 };
+        post(&prec->val, DBE_VALUE);
+        testCounts("VAL value update", expect);
+    }
+    {
+        static const unsigned expect[nMons] = { 0, 0, 1, 0, 0 };
+        post(&prec->val, DBE_ALARM);
+        testCounts("VAL alarm update", expect);
+    }
+    {
+        static const unsigned expect[nMons] = { 0, 0, 0, 1, 0 };
+        post(&prec->i32, DBE_LOG);
+        testCounts("I32 archive update", expect);
+    }
+    {
+        static const unsigned expect[nMons] = { 0, 0, 0, 0, 0 };
+        post(&prec->f64, DBE_VALUE | DBE_LOG | DBE_ALARM);
+        post(&prec->u16, DBE_VALUE);
+        testCounts("no update for other masks and fields", expect);
+    }
+    {
+        static const unsigned expect[nMons] = { 1, 1, 0, 1, 1 };
+        post(NULL, DBE_VALUE | DBE_PROPERTY);
+        testCounts("every field", expect);
+    }
+    {
+        static const unsigned expect[nMons] = { 2, 2, 0, 0, 0 };
+        post(&prec->val, DBE_VALUE);
+        post(&prec->val, DBE_VALUE | DBE_LOG);
+        testCounts("each post", expect);
+    }
+
+    dbelf("reca", 1);
+
+    testMonitorDestroy(mons[mVal2]);
+    mons[mVal2] = NULL;
+    testMonitorDestroy(mons[mI32]);
+    mons[mI32] = NULL;
+    {
+        static const unsigned expect[nMons] = { 1, 0, 1, 0, 1 };
+        post(NULL, DBE_VALUE | DBE_ALARM | DBE_PROPERTY);
+        testCounts("after removing subscriptions", expect);
+    }
+
+    mons[mI32] = testMonitorCreate("reca.I32", DBE_LOG, 0);
+    {
+        static const unsigned expect[nMons] = { 0, 0, 0, 1, 0 };
+        post(&prec->i32, DBE_VALUE | DBE_LOG);
+        post(&prec->val, DBE_LOG);
+        testCounts("field subscribed again", expect);
+    }
+
+    testMonitorDestroy(mons[mVal]);
+    testMonitorDestroy(mons[mValAlarm]);
+    testMonitorDestroy(mons[mI32]);
+    testMonitorDestroy(mons[mF64]);
+    memset(mons, 0, sizeof(mons));
+    {
+        static const unsigned expect[nMons] = { 0, 0, 0, 0, 0 };
+        post(NULL, DBE_VALUE);
+        testCounts("no subscriptions left", expect);
+    }
+    testMonitorDestroy(sentinel);
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    return testDone();
+}
@@ -0,0 +1,111 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Records initialized in parallel, or in turn, depending on dbInitThreads
+ * and on which record types and device supports are declared thread-safe.
+ */
+
+#include <stdio.h>
+
+#include "dbAccess.h"
+#include "dbLock.h"
+#include "dbStaticLib.h"
+#include "devSup.h"
+#include "iocInit.h"
+#include "dbUnitTest.h"
+
+#include "xRecord.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NREC 100
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static xRecord *getRecord(char prefix, int n)
+{
+    char name[20];
+
+    sprintf(name, "%c%d", prefix, n);
+    return (xRecord *) testdbRecordPtr(name);
+}
+
+/* Count the records with a prefix where VAL is val */
+static int countVal(char prefix, int val)
+{
+    int n, count = 0;
+
+    for (n = 0; n < NREC; n++)
+        count += getRecord(prefix, n)->val == val;
+    return count;
+}
+
+static void loadDatabase(void)
+{
+    int n;
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    for (n = 0; n < NREC; n++) {
+        char macros[20];
+
+        sprintf(macros, "N=%d", n);
+        testdbReadDatabase("dbInitParallelTest.db", NULL, macros);
+    }
+}
+
+static void testInit(int threads)
+{
+    int n, sameLockSet = 0, softVal = 0;
+
+    testDiag("dbInitThreads = %d", threads);
+    loadDatabase();
+    testOk1(dbInitThreadSafe("x", NULL) == 0);
+    testOk1(dbInitThreadSafe("x", "Init Thread") == 0);
+    dbInitThreads = threads;
+    testIocInitOk();
+    dbInitThreads = 0;
+
+    testOk(countVal('a', 1) == (threads ? NREC : 0),
+        "thread-safe records %s", threads ? "in parallel" : "in turn");
+    testOk(countVal('b', 0) == NREC,
+        "records in a lock set with others in turn");
+    for (n = 0; n < NREC; n++) {
+        sameLockSet += dbLockGetLockId((dbCommon *) getRecord('b', n)) ==
+            dbLockGetLockId((dbCommon *) getRecord('c', n));
+        softVal += getRecord('d', n)->val == n;
+    }
+    testOk(sameLockSet == NREC, "links resolved");
+    testOk(softVal == NREC, "other records initialized");
+
+    iocStartupReport();
+
+    testIocShutdownOk();
+    testdbCleanup();
+}
+
+MAIN(dbInitParallelTest)
+{
+    testPlan(16);
+
+    loadDatabase();
+    testOk(dbInitThreadSafe("y", NULL) == S_dbLib_recordTypeNotFound,
+        "unknown record type");
+    testOk(dbInitThreadSafe("x", "No Such Device") == S_dev_noDevSup,
+        "unknown device support");
+    testOk1(dbInitThreadSafe("x", "devxSoft") == 0);
+    testOk1(dbInitThreadSafe("x", "") == 0);
+    testdbCleanup();
+
+    testInit(0);
+    testInit(4);
+
+    return testDone();
+}
@@ -15,6 +15,7 @@
 #include "epicsSpin.h"
 #include "epicsMutex.h"
 #include "dbCommon.h"
+#include "epicsEvent.h"
 #include "epicsThread.h"
 
 #include "dbLockPvt.h"
@@ -414,12 +415,162 @@ static void testLinkNOP(void)
     testdbCleanup();
 }
 
+static void testLockerKept(void)
+{
+    dbCommon *prec[3];
+    dbLocker *plock;
+    testDiag("Test a dbLocker kept while lock sets change");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    prec[0] = testdbRecordPtr("recg");
+    prec[1] = NULL;
+    prec[2] = testdbRecordPtr("reca");
+
+    plock = dbLockerAlloc(prec, 3, 0);
+    if(!plock)
+        testAbort("dbLockerAlloc() failed");
+
+    dbScanLockMany(plock);
+    testIntOk1(ellCount(&plock->locked),==,2);
+    dbScanUnlockMany(plock);
+
+    /* merge reca and recg */
+    testdbPutFieldOk("reca.SDIS", DBR_STRING, "recg");
+
+    dbScanLockMany(plock);
+    testIntOk1(ellCount(&plock->locked),==,1);
+    testPtrOk1(prec[0]->lset->plockSet->ownerlocker,==,plock);
+    dbScanUnlockMany(plock);
+
+    /* split them again */
+    testdbPutFieldOk("reca.SDIS", DBR_STRING, "");
+
+    dbScanLockMany(plock);
+    testIntOk1(ellCount(&plock->locked),==,2);
+    testOk1(prec[0]->lset->plockSet->ownerlocker==plock &&
+            prec[2]->lset->plockSet->ownerlocker==plock);
+    dbScanUnlockMany(plock);
+
+    dbLockerFree(plock);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
+static epicsEventId waiterReady;
+
+static void waitForLock(void *raw)
+{
+    dbCommon *prec = raw;
+
+    epicsEventMustTrigger(waiterReady);
+    dbScanLock(prec);
+    dbScanUnlock(prec);
+}
+
+static void testStats(void)
+{
+    dbCommon *precA;
+    dbLockStats stats, before;
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    epicsThreadId waiter;
+    int i;
+    testDiag("Test contention counters");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    precA = testdbRecordPtr("reca");
+    testOk1(dbLockGetStats(precA, &stats)!=0);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    testOk1(dbLockGetStats(precA, &stats)==0);
+    testOk(stats.nlock==0, "Counting starts when the IOC is running");
+
+    /* the inner lock is not counted */
+    dbLockHoldTimes = 1;
+    dbScanLock(precA);
+    dbScanLock(precA);
+    dbScanUnlock(precA);
+    epicsThreadSleep(0.01);
+    dbScanUnlock(precA);
+    for(i=0; i<4; i++) {
+        dbScanLock(precA);
+        dbScanUnlock(precA);
+    }
+    dbLockGetStats(precA, &stats);
+    testOk(stats.nlock==5 && stats.ncontended==0,
+           "locked %llu times, %llu contended",
+           (unsigned long long)stats.nlock, (unsigned long long)stats.ncontended);
+    testOk(stats.nheld==5 && stats.holdMax>=10000000 &&
+           stats.holdTotal>=stats.holdMax,
+           "held for %llu nsec at most", (unsigned long long)stats.holdMax);
+    dbLockHoldTimes = 0;
+
+    waiterReady = epicsEventMustCreate(epicsEventEmpty);
+    opts.joinable = 1;
+    dbScanLock(precA);
+    waiter = epicsThreadCreateOpt("waiter", &waitForLock, precA, &opts);
+    epicsEventMustWait(waiterReady);
+    epicsThreadSleep(0.05);
+    dbScanUnlock(precA);
+    epicsThreadMustJoin(waiter);
+    epicsEventDestroy(waiterReady);
+
+    dbLockGetStats(precA, &stats);
+    testOk(stats.nlock==7 && stats.ncontended==1 && stats.nheld==5,
+           "locked %llu times, %llu contended",
+           (unsigned long long)stats.nlock, (unsigned long long)stats.ncontended);
+    testOk(stats.waitMax>=10000000 && stats.waitTotal==stats.waitMax,
+           "waited %llu nsec", (unsigned long long)stats.waitMax);
+
+    testOk1(dbLockShowContention(1)==0);
+    testOk1(dblsr(NULL, 0)==0);
+
+    /* merge with recg's lock set */
+    before = stats;
+    testdbPutFieldOk("reca.SDIS", DBR_STRING, "recg");
+    dbLockGetStats(precA, &stats);
+    testOk(stats.nlock>before.nlock && stats.ncontended==1 &&
+           stats.waitMax==before.waitMax,
+           "merged lock set keeps the counters");
+
+    dbLockResetStats();
+    dbLockGetStats(precA, &stats);
+    testOk(stats.nlock==0 && stats.waitMax==0 && stats.holdTotal==0,
+           "counters reset");
+    dbScanLock(precA);
+    dbScanUnlock(precA);
+    dbLockGetStats(precA, &stats);
+    testOk(stats.nlock==1, "counting again");
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
 MAIN(dbLockTest)
 {
 #ifdef LOCKSET_DEBUG
-    testPlan(100);
+    testPlan(120);
 #else
-    testPlan(88);
+    testPlan(108);
 #endif
     testSets();
     testSingleLock();
@@ -428,5 +579,7 @@ MAIN(dbLockTest)
     testLinkMake();
     testLinkChange();
     testLinkNOP();
+    testLockerKept();
+    testStats();
     return testDone();
 }
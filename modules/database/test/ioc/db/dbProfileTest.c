@@ -0,0 +1,176 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Processing times counted by the record profiler, for a chain of records
+ * and with the profiler stopped and reset.
+ */
+
+#include <string.h>
+
+#include "epicsTime.h"
+#include "dbAccess.h"
+#include "dbLock.h"
+#include "dbProfile.h"
+#include "dbUnitTest.h"
+
+#include "xRecord.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NPASSES 20
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static xRecord *proot, *pchild1, *pinput, *pchild2;
+
+/* Spend I32 usec processing */
+static void spin(xRecord *prec)
+{
+    epicsUInt64 t0 = epicsMonotonicGet();
+
+    while (epicsMonotonicGet() - t0 < prec->i32 * 1000ull)
+        ;
+}
+
+static void processRoot(int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        dbScanLock((dbCommon *) proot);
+        dbProcess((dbCommon *) proot);
+        dbScanUnlock((dbCommon *) proot);
+    }
+}
+
+static epicsUInt64 selfCount(xRecord *prec)
+{
+    dbProfileRecord prof;
+
+    if (dbProfileGet((dbCommon *) prec, &prof))
+        return (epicsUInt64) -1;
+    return prof.self.count;
+}
+
+static void testPercentile(void)
+{
+    dbProfileStats stats;
+
+    memset(&stats, 0, sizeof(stats));
+    testOk1(dbProfilePercentile(&stats, 0.5) == 0);
+
+    stats.count = 100;
+    stats.hist[1] = 50;     /* 64 to 96 nsec */
+    stats.hist[10] = 49;    /* 1536 to 2048 nsec */
+    stats.hist[20] = 1;     /* 49152 to 65536 nsec */
+    stats.max = 60000;
+    testOk(dbProfilePercentile(&stats, 0.5) == 96, "p50 %llu",
+        (unsigned long long) dbProfilePercentile(&stats, 0.5));
+    testOk(dbProfilePercentile(&stats, 0.99) == 2048, "p99 %llu",
+        (unsigned long long) dbProfilePercentile(&stats, 0.99));
+    testOk(dbProfilePercentile(&stats, 1.0) == 60000, "p100 %llu",
+        (unsigned long long) dbProfilePercentile(&stats, 1.0));
+}
+
+static void testChain(void)
+{
+    dbProfileRecord root, child1, input, child2;
+
+    testDiag("Profile a chain of records");
+
+    processRoot(NPASSES);
+    testOk(dbProfileGet((dbCommon *) proot, &root) != 0,
+        "Nothing counted while the profiler is stopped");
+
+    dbProfileEnable(1);
+    processRoot(NPASSES);
+    dbProfileEnable(0);
+
+    if (dbProfileGet((dbCommon *) proot, &root) ||
+            dbProfileGet((dbCommon *) pchild1, &child1) ||
+            dbProfileGet((dbCommon *) pinput, &input) ||
+            dbProfileGet((dbCommon *) pchild2, &child2))
+        testAbort("Records in the chain not profiled");
+
+    testOk(root.self.count == NPASSES && child1.self.count == NPASSES &&
+        input.self.count == NPASSES && child2.self.count == NPASSES,
+        "Each record processed %d times", NPASSES);
+    testOk(root.chain.count == NPASSES && child1.chain.count == 0 &&
+        input.chain.count == 0 && child2.chain.count == 0,
+        "Chains counted against the root record only");
+    testOk(root.chain.total == root.self.total + child1.self.total +
+        input.self.total + child2.self.total,
+        "Chain time is the sum of the records' own times");
+    testOk(root.self.total >= NPASSES * 1000000ull &&
+        root.self.total < root.chain.total - child2.self.total + 1,
+        "Root took %.3f msec itself, not counting linked records",
+        root.self.total * 1e-6 / NPASSES);
+    testOk(child2.self.total >= NPASSES * 2000000ull &&
+        root.chain.total >= NPASSES * 3000000ull,
+        "child2 took %.3f msec, the chain %.3f msec",
+        child2.self.total * 1e-6 / NPASSES,
+        root.chain.total * 1e-6 / NPASSES);
+    testOk(dbProfilePercentile(&root.chain, 0.5) <=
+        dbProfilePercentile(&root.chain, 0.99) &&
+        dbProfilePercentile(&root.chain, 0.99) <= root.chain.max &&
+        root.chain.max >= root.chain.total / NPASSES,
+        "chain p50 %.3f, p99 %.3f, max %.3f msec",
+        dbProfilePercentile(&root.chain, 0.5) * 1e-6,
+        dbProfilePercentile(&root.chain, 0.99) * 1e-6,
+        root.chain.max * 1e-6);
+
+    testOk1(dbProfileReport(2, NULL) == 0);
+    testOk1(dbProfileReport(0, "Passive") == 0);
+    testOk1(dbProfileReport(0, "no such scan") != 0);
+
+    processRoot(NPASSES);
+    testOk(selfCount(proot) == NPASSES,
+        "Counters kept while the profiler is stopped");
+
+    testOk1(dbProfileReset() == 0);
+    testOk(selfCount(proot) == 0 && selfCount(pchild2) == 0,
+        "Counters reset");
+
+    dbProfileEnable(1);
+    dbScanLock((dbCommon *) pchild2);
+    dbProcess((dbCommon *) pchild2);
+    dbScanUnlock((dbCommon *) pchild2);
+    dbProfileEnable(0);
+    if (dbProfileGet((dbCommon *) pchild2, &child2))
+        testAbort("child2 not profiled");
+    testOk(child2.self.count == 1 && child2.chain.count == 1 &&
+        selfCount(proot) == 0,
+        "A record processed alone is the root of its own chain");
+}
+
+MAIN(dbProfileTest)
+{
+    testPlan(18);
+
+    testPercentile();
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbProfileTest.db", NULL, NULL);
+    testIocInitOk();
+
+    proot = (xRecord *) testdbRecordPtr("prof:root");
+    pchild1 = (xRecord *) testdbRecordPtr("prof:child1");
+    pinput = (xRecord *) testdbRecordPtr("prof:input");
+    pchild2 = (xRecord *) testdbRecordPtr("prof:child2");
+    proot->clbk = pchild1->clbk = pinput->clbk = pchild2->clbk = &spin;
+
+    testChain();
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    return testDone();
+}
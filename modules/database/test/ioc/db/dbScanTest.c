@@ -13,14 +13,19 @@
 #include <string.h>
 
 #include "dbScan.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
+#include "epicsThread.h"
 
 #include "dbUnitTest.h"
 #include "testMain.h"
 
 #include "dbAccess.h"
+#include "dbLock.h"
 #include "errlog.h"
 
+#include "xRecord.h"
+
 void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
 static epicsEventId waiter;
@@ -66,9 +71,136 @@ static void testOnce(void)
     epicsEventDestroy(waiter);
 }
 
+#define NSCANNED 9
+
+static const char * const scanned[NSCANNED] = {
+    "chain1", "chain2", "chain3",
+    "ind3", "ind4", "ind5", "ind6", "ind7", "ind8"
+};
+static epicsThreadId scannedBy[NSCANNED];
+static int seq;
+
+static void onProcess(xRecord *prec)
+{
+    prec->i32++;
+    prec->i64 = epicsAtomicIncrIntT(&seq);
+    scannedBy[prec->u16] = epicsThreadGetIdSelf();
+}
+
+static void testPeriodicThreads(void)
+{
+    xRecord *precs[NSCANNED];
+    int i, nthreads = 0, allScanned = 1;
+
+    testDiag("check a periodic scan list shared by 3 threads");
+    testOk1(scanPeriodicThreads(3, 0.1) == 0);
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbScanTest.db", NULL, NULL);
+
+    for (i = 0; i < NSCANNED; i++) {
+        precs[i] = (xRecord *) testdbRecordPtr(scanned[i]);
+        precs[i]->clbk = onProcess;
+    }
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    testOk(scanPeriodicThreads(2, 0.0) != 0, "too late after iocInit()");
+    scanppl(0.1);
+
+    epicsThreadSleep(0.55);
+    /* finishes the pass in progress */
+    testIocShutdownOk();
+
+    for (i = 0; i < NSCANNED; i++) {
+        int j;
+
+        if (precs[i]->i32 < 3) {
+            testDiag("%s processed %d times", scanned[i], precs[i]->i32);
+            allScanned = 0;
+        }
+        for (j = 0; j < i && scannedBy[j] != scannedBy[i]; j++)
+            ;
+        if (j == i)
+            nthreads++;
+    }
+    testOk1(allScanned);
+    testOk(nthreads > 1, "scanned by %d threads", nthreads);
+    testOk(scannedBy[0] == scannedBy[1] && scannedBy[1] == scannedBy[2],
+        "one thread scans a lock set");
+    testOk(precs[2]->i64 < precs[1]->i64 && precs[1]->i64 < precs[0]->i64,
+        "in PHAS order");
+
+    testdbCleanup();
+
+    /* the following tests use one thread */
+    testOk1(scanPeriodicThreads(1, 0.0) == 0);
+}
+
+static void onEvt1(xRecord *prec)
+{
+    prec->i32++;
+    if (prec->i32 == 1) {
+        testdbPutFieldOk("evt2.SCAN", DBF_STRING, "Passive");
+        testdbPutFieldOk("evt3.SCAN", DBF_STRING, "Event");
+    }
+}
+
+static void onEvt(xRecord *prec)
+{
+    prec->i32++;
+}
+
+static void testListChanges(void)
+{
+    xRecord *pevt1, *pevt2, *pevt3;
+    EVENTPVT pel;
+
+    testDiag("check records added and removed during a pass");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbScanTest.db", NULL, NULL);
+
+    pevt1 = (xRecord *) testdbRecordPtr("evt1");
+    pevt2 = (xRecord *) testdbRecordPtr("evt2");
+    pevt3 = (xRecord *) testdbRecordPtr("evt3");
+    pevt1->clbk = onEvt1;
+    pevt2->clbk = pevt3->clbk = onEvt;
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    pel = eventNameToHandle("dbScanTest");
+    postEvent(pel);
+    testSyncCallback();
+    testOk(pevt1->i32 == 1 && pevt2->i32 == 0 && pevt3->i32 == 0,
+        "removed record skipped, added one left for the next pass "
+        "(%d, %d, %d)", pevt1->i32, pevt2->i32, pevt3->i32);
+
+    postEvent(pel);
+    testSyncCallback();
+    testOk(pevt1->i32 == 2 && pevt2->i32 == 0 && pevt3->i32 == 1,
+        "next pass (%d, %d, %d)", pevt1->i32, pevt2->i32, pevt3->i32);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
 MAIN(dbScanTest)
 {
-    testPlan(3);
+    testPlan(14);
     testOnce();
+    testPeriodicThreads();
+    testListChanges();
     return testDone();
 }
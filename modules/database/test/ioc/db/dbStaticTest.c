@@ -4,6 +4,7 @@
 * in file LICENSE that is included with this distribution.
  \*************************************************************************/
 
+#include <stdio.h>
 #include <string.h>
 
 #include <errlog.h>
@@ -14,6 +15,10 @@
 #include <dbUnitTest.h>
 #include <testMain.h>
 #include <epicsString.h>
+#include <epicsAtomic.h>
+#include <epicsEvent.h>
+#include <epicsMutex.h>
+#include <epicsThread.h>
 #include <iocsh.h>
 
 
@@ -45,6 +50,144 @@ static void testEntryPresent(const char *pv)
     dbFinishEntry(&entry);
 }
 
+/* the negative lookup filter is built by iocInit() */
+static void testPvdAddDelete(void)
+{
+    DBENTRY entry;
+    char name[32];
+    int i, ok = 1;
+
+    testDiag("testPvdAddDelete()");
+
+    dbInitEntry(pdbbase, &entry);
+    testOk1(dbFindRecordType(&entry, "x")==0);
+
+    for (i = 0; i < 100; i++) {
+        sprintf(name, "testpvd%d", i);
+        ok &= dbCreateRecord(&entry, name)==0;
+    }
+    testOk(ok, "Created 100 records");
+    dbFinishEntry(&entry);
+
+    testEntryPresent("testpvd0");
+    testEntryPresent("testpvd99");
+
+    for (i = 0; i < 100; i += 2) {
+        dbInitEntry(pdbbase, &entry);
+        sprintf(name, "testpvd%d", i);
+        ok &= dbFindRecord(&entry, name)==0 && dbDeleteRecord(&entry)==0;
+        dbFinishEntry(&entry);
+    }
+    testOk(ok, "Deleted 50 records");
+
+    for (i = 0; i < 100; i++) {
+        dbInitEntry(pdbbase, &entry);
+        sprintf(name, "testpvd%d", i);
+        if ((dbFindRecord(&entry, name)==0) != (i & 1)) {
+            testDiag("Wrong result for '%s'", name);
+            ok = 0;
+        }
+        dbFinishEntry(&entry);
+    }
+    testOk(ok, "Only the remaining records found");
+
+    for (i = 1; i < 100; i += 2) {
+        dbInitEntry(pdbbase, &entry);
+        sprintf(name, "testpvd%d", i);
+        if (dbFindRecord(&entry, name)==0)
+            dbDeleteRecord(&entry);
+        dbFinishEntry(&entry);
+    }
+    testEntryRemoved("testpvd1");
+    testEntryPresent("testrec");
+}
+
+/* Lookups without locking while other threads add and delete records.
+ * The database itself isn't thread-safe, so only the updates are
+ * serialized against each other.
+ */
+#define NCHURN 200
+
+static int churnStop;
+static int churnCount;
+static epicsMutexId churnLock;
+static epicsEventId churnDone;
+
+static void churn(void *arg)
+{
+    int create = arg != NULL;
+    DBENTRY entry;
+    char name[32];
+    int i = 0;
+
+    while (!epicsAtomicGetIntT(&churnStop)) {
+        sprintf(name, "testchurn%d", i++ % NCHURN);
+        epicsMutexMustLock(churnLock);
+        dbInitEntry(pdbbase, &entry);
+        if (dbFindRecord(&entry, name)==0) {
+            if (!create && dbDeleteRecord(&entry)==0)
+                epicsAtomicIncrIntT(&churnCount);
+        }
+        else if (create && dbFindRecordType(&entry, "x")==0 &&
+            dbCreateRecord(&entry, name)==0)
+            epicsAtomicIncrIntT(&churnCount);
+        dbFinishEntry(&entry);
+        epicsMutexUnlock(churnLock);
+        if (!(i % 16))
+            epicsThreadSleep(0.0);
+    }
+    epicsEventMustTrigger(churnDone);
+}
+
+static void testPvdConcurrent(void)
+{
+    DBENTRY entry;
+    char name[32];
+    unsigned long missed = 0, found = 0;
+    int i;
+
+    testDiag("testPvdConcurrent()");
+
+    churnLock = epicsMutexMustCreate();
+    churnDone = epicsEventMustCreate(epicsEventEmpty);
+    epicsAtomicSetIntT(&churnStop, 0);
+    epicsAtomicSetIntT(&churnCount, 0);
+    /* at our priority, so all three threads get to run */
+    epicsThreadMustCreate("pvdAdd", epicsThreadGetPrioritySelf(),
+        epicsThreadGetStackSize(epicsThreadStackSmall), churn, "create");
+    epicsThreadMustCreate("pvdDelete", epicsThreadGetPrioritySelf(),
+        epicsThreadGetStackSize(epicsThreadStackSmall), churn, NULL);
+
+    dbInitEntry(pdbbase, &entry);
+    for (i = 0; i < 200000; i++) {
+        if (dbFindRecord(&entry, "testrec")!=0)
+            missed++;
+        sprintf(name, "testchurn%d", i % NCHURN);
+        found += dbFindRecord(&entry, name)==0;
+        if (!(i % 1000))
+            epicsThreadSleep(0.0);
+    }
+    dbFinishEntry(&entry);
+
+    epicsAtomicSetIntT(&churnStop, 1);
+    epicsEventMustWait(churnDone);
+    epicsEventMustWait(churnDone);
+    testOk(missed == 0, "Existing record always found (%lu misses)", missed);
+    testDiag("Found %lu of %d records during %d additions and deletions",
+        found, i, epicsAtomicGetIntT(&churnCount));
+
+    for (i = 0; i < NCHURN; i++) {
+        dbInitEntry(pdbbase, &entry);
+        sprintf(name, "testchurn%d", i);
+        if (dbFindRecord(&entry, name)==0)
+            dbDeleteRecord(&entry);
+        dbFinishEntry(&entry);
+    }
+    testEntryRemoved("testchurn0");
+    epicsEventDestroy(churnDone);
+    epicsMutexDestroy(churnLock);
+}
+
 static void testEntry(const char *pv)
 {
     DBENTRY entry;
@@ -345,7 +488,7 @@ MAIN(dbStaticTest)
     char *ldirDup;
     FILE *fp = NULL;
 
-    testPlan(350);
+    testPlan(360);
     testdbPrepare();
 
     testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
@@ -452,6 +595,9 @@ MAIN(dbStaticTest)
 
     testDbVerify("testrec");
 
+    testPvdAddDelete();
+    testPvdConcurrent();
+
     testIocShutdownOk();
 
     testdbCleanup();
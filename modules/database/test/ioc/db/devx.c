@@ -10,6 +10,7 @@
 #include <stdio.h>
 
 #include <epicsAssert.h>
+#include <epicsThread.h>
 #include <cantProceed.h>
 #include <ellLib.h>
 #include <dbDefs.h>
@@ -160,3 +161,33 @@ static struct xdset devxSoft = {
     &xsoft_read
 };
 epicsExportAddress(dset, devxSoft);
+
+/* DTYP="Init Thread" sets VAL to 1 if init_record() was called by a thread
+ * other than the one running iocInit, after waiting I32 usec as if setting
+ * up some I/O
+ */
+static epicsThreadId xinit_thread;
+
+static long xinit_init(int pass)
+{
+    if (pass == 0)
+        xinit_thread = epicsThreadGetIdSelf();
+    return 0;
+}
+
+static long xinit_init_record(xRecord *prec)
+{
+    if (prec->i32 > 0)
+        epicsThreadSleep(prec->i32 * 1e-6);
+    prec->val = epicsThreadGetIdSelf() != xinit_thread;
+    return 0;
+}
+
+static struct xdset devxInitThread = {
+    5, NULL,
+    &xinit_init,
+    &xinit_init_record,
+    NULL,
+    NULL
+};
+epicsExportAddress(dset, devxInitThread);
@@ -25,11 +25,16 @@ int dbServerTest(void);
 int dbCaStatsTest(void);
 int dbShutdownTest(void);
 int dbScanTest(void);
+int dbEventTest(void);
+int dbEventQueueTest(void);
+int dbProfileTest(void);
+int dbInitParallelTest(void);
 int scanIoTest(void);
 int dbLockTest(void);
 int dbPutLinkTest(void);
 int dbStaticTest(void);
 int dbCaLinkTest(void);
+int dbCaLinkStressTest(void);
 int dbDbLinkTest(void);
 int testDbChannel(void);
 int chfPluginTest(void);
@@ -48,11 +53,16 @@ void epicsRunDbTests(void)
     runTest(dbCaStatsTest);
     runTest(dbShutdownTest);
     runTest(dbScanTest);
+    runTest(dbEventTest);
+    runTest(dbEventQueueTest);
+    runTest(dbProfileTest);
+    runTest(dbInitParallelTest);
     runTest(scanIoTest);
     runTest(dbLockTest);
     runTest(dbPutLinkTest);
     runTest(dbStaticTest);
     runTest(dbCaLinkTest);
+    runTest(dbCaLinkStressTest);
     runTest(dbDbLinkTest);
     runTest(testDbChannel);
     runTest(arrShorthandTest);
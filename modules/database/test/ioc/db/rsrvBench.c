@@ -0,0 +1,481 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "rsrvBench.h"
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#define CA_MINOR_PROTOCOL_REVISION 13
+#include "caProto.h"
+#include "dbAccess.h"
+#include "envDefs.h"
+#include "iocInit.h"
+#include "rsrv.h"
+#include "dbUnitTest.h"
+#include "iocsh.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+/* Runs in the re-executed child, see benchIocStart() */
+void benchIocMain(void (*atInit)(void))
+{
+    const char *fds = getenv("RSRV_BENCH_IOC_FDS");
+    const char *db = getenv("RSRV_BENCH_IOC_DB");
+    const char *macros = getenv("RSRV_BENCH_IOC_MACROS");
+    const char *cmds = getenv("RSRV_BENCH_IOC_CMDS");
+    const char *actual;
+    int ready, ctl;
+    char port[8], junk;
+
+    if (!fds || sscanf(fds, "%d,%d", &ready, &ctl) != 2)
+        return;
+
+    if (!getenv("EPICS_CAS_INTF_ADDR_LIST"))
+        epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    if (!getenv("EPICS_CAS_SERVER_PORT"))
+        epicsEnvSet("EPICS_CAS_SERVER_PORT", "55064");
+    if (!getenv("EPICS_CAS_BEACON_PORT"))
+        epicsEnvSet("EPICS_CAS_BEACON_PORT", "55065");
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_ADDR_LIST", "127.0.0.1");
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    if (db && *db)
+        testdbReadDatabase(db, NULL, macros);
+    rsrv_register_server();
+
+    /* iocsh commands, separated by ';' */
+    if (cmds && *cmds) {
+        char *copy = strdup(cmds), *save = NULL, *cmd;
+        for (cmd = strtok_r(copy, ";", &save); cmd;
+                cmd = strtok_r(NULL, ";", &save))
+            iocshCmd(cmd);
+        free(copy);
+    }
+
+    if (iocInit())
+        _exit(1);
+    if (atInit)
+        (*atInit)();
+
+    actual = getenv("RSRV_SERVER_PORT");
+    strncpy(port, actual ? actual : "0", sizeof(port) - 1);
+    port[sizeof(port) - 1] = '\0';
+    if (write(ready, port, sizeof(port)) != sizeof(port))
+        _exit(1);
+
+    /* run until the parent closes the control pipe */
+    while (read(ctl, &junk, 1) > 0) {}
+    _exit(0);
+}
+
+int benchIocStart(benchIoc *ioc, const char *db, const char *macros,
+    const char *cmds)
+{
+    int ready[2], ctl[2];
+    char port[8];
+    ssize_t n;
+
+    if (pipe(ready) || pipe(ctl))
+        return -1;
+
+    fflush(stdout);
+    fflush(stderr);
+
+    ioc->pid = fork();
+    if (ioc->pid < 0)
+        return -1;
+
+    if (ioc->pid == 0) {
+        /* exec a fresh copy of ourself so that no epicsThread state
+         * is inherited, benchIocMain() takes over from there */
+        char fds[32];
+
+        close(ready[0]);
+        close(ctl[1]);
+        sprintf(fds, "%d,%d", ready[1], ctl[0]);
+        setenv("RSRV_BENCH_IOC_FDS", fds, 1);
+        setenv("RSRV_BENCH_IOC_DB", db ? db : "", 1);
+        setenv("RSRV_BENCH_IOC_MACROS", macros ? macros : "", 1);
+        setenv("RSRV_BENCH_IOC_CMDS", cmds ? cmds : "", 1);
+        execl("/proc/self/exe", "benchIoc", (char *) NULL);
+        _exit(1);
+    }
+
+    close(ready[1]);
+    close(ctl[0]);
+    ioc->ctl = ctl[1];
+
+    n = read(ready[0], port, sizeof(port));
+    close(ready[0]);
+    if (n != sizeof(port)) {
+        benchIocStop(ioc);
+        return -1;
+    }
+    ioc->port = (unsigned short) atoi(port);
+    return ioc->port == 0;
+}
+
+void benchIocStop(benchIoc *ioc)
+{
+    int status;
+
+    if (ioc->pid <= 0)
+        return;
+    close(ioc->ctl);
+    if (waitpid(ioc->pid, &status, 0) < 0) {
+        kill(ioc->pid, SIGKILL);
+    }
+    ioc->pid = 0;
+}
+
+int benchIocThreads(const benchIoc *ioc)
+{
+    char name[64], line[128];
+    int nthreads = -1;
+    FILE *fp;
+
+    sprintf(name, "/proc/%d/status", ioc->pid);
+    fp = fopen(name, "r");
+    if (!fp)
+        return -1;
+    while (fgets(line, sizeof(line), fp)) {
+        if (sscanf(line, "Threads: %d", &nthreads) == 1)
+            break;
+    }
+    fclose(fp);
+    return nthreads;
+}
+
+double benchIocCpuSeconds(const benchIoc *ioc)
+{
+    char name[64], buf[1024], *p;
+    unsigned long utime, stime;
+    FILE *fp;
+    size_t n;
+
+    sprintf(name, "/proc/%d/stat", ioc->pid);
+    fp = fopen(name, "r");
+    if (!fp)
+        return -1.0;
+    n = fread(buf, 1, sizeof(buf) - 1, fp);
+    fclose(fp);
+    buf[n] = '\0';
+
+    /* skip past the executable name, which may contain spaces */
+    p = strrchr(buf, ')');
+    if (!p || sscanf(p + 2,
+            "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu",
+            &utime, &stime) != 2)
+        return -1.0;
+    return (double)(utime + stime) / sysconf(_SC_CLK_TCK);
+}
+
+unsigned long benchRaiseFdLimit(unsigned long want)
+{
+    struct rlimit lim;
+
+    if (getrlimit(RLIMIT_NOFILE, &lim))
+        return 0;
+    if (lim.rlim_cur < want) {
+        lim.rlim_cur = want < lim.rlim_max ? want : lim.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &lim);
+        getrlimit(RLIMIT_NOFILE, &lim);
+    }
+    return lim.rlim_cur;
+}
+
+double benchNow(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int sendAll(int sock, const char *buf, size_t len)
+{
+    while (len) {
+        ssize_t n = send(sock, buf, len, MSG_NOSIGNAL);
+        if (n < 0) {
+            struct pollfd pfd;
+            if (errno == EINTR)
+                continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                return -1;
+            pfd.fd = sock;
+            pfd.events = POLLOUT;
+            poll(&pfd, 1, 1000);
+            continue;
+        }
+        buf += n;
+        len -= n;
+    }
+    return 0;
+}
+
+int benchCircuitSend(benchCircuit *circ, unsigned cmmd, unsigned dataType,
+    epicsUInt32 count, epicsUInt32 cid, epicsUInt32 available,
+    const void *payload, size_t payloadSize)
+{
+    size_t aligned = CA_MESSAGE_ALIGN(payloadSize);
+    size_t hdrSize = sizeof(caHdr);
+    char small[256], *msg = small;
+    caHdr *hdr;
+    int ret;
+
+    if (aligned >= 0xffff || count >= 0xffff)
+        hdrSize += 2 * sizeof(ca_uint32_t);
+    if (hdrSize + aligned > sizeof(small)) {
+        msg = malloc(hdrSize + aligned);
+        if (!msg)
+            return -1;
+    }
+
+    hdr = (caHdr *) msg;
+    hdr->m_cmmd = htons((ca_uint16_t) cmmd);
+    hdr->m_dataType = htons((ca_uint16_t) dataType);
+    hdr->m_cid = htonl(cid);
+    hdr->m_available = htonl(available);
+    if (hdrSize == sizeof(caHdr)) {
+        hdr->m_postsize = htons((ca_uint16_t) aligned);
+        hdr->m_count = htons((ca_uint16_t) count);
+    }
+    else {
+        ca_uint32_t *pW32 = (ca_uint32_t *) (hdr + 1);
+        hdr->m_postsize = htons(0xffff);
+        hdr->m_count = 0;
+        pW32[0] = htonl((ca_uint32_t) aligned);
+        pW32[1] = htonl(count);
+    }
+    memset(msg + hdrSize, 0, aligned);
+    if (payloadSize)
+        memcpy(msg + hdrSize, payload, payloadSize);
+
+    ret = sendAll(circ->sock, msg, hdrSize + aligned);
+    if (msg != small)
+        free(msg);
+    return ret;
+}
+
+int benchCircuitConnect(benchCircuit *circ, unsigned short port)
+{
+    struct sockaddr_in addr;
+    void *pvt = circ->pvt;
+    int one = 1;
+
+    memset(circ, 0, sizeof(*circ));
+    circ->pvt = pvt;
+    circ->size = 1 << 14;
+    circ->buf = malloc(circ->size);
+    circ->sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (!circ->buf || circ->sock < 0)
+        goto fail;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(circ->sock, (struct sockaddr *) &addr, sizeof(addr)))
+        goto fail;
+    setsockopt(circ->sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    if (benchCircuitSend(circ, CA_PROTO_VERSION, 0,
+            CA_MINOR_PROTOCOL_REVISION, 0, 0, NULL, 0) ||
+        benchCircuitSend(circ, CA_PROTO_CLIENT_NAME, 0, 0, 0, 0,
+            "bench", 6) ||
+        benchCircuitSend(circ, CA_PROTO_HOST_NAME, 0, 0, 0, 0,
+            "localhost", 10))
+        goto fail;
+
+    fcntl(circ->sock, F_SETFL, fcntl(circ->sock, F_GETFL) | O_NONBLOCK);
+    return 0;
+fail:
+    benchCircuitClose(circ);
+    return -1;
+}
+
+void benchCircuitClose(benchCircuit *circ)
+{
+    if (circ->sock >= 0)
+        close(circ->sock);
+    circ->sock = -1;
+    free(circ->buf);
+    circ->buf = NULL;
+}
+
+void benchCircuitPoll(benchCircuit *circs, unsigned n, double timeout)
+{
+    struct pollfd small[16], *fds = small;
+    unsigned i;
+
+    if (n > NELEMENTS(small)) {
+        fds = calloc(n, sizeof(*fds));
+        if (!fds)
+            return;
+    }
+    for (i = 0; i < n; i++) {
+        fds[i].fd = circs[i].sock;
+        fds[i].events = POLLIN;
+        fds[i].revents = 0;
+    }
+    poll(fds, n, (int) (timeout * 1000.0));
+    if (fds != small)
+        free(fds);
+}
+
+int benchCircuitRead(benchCircuit *circ,
+    void (*onMsg)(benchCircuit *circ, const benchMsg *msg))
+{
+    int nmsg = 0;
+
+    while (1) {
+        size_t pos = 0;
+        ssize_t n;
+
+        if (circ->cnt == circ->size) {
+            char *nbuf = realloc(circ->buf, circ->size * 2);
+            if (!nbuf)
+                return -1;
+            circ->buf = nbuf;
+            circ->size *= 2;
+        }
+
+        n = recv(circ->sock, circ->buf + circ->cnt, circ->size - circ->cnt, 0);
+        if (n == 0)
+            return -1;
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            return -1;
+        }
+        circ->cnt += n;
+
+        while (circ->cnt - pos >= sizeof(caHdr)) {
+            const caHdr *hdr = (const caHdr *) (circ->buf + pos);
+            size_t hdrSize = sizeof(caHdr);
+            benchMsg msg;
+
+            msg.cmmd = ntohs(hdr->m_cmmd);
+            msg.dataType = ntohs(hdr->m_dataType);
+            msg.cid = ntohl(hdr->m_cid);
+            msg.available = ntohl(hdr->m_available);
+            msg.postsize = ntohs(hdr->m_postsize);
+            msg.count = ntohs(hdr->m_count);
+            if (msg.postsize == 0xffff) {
+                const ca_uint32_t *pW32 = (const ca_uint32_t *) (hdr + 1);
+                hdrSize += 2 * sizeof(ca_uint32_t);
+                if (circ->cnt - pos < hdrSize)
+                    break;
+                msg.postsize = ntohl(pW32[0]);
+                msg.count = ntohl(pW32[1]);
+            }
+            if (circ->cnt - pos < hdrSize + msg.postsize)
+                break;
+            msg.payload = circ->buf + pos + hdrSize;
+            if (onMsg)
+                (*onMsg)(circ, &msg);
+            pos += hdrSize + msg.postsize;
+            nmsg++;
+        }
+
+        if (pos) {
+            memmove(circ->buf, circ->buf + pos, circ->cnt - pos);
+            circ->cnt -= pos;
+        }
+    }
+    return nmsg;
+}
+
+int benchCreateChan(benchCircuit *circ, const char *name, epicsUInt32 cid)
+{
+    return benchCircuitSend(circ, CA_PROTO_CREATE_CHAN, 0, 0, cid,
+        CA_MINOR_PROTOCOL_REVISION, name, strlen(name) + 1);
+}
+
+int benchEventAdd(benchCircuit *circ, unsigned dbrType, epicsUInt32 count,
+    epicsUInt32 sid, epicsUInt32 subid, unsigned mask)
+{
+    struct mon_info mon;
+
+    memset(&mon, 0, sizeof(mon));
+    mon.m_mask = htons((ca_uint16_t) mask);
+    return benchCircuitSend(circ, CA_PROTO_EVENT_ADD, dbrType, count,
+        sid, subid, &mon, sizeof(mon));
+}
+
+#else /* __linux__ */
+
+void benchIocMain(void (*atInit)(void)) {}
+
+int benchIocStart(benchIoc *ioc, const char *db, const char *macros,
+    const char *cmds)
+{
+    return -1;
+}
+
+void benchIocStop(benchIoc *ioc) {}
+int benchIocThreads(const benchIoc *ioc) { return -1; }
+double benchIocCpuSeconds(const benchIoc *ioc) { return -1.0; }
+unsigned long benchRaiseFdLimit(unsigned long want) { return 0; }
+double benchNow(void) { return 0.0; }
+
+int benchCircuitConnect(benchCircuit *circ, unsigned short port)
+{
+    return -1;
+}
+
+void benchCircuitClose(benchCircuit *circ) {}
+
+int benchCircuitSend(benchCircuit *circ, unsigned cmmd, unsigned dataType,
+    epicsUInt32 count, epicsUInt32 cid, epicsUInt32 available,
+    const void *payload, size_t payloadSize)
+{
+    return -1;
+}
+
+void benchCircuitPoll(benchCircuit *circs, unsigned n, double timeout) {}
+
+int benchCircuitRead(benchCircuit *circ,
+    void (*onMsg)(benchCircuit *circ, const benchMsg *msg))
+{
+    return -1;
+}
+
+int benchCreateChan(benchCircuit *circ, const char *name, epicsUInt32 cid)
+{
+    return -1;
+}
+
+int benchEventAdd(benchCircuit *circ, unsigned dbrType, epicsUInt32 count,
+    epicsUInt32 sid, epicsUInt32 subid, unsigned mask)
+{
+    return -1;
+}
+
+#endif /* __linux__ */
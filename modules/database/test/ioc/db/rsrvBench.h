@@ -0,0 +1,103 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Helpers shared by the RSRV benchmark programs.
+ *
+ * The IOC under test runs in a child process so that its thread count
+ * and CPU time can be measured separately from the load generator,
+ * which talks raw CA protocol over plain sockets.
+ *
+ * Only implemented for Linux (fork() and /proc).
+ */
+
+#ifndef RSRVBENCH_H
+#define RSRVBENCH_H
+
+#include <stddef.h>
+
+#include "epicsTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct benchIoc {
+    int pid;
+    int ctl;                /* closing this stops the IOC */
+    unsigned short port;    /* CA server TCP and UDP port */
+} benchIoc;
+
+/* Start an IOC in a child process loading dbTestIoc.dbd and the given
+ * database, then running the ';' separated iocsh commands in cmds
+ * before iocInit().  Returns non-zero on failure.
+ *
+ * The child re-executes the current program, which must call
+ * benchIocMain() before doing anything else.  In the child atInit(),
+ * if given, runs after iocInit().
+ */
+int benchIocStart(benchIoc *ioc, const char *db, const char *macros,
+    const char *cmds);
+void benchIocMain(void (*atInit)(void));
+void benchIocStop(benchIoc *ioc);
+
+/* Resources used by the IOC process so far */
+int benchIocThreads(const benchIoc *ioc);
+double benchIocCpuSeconds(const benchIoc *ioc);
+
+/* Try to allow this many file descriptors, returns the limit */
+unsigned long benchRaiseFdLimit(unsigned long want);
+
+typedef struct benchMsg {
+    epicsUInt16 cmmd;
+    epicsUInt16 dataType;
+    epicsUInt32 count;
+    epicsUInt32 cid;
+    epicsUInt32 available;
+    epicsUInt32 postsize;
+    const char *payload;
+} benchMsg;
+
+typedef struct benchCircuit {
+    int sock;
+    char *buf;
+    size_t cnt, size;
+    void *pvt;              /* for use by the benchmark */
+} benchCircuit;
+
+/* Connect to the IOC and send version, client and host name.
+ * Only circ->pvt is kept.  The socket is left in non-blocking mode.
+ */
+int benchCircuitConnect(benchCircuit *circ, unsigned short port);
+void benchCircuitClose(benchCircuit *circ);
+
+/* Queue a request, blocks until it has been sent */
+int benchCircuitSend(benchCircuit *circ, unsigned cmmd, unsigned dataType,
+    epicsUInt32 count, epicsUInt32 cid, epicsUInt32 available,
+    const void *payload, size_t payloadSize);
+
+/* Read whatever is available and call onMsg() for each complete message.
+ * Returns the number of messages, or -1 if the circuit was closed.
+ */
+int benchCircuitRead(benchCircuit *circ,
+    void (*onMsg)(benchCircuit *circ, const benchMsg *msg));
+
+/* Wait up to timeout seconds for any of the circuits to be readable */
+void benchCircuitPoll(benchCircuit *circs, unsigned n, double timeout);
+
+/* Convenience wrappers */
+int benchCreateChan(benchCircuit *circ, const char *name, epicsUInt32 cid);
+int benchEventAdd(benchCircuit *circ, unsigned dbrType, epicsUInt32 count,
+    epicsUInt32 sid, epicsUInt32 subid, unsigned mask);
+
+double benchNow(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RSRVBENCH_H */
@@ -149,10 +149,47 @@ static void testBasicPut(void)
     free(scratch);
 }
 
+static void testConvertWrap(void)
+{
+    double dbuf[NELEMENTS(s_input)];
+    short sbuf[NELEMENTS(s_input)];
+    DBADDR addr;
+    GETCONVERTFUNC getter = dbGetConvertRoutine[DBF_SHORT][DBF_DOUBLE];
+    PUTCONVERTFUNC putter = dbPutConvertRoutine[DBF_DOUBLE][DBF_SHORT];
+    long offset, i;
+
+    testDiag("Test converting with wrap, DBF_SHORT to and from DBF_DOUBLE");
+
+    memset(&addr, 0, sizeof(addr));
+    addr.field_type = DBF_SHORT;
+    addr.field_size = sizeof(short);
+    addr.no_elements = s_input_len;
+
+    for (offset = 0; offset < s_input_len; offset++) {
+        int bad = 0;
+
+        addr.pfield = (void*)s_input;
+        getter(&addr, dbuf, s_input_len, s_input_len, offset);
+        for (i = 0; i < s_input_len; i++)
+            bad += dbuf[i] != s_input[(offset + i) % s_input_len];
+
+        memset(sbuf, 0x42, sizeof(sbuf));
+        addr.pfield = sbuf;
+        putter(&addr, dbuf, s_input_len - 1, s_input_len, offset);
+        for (i = 0; i < s_input_len - 1; i++)
+            bad += sbuf[(offset + i) % s_input_len] !=
+                s_input[(offset + i) % s_input_len];
+        bad += sbuf[(offset + s_input_len - 1) % s_input_len] != 0x4242;
+
+        testOk(!bad, "offset %ld", offset);
+    }
+}
+
 MAIN(testdbConvert)
 {
-    testPlan(15);
+    testPlan(22);
     testBasicGet();
     testBasicPut();
+    testConvertWrap();
     return testDone();
 }
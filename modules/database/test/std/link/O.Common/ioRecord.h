@@ -0,0 +1,255 @@
+/** @file ioRecord.h
+ * @brief Declarations for the @ref ioRecord "io" record type.
+ *
+ * This header was generated from ioRecord.dbd
+ */
+
+#ifndef INC_ioRecord_H
+#define INC_ioRecord_H
+
+#include "epicsTypes.h"
+#include "link.h"
+#include "epicsMutex.h"
+#include "ellLib.h"
+#include "devSup.h"
+#include "epicsTime.h"
+
+/** @brief Declaration of io record type. */
+typedef struct ioRecord {
+    char                name[61];   /**< @brief Record Name */
+    char                desc[41];   /**< @brief Descriptor */
+    char                asg[29];    /**< @brief Access Security Group */
+    epicsEnum16         scan;       /**< @brief Scan Mechanism */
+    epicsEnum16         pini;       /**< @brief Process at iocInit */
+    epicsInt16          phas;       /**< @brief Scan Phase */
+    char                evnt[40];   /**< @brief Event Name */
+    epicsInt16          tse;        /**< @brief Time Stamp Event */
+    DBLINK              tsel;       /**< @brief Time Stamp Link */
+    epicsEnum16         dtyp;       /**< @brief Device Type */
+    epicsInt16          disv;       /**< @brief Disable Value */
+    epicsInt16          disa;       /**< @brief Disable */
+    DBLINK              sdis;       /**< @brief Scanning Disable */
+    epicsMutexId        mlok;       /**< @brief Monitor lock */
+    ELLLIST             mlis;       /**< @brief Monitor List */
+    ELLLIST             bklnk;      /**< @brief Backwards link tracking */
+    epicsUInt8          disp;       /**< @brief Disable putField */
+    epicsUInt8          proc;       /**< @brief Force Processing */
+    epicsEnum16         stat;       /**< @brief Alarm Status */
+    epicsEnum16         sevr;       /**< @brief Alarm Severity */
+    char                amsg[40];   /**< @brief Alarm Message */
+    epicsEnum16         nsta;       /**< @brief New Alarm Status */
+    epicsEnum16         nsev;       /**< @brief New Alarm Severity */
+    char                namsg[40];  /**< @brief New Alarm Message */
+    epicsEnum16         acks;       /**< @brief Alarm Ack Severity */
+    epicsEnum16         ackt;       /**< @brief Alarm Ack Transient */
+    epicsEnum16         diss;       /**< @brief Disable Alarm Sevrty */
+    epicsUInt8          lcnt;       /**< @brief Lock Count */
+    epicsUInt8          pact;       /**< @brief Record active */
+    epicsUInt8          putf;       /**< @brief dbPutField process */
+    epicsUInt8          rpro;       /**< @brief Reprocess  */
+    struct asgMember    *asp;       /**< @brief Access Security Pvt */
+    struct processNotify *ppn;      /**< @brief pprocessNotify */
+    struct processNotifyRecord *ppnr; /**< @brief pprocessNotifyRecord */
+    struct scan_element *spvt;      /**< @brief Scan Private */
+    struct typed_rset   *rset;      /**< @brief Address of RSET */
+    unambiguous_dset    *dset;      /**< @brief DSET address */
+    void                *dpvt;      /**< @brief Device Private */
+    struct dbRecordType *rdes;      /**< @brief Address of dbRecordType */
+    struct lockRecord   *lset;      /**< @brief Lock Set */
+    epicsEnum16         prio;       /**< @brief Scheduling Priority */
+    epicsUInt8          tpro;       /**< @brief Trace Processing */
+    epicsUInt8          bkpt;       /**< @brief Break Point */
+    epicsUInt8          udf;        /**< @brief Undefined */
+    epicsEnum16         udfs;       /**< @brief Undefined Alarm Sevrty */
+    epicsTimeStamp      time;       /**< @brief Time */
+    epicsUInt64         utag;       /**< @brief Time Tag */
+    DBLINK              flnk;       /**< @brief Forward Process Link */
+    epicsInt32          val;        /**< @brief Value */
+    DBLINK              input;      /**< @brief Input Link */
+    DBLINK              output;     /**< @brief Output Link */
+} ioRecord;
+
+typedef enum {
+	ioRecordNAME = 0,
+	ioRecordDESC = 1,
+	ioRecordASG = 2,
+	ioRecordSCAN = 3,
+	ioRecordPINI = 4,
+	ioRecordPHAS = 5,
+	ioRecordEVNT = 6,
+	ioRecordTSE = 7,
+	ioRecordTSEL = 8,
+	ioRecordDTYP = 9,
+	ioRecordDISV = 10,
+	ioRecordDISA = 11,
+	ioRecordSDIS = 12,
+	ioRecordMLOK = 13,
+	ioRecordMLIS = 14,
+	ioRecordBKLNK = 15,
+	ioRecordDISP = 16,
+	ioRecordPROC = 17,
+	ioRecordSTAT = 18,
+	ioRecordSEVR = 19,
+	ioRecordAMSG = 20,
+	ioRecordNSTA = 21,
+	ioRecordNSEV = 22,
+	ioRecordNAMSG = 23,
+	ioRecordACKS = 24,
+	ioRecordACKT = 25,
+	ioRecordDISS = 26,
+	ioRecordLCNT = 27,
+	ioRecordPACT = 28,
+	ioRecordPUTF = 29,
+	ioRecordRPRO = 30,
+	ioRecordASP = 31,
+	ioRecordPPN = 32,
+	ioRecordPPNR = 33,
+	ioRecordSPVT = 34,
+	ioRecordRSET = 35,
+	ioRecordDSET = 36,
+	ioRecordDPVT = 37,
+	ioRecordRDES = 38,
+	ioRecordLSET = 39,
+	ioRecordPRIO = 40,
+	ioRecordTPRO = 41,
+	ioRecordBKPT = 42,
+	ioRecordUDF = 43,
+	ioRecordUDFS = 44,
+	ioRecordTIME = 45,
+	ioRecordUTAG = 46,
+	ioRecordFLNK = 47,
+	ioRecordVAL = 48,
+	ioRecordINPUT = 49,
+	ioRecordOUTPUT = 50
+} ioFieldIndex;
+
+#ifdef GEN_SIZE_OFFSET
+
+#include <epicsExport.h>
+#include <cantProceed.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+static int ioRecordSizeOffset(dbRecordType *prt)
+{
+    ioRecord *prec = 0;
+
+    if (prt->no_fields != 51) {
+        cantProceed("IOC build or installation error:\n"
+            "    The ioRecord defined in the DBD file has %d fields,\n"
+            "    but the record support code was built with 51.\n",
+            prt->no_fields);
+    }
+    prt->papFldDes[ioRecordNAME]->size = sizeof(prec->name);
+    prt->papFldDes[ioRecordNAME]->offset = (unsigned short)offsetof(ioRecord, name);
+    prt->papFldDes[ioRecordDESC]->size = sizeof(prec->desc);
+    prt->papFldDes[ioRecordDESC]->offset = (unsigned short)offsetof(ioRecord, desc);
+    prt->papFldDes[ioRecordASG]->size = sizeof(prec->asg);
+    prt->papFldDes[ioRecordASG]->offset = (unsigned short)offsetof(ioRecord, asg);
+    prt->papFldDes[ioRecordSCAN]->size = sizeof(prec->scan);
+    prt->papFldDes[ioRecordSCAN]->offset = (unsigned short)offsetof(ioRecord, scan);
+    prt->papFldDes[ioRecordPINI]->size = sizeof(prec->pini);
+    prt->papFldDes[ioRecordPINI]->offset = (unsigned short)offsetof(ioRecord, pini);
+    prt->papFldDes[ioRecordPHAS]->size = sizeof(prec->phas);
+    prt->papFldDes[ioRecordPHAS]->offset = (unsigned short)offsetof(ioRecord, phas);
+    prt->papFldDes[ioRecordEVNT]->size = sizeof(prec->evnt);
+    prt->papFldDes[ioRecordEVNT]->offset = (unsigned short)offsetof(ioRecord, evnt);
+    prt->papFldDes[ioRecordTSE]->size = sizeof(prec->tse);
+    prt->papFldDes[ioRecordTSE]->offset = (unsigned short)offsetof(ioRecord, tse);
+    prt->papFldDes[ioRecordTSEL]->size = sizeof(prec->tsel);
+    prt->papFldDes[ioRecordTSEL]->offset = (unsigned short)offsetof(ioRecord, tsel);
+    prt->papFldDes[ioRecordDTYP]->size = sizeof(prec->dtyp);
+    prt->papFldDes[ioRecordDTYP]->offset = (unsigned short)offsetof(ioRecord, dtyp);
+    prt->papFldDes[ioRecordDISV]->size = sizeof(prec->disv);
+    prt->papFldDes[ioRecordDISV]->offset = (unsigned short)offsetof(ioRecord, disv);
+    prt->papFldDes[ioRecordDISA]->size = sizeof(prec->disa);
+    prt->papFldDes[ioRecordDISA]->offset = (unsigned short)offsetof(ioRecord, disa);
+    prt->papFldDes[ioRecordSDIS]->size = sizeof(prec->sdis);
+    prt->papFldDes[ioRecordSDIS]->offset = (unsigned short)offsetof(ioRecord, sdis);
+    prt->papFldDes[ioRecordMLOK]->size = sizeof(prec->mlok);
+    prt->papFldDes[ioRecordMLOK]->offset = (unsigned short)offsetof(ioRecord, mlok);
+    prt->papFldDes[ioRecordMLIS]->size = sizeof(prec->mlis);
+    prt->papFldDes[ioRecordMLIS]->offset = (unsigned short)offsetof(ioRecord, mlis);
+    prt->papFldDes[ioRecordBKLNK]->size = sizeof(prec->bklnk);
+    prt->papFldDes[ioRecordBKLNK]->offset = (unsigned short)offsetof(ioRecord, bklnk);
+    prt->papFldDes[ioRecordDISP]->size = sizeof(prec->disp);
+    prt->papFldDes[ioRecordDISP]->offset = (unsigned short)offsetof(ioRecord, disp);
+    prt->papFldDes[ioRecordPROC]->size = sizeof(prec->proc);
+    prt->papFldDes[ioRecordPROC]->offset = (unsigned short)offsetof(ioRecord, proc);
+    prt->papFldDes[ioRecordSTAT]->size = sizeof(prec->stat);
+    prt->papFldDes[ioRecordSTAT]->offset = (unsigned short)offsetof(ioRecord, stat);
+    prt->papFldDes[ioRecordSEVR]->size = sizeof(prec->sevr);
+    prt->papFldDes[ioRecordSEVR]->offset = (unsigned short)offsetof(ioRecord, sevr);
+    prt->papFldDes[ioRecordAMSG]->size = sizeof(prec->amsg);
+    prt->papFldDes[ioRecordAMSG]->offset = (unsigned short)offsetof(ioRecord, amsg);
+    prt->papFldDes[ioRecordNSTA]->size = sizeof(prec->nsta);
+    prt->papFldDes[ioRecordNSTA]->offset = (unsigned short)offsetof(ioRecord, nsta);
+    prt->papFldDes[ioRecordNSEV]->size = sizeof(prec->nsev);
+    prt->papFldDes[ioRecordNSEV]->offset = (unsigned short)offsetof(ioRecord, nsev);
+    prt->papFldDes[ioRecordNAMSG]->size = sizeof(prec->namsg);
+    prt->papFldDes[ioRecordNAMSG]->offset = (unsigned short)offsetof(ioRecord, namsg);
+    prt->papFldDes[ioRecordACKS]->size = sizeof(prec->acks);
+    prt->papFldDes[ioRecordACKS]->offset = (unsigned short)offsetof(ioRecord, acks);
+    prt->papFldDes[ioRecordACKT]->size = sizeof(prec->ackt);
+    prt->papFldDes[ioRecordACKT]->offset = (unsigned short)offsetof(ioRecord, ackt);
+    prt->papFldDes[ioRecordDISS]->size = sizeof(prec->diss);
+    prt->papFldDes[ioRecordDISS]->offset = (unsigned short)offsetof(ioRecord, diss);
+    prt->papFldDes[ioRecordLCNT]->size = sizeof(prec->lcnt);
+    prt->papFldDes[ioRecordLCNT]->offset = (unsigned short)offsetof(ioRecord, lcnt);
+    prt->papFldDes[ioRecordPACT]->size = sizeof(prec->pact);
+    prt->papFldDes[ioRecordPACT]->offset = (unsigned short)offsetof(ioRecord, pact);
+    prt->papFldDes[ioRecordPUTF]->size = sizeof(prec->putf);
+    prt->papFldDes[ioRecordPUTF]->offset = (unsigned short)offsetof(ioRecord, putf);
+    prt->papFldDes[ioRecordRPRO]->size = sizeof(prec->rpro);
+    prt->papFldDes[ioRecordRPRO]->offset = (unsigned short)offsetof(ioRecord, rpro);
+    prt->papFldDes[ioRecordASP]->size = sizeof(prec->asp);
+    prt->papFldDes[ioRecordASP]->offset = (unsigned short)offsetof(ioRecord, asp);
+    prt->papFldDes[ioRecordPPN]->size = sizeof(prec->ppn);
+    prt->papFldDes[ioRecordPPN]->offset = (unsigned short)offsetof(ioRecord, ppn);
+    prt->papFldDes[ioRecordPPNR]->size = sizeof(prec->ppnr);
+    prt->papFldDes[ioRecordPPNR]->offset = (unsigned short)offsetof(ioRecord, ppnr);
+    prt->papFldDes[ioRecordSPVT]->size = sizeof(prec->spvt);
+    prt->papFldDes[ioRecordSPVT]->offset = (unsigned short)offsetof(ioRecord, spvt);
+    prt->papFldDes[ioRecordRSET]->size = sizeof(prec->rset);
+    prt->papFldDes[ioRecordRSET]->offset = (unsigned short)offsetof(ioRecord, rset);
+    prt->papFldDes[ioRecordDSET]->size = sizeof(prec->dset);
+    prt->papFldDes[ioRecordDSET]->offset = (unsigned short)offsetof(ioRecord, dset);
+    prt->papFldDes[ioRecordDPVT]->size = sizeof(prec->dpvt);
+    prt->papFldDes[ioRecordDPVT]->offset = (unsigned short)offsetof(ioRecord, dpvt);
+    prt->papFldDes[ioRecordRDES]->size = sizeof(prec->rdes);
+    prt->papFldDes[ioRecordRDES]->offset = (unsigned short)offsetof(ioRecord, rdes);
+    prt->papFldDes[ioRecordLSET]->size = sizeof(prec->lset);
+    prt->papFldDes[ioRecordLSET]->offset = (unsigned short)offsetof(ioRecord, lset);
+    prt->papFldDes[ioRecordPRIO]->size = sizeof(prec->prio);
+    prt->papFldDes[ioRecordPRIO]->offset = (unsigned short)offsetof(ioRecord, prio);
+    prt->papFldDes[ioRecordTPRO]->size = sizeof(prec->tpro);
+    prt->papFldDes[ioRecordTPRO]->offset = (unsigned short)offsetof(ioRecord, tpro);
+    prt->papFldDes[ioRecordBKPT]->size = sizeof(prec->bkpt);
+    prt->papFldDes[ioRecordBKPT]->offset = (unsigned short)offsetof(ioRecord, bkpt);
+    prt->papFldDes[ioRecordUDF]->size = sizeof(prec->udf);
+    prt->papFldDes[ioRecordUDF]->offset = (unsigned short)offsetof(ioRecord, udf);
+    prt->papFldDes[ioRecordUDFS]->size = sizeof(prec->udfs);
+    prt->papFldDes[ioRecordUDFS]->offset = (unsigned short)offsetof(ioRecord, udfs);
+    prt->papFldDes[ioRecordTIME]->size = sizeof(prec->time);
+    prt->papFldDes[ioRecordTIME]->offset = (unsigned short)offsetof(ioRecord, time);
+    prt->papFldDes[ioRecordUTAG]->size = sizeof(prec->utag);
+    prt->papFldDes[ioRecordUTAG]->offset = (unsigned short)offsetof(ioRecord, utag);
+    prt->papFldDes[ioRecordFLNK]->size = sizeof(prec->flnk);
+    prt->papFldDes[ioRecordFLNK]->offset = (unsigned short)offsetof(ioRecord, flnk);
+    prt->papFldDes[ioRecordVAL]->size = sizeof(prec->val);
+    prt->papFldDes[ioRecordVAL]->offset = (unsigned short)offsetof(ioRecord, val);
+    prt->papFldDes[ioRecordINPUT]->size = sizeof(prec->input);
+    prt->papFldDes[ioRecordINPUT]->offset = (unsigned short)offsetof(ioRecord, input);
+    prt->papFldDes[ioRecordOUTPUT]->size = sizeof(prec->output);
+    prt->papFldDes[ioRecordOUTPUT]->offset = (unsigned short)offsetof(ioRecord, output);
+    prt->rec_size = sizeof(*prec);
+    return 0;
+}
+epicsExportRegistrar(ioRecordSizeOffset);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* GEN_SIZE_OFFSET */
+
+#endif /* INC_ioRecord_H */
@@ -108,6 +108,58 @@ static void testCalc()
         testOk(sevr == MINOR_ALARM, "Alarm severity = MINOR (%d)", sevr);
     }
 
+    testDiag("testing lnkCalc array input");
+
+    {
+        epicsFloat64 arr[10] = {0};
+        long nReq = NELEMENTS(arr);
+        DBADDR addr;
+        static const char major[] = "{calc:{"
+            "expr:'A', major:'A', args:[{const:[1,2]}], nelm:2}}";
+
+        testPutLongStr("io.INPUT", "{calc:{"
+            "expr:'A*B+C',"
+            "args:[{const:[1,2,3,4]},{const:[10,20,30,40,50]},5],"
+            "nelm:10"
+            "}}");
+        status = dbGetNelements(pinp, &nReq);
+        testOk(!status && nReq == 10, "dbGetNelements returned %ld", nReq);
+
+        nReq = NELEMENTS(arr);
+        status = dbGetLink(pinp, DBF_DOUBLE, arr, NULL, &nReq);
+        testOk(!status, "dbGetLink succeeded (status = %ld)", status);
+        testOk(nReq == 4, "Got 4 elements (%ld)", nReq);
+        testOk(arr[0] == 15 && arr[1] == 45 && arr[2] == 95 && arr[3] == 165,
+            "Got [15, 45, 95, 165] ([%g, %g, %g, %g])",
+            arr[0], arr[1], arr[2], arr[3]);
+
+        nReq = 2;
+        arr[2] = 0;
+        status = dbGetLink(pinp, DBF_DOUBLE, arr, NULL, &nReq);
+        testOk(!status && nReq == 2 && arr[1] == 45 && arr[2] == 0,
+            "Got 2 elements when asked (%ld)", nReq);
+
+        testPutLongStr("io.INPUT", "{calc:{"
+            "expr:'VAL+A',"
+            "args:[{const:[1,2,3]}],"
+            "nelm:3"
+            "}}");
+        nReq = NELEMENTS(arr);
+        dbGetLink(pinp, DBF_DOUBLE, arr, NULL, &nReq);
+        status = dbGetLink(pinp, DBF_DOUBLE, arr, NULL, &nReq);
+        testOk(!status && nReq == 3 &&
+            arr[0] == 2 && arr[1] == 4 && arr[2] == 6,
+            "VAL holds the previous results ([%g, %g, %g])",
+            arr[0], arr[1], arr[2]);
+
+        testOk1(!dbNameToAddr("io.INPUT", &addr));
+        eltc(0);
+        status = dbPutField(&addr, DBF_CHAR, major, sizeof(major));
+        eltc(1);
+        testOk(status, "nelm rejected with alarm expressions (status = %ld)",
+            status);
+    }
+
     testDiag("testing lnkCalc output");
 
     {
@@ -157,7 +209,7 @@ static void testCalc()
 
 MAIN(lnkCalcTest)
 {
-    testPlan(30);
+    testPlan(40);
 
     testCalc();
 
@@ -0,0 +1,1022 @@
+#define YYBYACC 1
+#define YYMAJOR 1
+#define YYMINOR 9
+#define yyclearin (yychar=(-1))
+#define yyerrok (yyerrflag=0)
+#define YYRECOVERING (yyerrflag!=0)
+static int yyparse(void);
+#define YYPREFIX "yy"
+#line 11 "../as/asLib.y"
+static int yyerror(char *);
+static int yy_start;
+#include "asLibRoutines.c"
+static int yyFailed = FALSE;
+static int yyWarned = FALSE;
+static int line_num=1;
+static UAG *yyUag=NULL;
+static HAG *yyHag=NULL;
+static ASG *yyAsg=NULL;
+static ASGRULE *yyAsgRule=NULL;
+
+static ELLLIST yyCertPath;
+typedef struct {
+    ELLNODE node;
+    char *commonName;
+} CertPathNode_t;
+
+static int saveAuthorityEntry(char *name);
+
+static int pushCertPath(char *commonName);
+static void popCertPath();
+
+static char *getCurrentCertPath();
+
+static void initCertPathStack();
+static void freeCertPathStack();
+
+static int _pushCertPath(const char *commonName);
+#line 47 "../as/asLib.y"
+typedef union {
+    epicsInt64 Int64;
+    epicsFloat64 Float64;
+    char *Str;
+} YYSTYPE;
+#line 45 "asLib.tab.c"
+#define tokenUAG 257
+#define tokenHAG 258
+#define tokenASG 259
+#define tokenRULE 260
+#define tokenCALC 261
+#define tokenINP 262
+#define tokenMETHOD 263
+#define tokenAUTHORITY 264
+#define tokenPROTOCOL 265
+#define tokenSTRING 266
+#define tokenINT64 267
+#define tokenFLOAT64 268
+#define YYERRCODE 256
+static short yylhs[] = {                                        -1,
+    0,    0,    8,    8,    8,    8,    8,    8,    8,    8,
+    7,    7,    7,    7,    7,    7,    7,    2,    2,    2,
+   16,   16,   16,   17,   17,   17,   18,   21,   21,   20,
+   20,   20,   20,   19,   19,   19,   22,   22,    4,    4,
+    3,    3,    5,    5,    6,    6,    9,   10,   23,   23,
+   24,   11,   12,   25,   25,   26,   13,   13,   27,   27,
+   28,   29,   29,   31,   30,   30,    1,    1,   14,   15,
+   32,   32,   33,   33,   34,   35,   35,   36,   36,   38,
+   39,   37,   40,   40,   41,   41,   41,   41,   41,   41,
+   41,   42,   42,   46,   43,   43,   47,   44,   44,   48,
+   45,   45,   49,
+};
+static short yylen[] = {                                         2,
+    2,    1,    3,    2,    3,    2,    2,    3,    2,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    3,    3,    2,    2,    3,    3,    6,    3,    3,    1,
+    1,    1,    1,    3,    3,    3,    2,    1,    3,    2,
+    1,    1,    3,    2,    1,    1,    3,    3,    3,    1,
+    1,    3,    3,    3,    1,    1,    2,    1,    5,    3,
+    3,    2,    1,    0,    4,    2,    5,    3,    3,    3,
+    2,    1,    1,    1,    4,    3,    2,    5,    3,    3,
+    1,    3,    2,    1,    4,    4,    4,    4,    4,    4,
+    1,    3,    1,    1,    3,    1,    1,    3,    1,    1,
+    3,    1,    1,
+};
+static short yydefred[] = {                                      0,
+    0,    0,    0,    0,    0,    0,    2,   10,    0,    0,
+    0,    0,    0,    0,    0,    7,    0,    0,    0,    1,
+    0,    0,    3,    0,    0,    5,    0,    0,    8,    0,
+    0,   57,   11,   12,   18,   19,   13,   20,   14,   15,
+   16,   31,   32,   33,   24,   17,   30,    0,    0,    0,
+   21,   22,   47,   51,    0,   50,   52,   56,    0,   55,
+   69,    0,    0,    0,   72,   73,   74,   60,    0,    0,
+    0,    0,   25,    0,   26,    0,    0,    0,   38,    0,
+    0,    0,    0,   48,    0,   53,    0,    0,    0,    0,
+   70,   71,    0,    0,    0,   61,   62,   29,   28,    0,
+    0,   35,   42,   36,   37,   41,   49,   54,    0,    0,
+    0,   76,    0,   59,    0,    0,    0,   39,    0,    0,
+   79,    0,    0,    0,    0,    0,    0,    0,   46,   45,
+   91,    0,    0,   84,   75,   68,    0,   65,    0,    0,
+    0,   80,   81,    0,    0,    0,    0,    0,    0,    0,
+    0,   82,   83,    0,   34,   27,   78,   94,    0,   93,
+   97,    0,   96,    0,  100,    0,   99,  103,    0,  102,
+    0,   43,   67,   85,    0,   86,    0,   90,   87,    0,
+   88,    0,   89,   92,   95,   98,  101,
+};
+static short yydgoto[] = {                                       6,
+   95,   46,   78,   79,  131,  132,   47,    7,   10,   23,
+   12,   26,   16,   14,   29,    8,   19,   51,   52,   48,
+   82,   83,   55,   56,   59,   60,   17,   32,   71,   72,
+  116,   64,   65,   66,   67,   89,  112,  110,  144,  133,
+  134,  159,  162,  166,  169,  160,  163,  167,  170,
+};
+static short yysindex[] = {                                   -183,
+  -11,   -3,   -2,    3,   18, -183,    0,    0, -188,  -39,
+ -180,  -22, -149,   -4, -148,    0,   -1,  -41,    2,    0,
+   79, -145,    0,   82, -142,    0,   85, -190,    0,  -20,
+ -137,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  -16,  -10, -211,
+    0,    0,    0,    0,  -37,    0,    0,    0,  -36,    0,
+    0,   88,   89,  -85,    0,    0,    0,    0, -136,   91,
+    7, -137,    0, -152,    0, -152,    0,   18,    0,    0,
+  -33,  -31, -123,    0, -145,    0, -142, -134,   56,  -86,
+    0,    0,  140,  -83,    0,    0,    0,    0,    0,   61,
+   62,    0,    0,    0,    0,    0,    0,    0,  138,   -5,
+ -197,    0,  145,    0,   36,   -1, -211,    0, -152,  -79,
+    0,  -78,  149,  150,  151,  152,  153,  154,    0,    0,
+    0,   18, -113,    0,    0,    0,  -71,    0,  -29,  155,
+  -28,    0,    0,  156,  -70,  -68,  -66,  -65,  -64,  -63,
+   61,    0,    0,  163,    0,    0,    0,    0,   38,    0,
+    0,   54,    0,  164,    0,   58,    0,    0,   59,    0,
+  165,    0,    0,    0,  -70,    0,  -68,    0,    0,  -65,
+    0,  -64,    0,    0,    0,    0,    0,
+};
+static short yyrindex[] = {                                      0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
+    0,    4,    0,   14,    0,    0,   17,    0,   27,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   83,    0,    0,    0,    0,  -35,    0,    0,  -34,
+    0,    0,    0,    0,    0,    0,    0,    0,  -84,    0,
+    0,    0,    0,    0,  -90,    0,    0,    0,    0, -103,
+   30,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  -93,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,
+};
+static short yygindex[] = {                                      0,
+    0,  -88,    0,  124,    0,    0,  -24,  203,    0,    0,
+    0,    0,    0,    0,    0,    0,  -59,    0,  -80,  -32,
+  -15,    0,    0,  125,    0,  126,    0,   95,  142,    0,
+    0,    0,  148,    0,    0,    0,    0,    0,    0,    0,
+   96,    0,    0,    0,    0,   40,   51,   50,   49,
+};
+#define YYTABLESIZE 296
+static short yytable[] = {                                      45,
+    4,  104,   49,    6,   42,   41,   85,   87,   31,   30,
+   74,  152,   76,    9,   74,   76,   58,   81,  100,  118,
+   68,   40,  130,   69,   73,   80,   23,   74,    9,   34,
+   75,   44,   64,   76,   66,  121,   11,   13,  122,   91,
+   77,   98,   15,   99,  130,   33,   34,   35,   36,   37,
+   38,   39,   40,   41,   77,   43,   44,   18,  106,  123,
+  124,   35,   36,  125,   38,  126,  127,  128,  129,   62,
+  172,   63,  151,    1,    2,    3,  136,   21,  174,  137,
+    4,  175,    5,   22,  139,   24,  140,   84,   86,   31,
+   30,  101,   80,  102,  176,  155,  156,  177,  179,  181,
+   25,  180,  182,  141,   33,   34,   35,   36,   37,   38,
+   39,   40,   41,   42,   43,   44,   27,   30,   28,   53,
+   54,   31,   57,   58,   50,   61,   70,   88,   90,   93,
+   94,   96,  109,   33,   34,   35,   36,   37,   38,   39,
+   40,   41,  103,  123,  124,   35,   36,  125,   38,  126,
+  127,  128,  129,   40,   40,   40,   40,   40,   40,   40,
+   40,   40,   40,   44,   44,   44,   44,   44,   44,   44,
+   44,   44,   44,   66,   62,   77,   63,   77,  111,  113,
+  114,  120,  115,  117,  119,  135,  142,  143,  145,  146,
+  147,  148,  149,  150,  154,  158,  157,  161,   74,  164,
+  165,  168,  171,  173,  178,  183,  105,   63,   20,  107,
+  138,   92,  108,   97,  184,   33,   34,   35,   36,   37,
+   38,   39,   40,   41,   42,   43,   44,  185,  153,  186,
+  187,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    4,    4,    4,
+    6,    6,    6,    0,    4,    0,    4,    6,    0,    6,
+    9,    9,    9,   58,   58,   58,    0,    9,    0,    9,
+   58,    0,   58,   23,   23,   23,   34,   34,   34,    0,
+   23,    0,   23,   34,    0,   34,
+};
+static short yycheck[] = {                                      41,
+    0,  125,   18,    0,   40,   40,   44,   44,   44,   44,
+   44,  125,   44,    0,   44,   44,    0,   50,   78,  100,
+   41,  125,  111,   44,   41,   50,    0,   44,   40,    0,
+   41,  125,  123,   44,  125,   41,   40,   40,   44,  125,
+  125,   74,   40,   76,  133,  257,  258,  259,  260,  261,
+  262,  263,  264,  265,  266,  267,  268,   40,   83,  257,
+  258,  259,  260,  261,  262,  263,  264,  265,  266,  260,
+  151,  262,  132,  257,  258,  259,   41,  266,   41,   44,
+  264,   44,  266,  123,  117,  266,  119,  125,  125,  125,
+  125,  125,  117,  125,   41,  125,  125,   44,   41,   41,
+  123,   44,   44,  119,  257,  258,  259,  260,  261,  262,
+  263,  264,  265,  266,  267,  268,  266,  266,  123,   41,
+  266,  123,   41,  266,  123,   41,  264,   40,   40,  266,
+   40,  125,  267,  257,  258,  259,  260,  261,  262,  263,
+  264,  265,  266,  257,  258,  259,  260,  261,  262,  263,
+  264,  265,  266,  257,  258,  259,  260,  261,  262,  263,
+  264,  265,  266,  257,  258,  259,  260,  261,  262,  263,
+  264,  265,  266,  264,  260,  260,  262,  262,  123,  266,
+   41,   44,  266,  123,  123,   41,  266,  266,   40,   40,
+   40,   40,   40,   40,  266,  266,   41,  266,   44,  266,
+  266,  266,  266,   41,   41,   41,   83,  125,    6,   85,
+  116,   64,   87,   72,  175,  257,  258,  259,  260,  261,
+  262,  263,  264,  265,  266,  267,  268,  177,  133,  180,
+  182,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,
+  257,  258,  259,   -1,  264,   -1,  266,  264,   -1,  266,
+  257,  258,  259,  257,  258,  259,   -1,  264,   -1,  266,
+  264,   -1,  266,  257,  258,  259,  257,  258,  259,   -1,
+  264,   -1,  266,  264,   -1,  266,
+};
+#define YYFINAL 6
+#ifndef YYDEBUG
+#define YYDEBUG 0
+#endif
+#define YYMAXTOKEN 268
+#if YYDEBUG
+static char *yyname[] = {
+"end-of-file",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,"'('","')'",0,0,"','",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,"'{'",0,"'}'",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,"tokenUAG",
+"tokenHAG","tokenASG","tokenRULE","tokenCALC","tokenINP","tokenMETHOD",
+"tokenAUTHORITY","tokenPROTOCOL","tokenSTRING","tokenINT64","tokenFLOAT64",
+};
+static char *yyrule[] = {
+"$accept : asconfig",
+"asconfig : asconfig asconfig_item",
+"asconfig : asconfig_item",
+"asconfig_item : tokenUAG uag_head uag_body",
+"asconfig_item : tokenUAG uag_head",
+"asconfig_item : tokenHAG hag_head hag_body",
+"asconfig_item : tokenHAG hag_head",
+"asconfig_item : tokenAUTHORITY top_auth",
+"asconfig_item : tokenASG asg_head asg_body",
+"asconfig_item : tokenASG asg_head",
+"asconfig_item : generic_item",
+"keyword : tokenUAG",
+"keyword : tokenHAG",
+"keyword : tokenCALC",
+"keyword : tokenMETHOD",
+"keyword : tokenAUTHORITY",
+"keyword : tokenPROTOCOL",
+"keyword : non_rule_keyword",
+"non_rule_keyword : tokenASG",
+"non_rule_keyword : tokenRULE",
+"non_rule_keyword : tokenINP",
+"generic_item : tokenSTRING generic_head generic_list_block",
+"generic_item : tokenSTRING generic_head generic_block",
+"generic_item : tokenSTRING generic_head",
+"generic_head : '(' ')'",
+"generic_head : '(' generic_element ')'",
+"generic_head : '(' generic_list ')'",
+"generic_list_block : '{' generic_element '}' '{' generic_list '}'",
+"generic_list : generic_list ',' generic_element",
+"generic_list : generic_element ',' generic_element",
+"generic_element : keyword",
+"generic_element : tokenSTRING",
+"generic_element : tokenINT64",
+"generic_element : tokenFLOAT64",
+"generic_block : '{' generic_element '}'",
+"generic_block : '{' generic_list '}'",
+"generic_block : '{' generic_block_list '}'",
+"generic_block_list : generic_block_list generic_block_elem",
+"generic_block_list : generic_block_elem",
+"generic_block_elem : generic_block_elem_name generic_head generic_block",
+"generic_block_elem : generic_block_elem_name generic_head",
+"generic_block_elem_name : keyword",
+"generic_block_elem_name : tokenSTRING",
+"rule_generic_block_elem : rule_generic_block_elem_name generic_head generic_block",
+"rule_generic_block_elem : rule_generic_block_elem_name generic_head",
+"rule_generic_block_elem_name : non_rule_keyword",
+"rule_generic_block_elem_name : tokenSTRING",
+"uag_head : '(' tokenSTRING ')'",
+"uag_body : '{' uag_user_list '}'",
+"uag_user_list : uag_user_list ',' uag_user_list_name",
+"uag_user_list : uag_user_list_name",
+"uag_user_list_name : tokenSTRING",
+"hag_head : '(' tokenSTRING ')'",
+"hag_body : '{' hag_host_list '}'",
+"hag_host_list : hag_host_list ',' hag_host_list_name",
+"hag_host_list : hag_host_list_name",
+"hag_host_list_name : tokenSTRING",
+"top_auth : top_auth_head auth_body",
+"top_auth : top_auth_head",
+"top_auth_head : '(' tokenSTRING ',' tokenSTRING ')'",
+"top_auth_head : '(' tokenSTRING ')'",
+"auth_body : '{' auth_body_item_list '}'",
+"auth_body_item_list : auth_body_item auth_body_item_list",
+"auth_body_item_list : auth_body_item",
+"$$1 :",
+"auth_body_item : tokenAUTHORITY auth_head $$1 auth_body",
+"auth_body_item : tokenAUTHORITY auth_head",
+"auth_head : '(' tokenSTRING ',' tokenSTRING ')'",
+"auth_head : '(' tokenSTRING ')'",
+"asg_head : '(' tokenSTRING ')'",
+"asg_body : '{' asg_body_list '}'",
+"asg_body_list : asg_body_list asg_body_item",
+"asg_body_list : asg_body_item",
+"asg_body_item : inp_config",
+"asg_body_item : rule_config",
+"inp_config : tokenINP '(' tokenSTRING ')'",
+"rule_config : tokenRULE rule_head rule_body",
+"rule_config : tokenRULE rule_head",
+"rule_head : '(' rule_head_mandatory ',' rule_log_option ')'",
+"rule_head : '(' rule_head_mandatory ')'",
+"rule_head_mandatory : tokenINT64 ',' tokenSTRING",
+"rule_log_option : tokenSTRING",
+"rule_body : '{' rule_list '}'",
+"rule_list : rule_list rule_list_item",
+"rule_list : rule_list_item",
+"rule_list_item : tokenUAG '(' rule_uag_list ')'",
+"rule_list_item : tokenHAG '(' rule_hag_list ')'",
+"rule_list_item : tokenMETHOD '(' rule_method_list ')'",
+"rule_list_item : tokenAUTHORITY '(' rule_authority_list ')'",
+"rule_list_item : tokenPROTOCOL '(' tokenSTRING ')'",
+"rule_list_item : tokenCALC '(' tokenSTRING ')'",
+"rule_list_item : rule_generic_block_elem",
+"rule_uag_list : rule_uag_list ',' rule_uag_list_name",
+"rule_uag_list : rule_uag_list_name",
+"rule_uag_list_name : tokenSTRING",
+"rule_hag_list : rule_hag_list ',' rule_hag_list_name",
+"rule_hag_list : rule_hag_list_name",
+"rule_hag_list_name : tokenSTRING",
+"rule_method_list : rule_method_list ',' rule_method_list_name",
+"rule_method_list : rule_method_list_name",
+"rule_method_list_name : tokenSTRING",
+"rule_authority_list : rule_authority_list ',' rule_authority_list_name",
+"rule_authority_list : rule_authority_list_name",
+"rule_authority_list_name : tokenSTRING",
+};
+#endif
+#ifdef YYSTACKSIZE
+#undef YYMAXDEPTH
+#define YYMAXDEPTH YYSTACKSIZE
+#else
+#ifdef YYMAXDEPTH
+#define YYSTACKSIZE YYMAXDEPTH
+#else
+#define YYSTACKSIZE 500
+#define YYMAXDEPTH 500
+#endif
+#endif
+#if YYDEBUG
+static int yydebug;
+#endif
+static int yynerrs;
+static int yyerrflag;
+static int yychar;
+static short *yyssp;
+static YYSTYPE *yyvsp;
+static YYSTYPE yyval;
+static YYSTYPE yylval;
+static short yyss[YYSTACKSIZE];
+static YYSTYPE yyvs[YYSTACKSIZE];
+#define yystacksize YYSTACKSIZE
+#line 441 "../as/asLib.y"
+
+#include "asLib_lex.c"
+
+static int yyerror(char *str)
+{
+    if (strlen(str))
+        fprintf(stderr, ERL_ERROR " %s at line %d\n", str, line_num);
+    else
+        fprintf(stderr, ERL_ERROR " at line %d\n", line_num);
+    yyFailed = TRUE;
+    return 0;
+}
+static int yywarn(char *str, char *token)
+{
+    if (!yyWarned && strlen(str) && strlen(token))
+        fprintf(stderr, ERL_WARNING " %s at line %d: %s\n", str, line_num, token);
+    yyWarned = TRUE;
+    return 0;
+}
+
+static int myParse(ASINPUTFUNCPTR inputfunction)
+{
+    static int  FirstFlag = 1;
+    int         rtnval;
+
+    my_yyinput = &inputfunction;
+    if (!FirstFlag) {
+        line_num=1;
+        yyFailed = FALSE;
+        yyWarned = FALSE;
+        yyreset();
+        yyrestart(NULL);
+    }
+    FirstFlag = 0;
+    initCertPathStack();    // Initialise the Certificate Chain to store an ongoing stack of certificates as they are parsed
+    rtnval = yyparse();
+    freeCertPathStack();    // Free the Certificate Chain
+    if(rtnval!=0 || yyFailed) return(-1); else return(0);
+}
+
+/**
+ * Add the given Certificate Authority's Common Name to the Certificate Chain
+ * and signal errors to parser if it fails.
+ * Free up the given Common Name once consumed
+ */
+static int pushCertPath(char *commonName) {
+    if (_pushCertPath(commonName) != 0) {
+        yyerror("Out of memory");
+        free(commonName);
+        return -1;
+    }
+    free(commonName);
+    return 0;
+}
+
+/**
+ * Make an actual entry in EPICS Security in the list of declared named AUTHORITIES keyed on the given AUTHORITY ID.
+ *
+ * This will retrieve the Certificate Chain that has been parsed up till now, including
+ * all parent components that have been seen, and will associate it with the given AUTHORITY ID by
+ * calling `asAddAuthority` to add it to EPICS Security as a named AUTHORITY entry
+ * that can be referenced in an ASG RULE.
+ */
+static int saveAuthorityEntry(char *name) {
+    if (name) {
+        char *auth_chain = getCurrentCertPath();
+        if (!auth_chain) {
+            yyerror("Out of memory");
+            free(name);
+            return -1;
+        }
+
+        if (!asAddAuthority(name, auth_chain)) {
+            char message[100];
+            sprintf(message, "AUTHORITY: %s=%s", name, auth_chain);
+            free(auth_chain);
+            free(name);
+            yyerror(message);
+            return -1;
+        }
+
+        free(auth_chain);
+        free(name);
+    }
+    return 0;
+}
+
+/**
+ * Add the given Certificate Authority's Common Name to the end of the current Certificate Chain
+ */
+static int _pushCertPath(const char *commonName) {
+    CertPathNode_t *node = malloc(sizeof(CertPathNode_t));
+    if (!node) return -1;
+
+    node->commonName = strdup(commonName);
+    if (!node->commonName) {
+        free(node);
+        return -1;
+    }
+
+    ellAdd(&yyCertPath, &node->node);
+    return 0;
+}
+
+/**
+ * Remove the last Common Name that was added to the Certificate Chain
+ */
+static void popCertPath() {
+    CertPathNode_t *node = (CertPathNode_t *)ellLast(&yyCertPath);
+    if (node) {
+        ellDelete(&yyCertPath, &node->node);
+        free(node->commonName);
+        free(node);
+    }
+}
+
+/**
+ * Gets the current Certificate Chain that has been parsed so far.
+ */
+static char *getCurrentCertPath() {
+    size_t total_len = 1;  /* For null terminator */
+    CertPathNode_t *node;
+    char *result;
+
+    /* First pass: calculate required length */
+    for (node = (CertPathNode_t *)ellFirst(&yyCertPath); node;
+         node = (CertPathNode_t *)ellNext(&node->node)) {
+        total_len += strlen(node->commonName) + 1;  /* +1 for newline */
+    }
+
+    result = malloc(total_len);
+    if (!result) return NULL;
+    result[0] = '\0';
+
+    /* Second pass: build string */
+    for (node = (CertPathNode_t *)ellFirst(&yyCertPath); node;
+         node = (CertPathNode_t *)ellNext(&node->node)) {
+        if (result[0]) strcat(result, "\n");
+        strcat(result, node->commonName);
+    }
+
+    return result;
+}
+
+/**
+ * Initialise the Certificate Chain when we start parsing
+ */
+static void initCertPathStack() {
+    ellInit(&yyCertPath);
+}
+
+/**
+ * Free up the Certificate Chain once we're done parsing
+ */
+static void freeCertPathStack() {
+    while (ellFirst(&yyCertPath)) {
+        popCertPath();
+    }
+}
+
+#line 536 "asLib.tab.c"
+#define YYABORT goto yyabort
+#define YYREJECT goto yyabort
+#define YYACCEPT goto yyaccept
+#define YYERROR goto yyerrlab
+static int
+yyparse(void)
+{
+    int yym, yyn, yystate;
+#if YYDEBUG
+    char *yys;
+    extern char *getenv();
+
+    if ((yys = getenv("YYDEBUG")))
+    {
+        yyn = *yys;
+        if (yyn >= '0' && yyn <= '9')
+            yydebug = yyn - '0';
+    }
+#endif
+
+    yynerrs = 0;
+    yyerrflag = 0;
+    yychar = (-1);
+
+    yyssp = yyss;
+    yyvsp = yyvs;
+    *yyssp = yystate = 0;
+
+yyloop:
+    if ((yyn = yydefred[yystate])) goto yyreduce;
+    if (yychar < 0)
+    {
+        if ((yychar = yylex()) < 0) yychar = 0;
+#if YYDEBUG
+        if (yydebug)
+        {
+            yys = 0;
+            if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+            if (!yys) yys = "illegal-symbol";
+            printf("%sdebug: state %d, reading %d (%s)\n",
+                    YYPREFIX, yystate, yychar, yys);
+        }
+#endif
+    }
+    if ((yyn = yysindex[yystate]) && (yyn += yychar) >= 0 &&
+            yyn <= YYTABLESIZE && yycheck[yyn] == yychar)
+    {
+#if YYDEBUG
+        if (yydebug)
+            printf("%sdebug: state %d, shifting to state %d\n",
+                    YYPREFIX, yystate, yytable[yyn]);
+#endif
+        if (yyssp >= yyss + yystacksize - 1)
+        {
+            goto yyoverflow;
+        }
+        *++yyssp = yystate = yytable[yyn];
+        *++yyvsp = yylval;
+        yychar = (-1);
+        if (yyerrflag > 0)  --yyerrflag;
+        goto yyloop;
+    }
+    if ((yyn = yyrindex[yystate]) && (yyn += yychar) >= 0 &&
+            yyn <= YYTABLESIZE && yycheck[yyn] == yychar)
+    {
+        yyn = yytable[yyn];
+        goto yyreduce;
+    }
+    if (yyerrflag) goto yyinrecovery;
+    yyerror("syntax error");
+    ++yynerrs;
+yyinrecovery:
+    if (yyerrflag < 3)
+    {
+        yyerrflag = 3;
+        for (;;)
+        {
+            if ((yyn = yysindex[*yyssp]) && (yyn += YYERRCODE) >= 0 &&
+                    yyn <= YYTABLESIZE && yycheck[yyn] == YYERRCODE)
+            {
+#if YYDEBUG
+                if (yydebug)
+                    printf("%sdebug: state %d, error recovery shifting\
+ to state %d\n", YYPREFIX, *yyssp, yytable[yyn]);
+#endif
+                if (yyssp >= yyss + yystacksize - 1)
+                {
+                    goto yyoverflow;
+                }
+                *++yyssp = yystate = yytable[yyn];
+                *++yyvsp = yylval;
+                goto yyloop;
+            }
+            else
+            {
+#if YYDEBUG
+                if (yydebug)
+                    printf("%sdebug: error recovery discarding state %d\n",
+                            YYPREFIX, *yyssp);
+#endif
+                if (yyssp <= yyss) goto yyabort;
+                --yyssp;
+                --yyvsp;
+            }
+        }
+    }
+    else
+    {
+        if (yychar == 0) goto yyabort;
+#if YYDEBUG
+        if (yydebug)
+        {
+            yys = 0;
+            if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+            if (!yys) yys = "illegal-symbol";
+            printf("%sdebug: state %d, error recovery discards token %d (%s)\n",
+                    YYPREFIX, yystate, yychar, yys);
+        }
+#endif
+        yychar = (-1);
+        goto yyloop;
+    }
+yyreduce:
+#if YYDEBUG
+    if (yydebug)
+        printf("%sdebug: state %d, reducing by rule %d (%s)\n",
+                YYPREFIX, yystate, yyn, yyrule[yyn]);
+#endif
+    yym = yylen[yyn];
+    yyval = yyvsp[1-yym];
+    switch (yyn)
+    {
+case 7:
+#line 70 "../as/asLib.y"
+{ popCertPath(); }
+break;
+case 21:
+#line 91 "../as/asLib.y"
+{
+        yywarn("Ignoring unsupported TOP LEVEL Access Control Definition", yyvsp[-2].Str);
+        free((void *)yyvsp[-2].Str);
+    }
+break;
+case 22:
+#line 96 "../as/asLib.y"
+{
+        yywarn("Ignoring unsupported TOP LEVEL Access Control Definition", yyvsp[-2].Str);
+        free((void *)yyvsp[-2].Str);
+    }
+break;
+case 23:
+#line 101 "../as/asLib.y"
+{
+        yywarn("Ignoring unsupported TOP LEVEL Access Control Definition", yyvsp[-1].Str);
+        free((void *)yyvsp[-1].Str);
+    }
+break;
+case 31:
+#line 122 "../as/asLib.y"
+{
+        free((void *)yyvsp[0].Str);
+    }
+break;
+case 37:
+#line 135 "../as/asLib.y"
+{
+        free((void *)yyvsp[0].Str);
+    }
+break;
+case 38:
+#line 139 "../as/asLib.y"
+{
+        free((void *)yyvsp[0].Str);
+    }
+break;
+case 39:
+#line 145 "../as/asLib.y"
+{
+        yyval.Str = yyvsp[-2].Str;
+    }
+break;
+case 40:
+#line 149 "../as/asLib.y"
+{
+        yyval.Str = yyvsp[-1].Str;
+    }
+break;
+case 41:
+#line 155 "../as/asLib.y"
+{
+        yyval.Str = strdup(yyvsp[0].Str);
+        if (!yyval.Str) yyerror("Out of memory");
+    }
+break;
+case 42:
+#line 160 "../as/asLib.y"
+{
+        yyval.Str = yyvsp[0].Str;
+    }
+break;
+case 43:
+#line 166 "../as/asLib.y"
+{
+        yyval.Str = yyvsp[-2].Str;
+    }
+break;
+case 44:
+#line 170 "../as/asLib.y"
+{
+        yyval.Str = yyvsp[-1].Str;
+    }
+break;
+case 45:
+#line 176 "../as/asLib.y"
+{
+        yyval.Str = strdup(yyvsp[0].Str);
+        if (!yyval.Str) yyerror("Out of memory");
+    }
+break;
+case 46:
+#line 181 "../as/asLib.y"
+{
+        yyval.Str = yyvsp[0].Str;
+    }
+break;
+case 47:
+#line 187 "../as/asLib.y"
+{
+        yyUag = asUagAdd(yyvsp[-1].Str);
+        if(!yyUag) yyerror("");
+        free((void *)yyvsp[-1].Str);
+    }
+break;
+case 48:
+#line 195 "../as/asLib.y"
+{
+         ;
+    }
+break;
+case 51:
+#line 205 "../as/asLib.y"
+{
+        if (asUagAddUser(yyUag,yyvsp[0].Str))
+            yyerror("");
+        free((void *)yyvsp[0].Str);
+    }
+break;
+case 52:
+#line 213 "../as/asLib.y"
+{
+        yyHag = asHagAdd(yyvsp[-1].Str);
+        if(!yyHag) yyerror("");
+        free((void *)yyvsp[-1].Str);
+    }
+break;
+case 56:
+#line 228 "../as/asLib.y"
+{
+        if (asHagAddHost(yyHag,yyvsp[0].Str))
+            yyerror("");
+        free((void *)yyvsp[0].Str);
+    }
+break;
+case 59:
+#line 240 "../as/asLib.y"
+{
+        pushCertPath(yyvsp[-1].Str);         /* Add this new Certificate Path component to the Certificate Chain*/
+        saveAuthorityEntry(yyvsp[-3].Str);   /* Then create a new EPICS Security AUTHORITY with the given name*/
+    }
+break;
+case 60:
+#line 245 "../as/asLib.y"
+{
+        pushCertPath(yyvsp[-1].Str);         /* Add this new Certificate Path component to the Certificate Chain*/
+    }
+break;
+case 64:
+#line 258 "../as/asLib.y"
+{
+        saveAuthorityEntry(yyvsp[0].Str);   /* Create a new EPICS Security AUTHORITY with the given name*/
+    }
+break;
+case 65:
+#line 261 "../as/asLib.y"
+{
+        popCertPath();
+    }
+break;
+case 66:
+#line 265 "../as/asLib.y"
+{
+        saveAuthorityEntry(yyvsp[0].Str);   /* Then create a new EPICS Security AUTHORITY with the given name*/
+        popCertPath();
+    }
+break;
+case 67:
+#line 272 "../as/asLib.y"
+{
+        pushCertPath(yyvsp[-1].Str);
+        yyval.Str = yyvsp[-3].Str;
+    }
+break;
+case 68:
+#line 277 "../as/asLib.y"
+{
+        pushCertPath(yyvsp[-1].Str);
+        yyval.Str = NULL;
+    }
+break;
+case 69:
+#line 284 "../as/asLib.y"
+{
+        yyAsg = asAsgAdd(yyvsp[-1].Str);
+        if(!yyAsg) yyerror("");
+        free((void *)yyvsp[-1].Str);
+    }
+break;
+case 70:
+#line 292 "../as/asLib.y"
+{
+    }
+break;
+case 75:
+#line 302 "../as/asLib.y"
+{
+        if (asAsgAddInp(yyAsg,yyvsp[-1].Str,(int)yyvsp[-3].Int64))
+            yyerror("");
+        free((void *)yyvsp[-1].Str);
+    }
+break;
+case 80:
+#line 318 "../as/asLib.y"
+{
+        if (yyvsp[-2].Int64 < 0) {
+            char message[40];
+            sprintf(message, "RULE: LEVEL must be positive: %lld", yyvsp[-2].Int64);
+            yyerror(message);
+        } else if((strcmp(yyvsp[0].Str,"NONE")==0)) {
+            yyAsgRule = asAsgAddRule(yyAsg,asNOACCESS,(int)yyvsp[-2].Int64);
+        } else if((strcmp(yyvsp[0].Str,"READ")==0)) {
+            yyAsgRule = asAsgAddRule(yyAsg,asREAD,(int)yyvsp[-2].Int64);
+        } else if((strcmp(yyvsp[0].Str,"WRITE")==0)) {
+            yyAsgRule = asAsgAddRule(yyAsg,asWRITE,(int)yyvsp[-2].Int64);
+        } else if((strcmp(yyvsp[0].Str,"RPC")==0)) {
+            yyAsgRule = asAsgAddRule(yyAsg,asRPC,(int)yyvsp[-2].Int64);
+        } else {
+            yywarn("Ignoring RULE with unsupported PERMISSION", yyvsp[0].Str);
+        }
+        free((void *)yyvsp[0].Str);
+    }
+break;
+case 81:
+#line 339 "../as/asLib.y"
+{
+        if((strcmp(yyvsp[0].Str,"TRAPWRITE")==0)) {
+            long status;
+            status = asAsgAddRuleOptions(yyAsgRule,AS_TRAP_WRITE);
+            if(status) yyerror("");
+        } else if((strcmp(yyvsp[0].Str,"NOTRAPWRITE")!=0)) {
+            yyerror("Log options must be TRAPWRITE or NOTRAPWRITE");
+        }
+        free((void *)yyvsp[0].Str);
+    }
+break;
+case 89:
+#line 363 "../as/asLib.y"
+{
+        if((strcasecmp(yyvsp[-1].Str,"TLS")==0)) {
+            if (asAsgAddProtocolAdd(yyAsgRule,AS_PROTOCOL_TLS))
+                yyerror("");
+        } else if((strcasecmp(yyvsp[-1].Str,"TCP")==0)) {
+            if (asAsgAddProtocolAdd(yyAsgRule,AS_PROTOCOL_TCP))
+                yyerror("");
+        } else {
+            yywarn("Ignoring RULE containing unsupported PROTOCOL", yyvsp[-1].Str);
+            if (asAsgRuleDisable(yyAsgRule))
+                yyerror("");
+        }
+        free((void *)yyvsp[-1].Str);
+    }
+break;
+case 90:
+#line 378 "../as/asLib.y"
+{
+        if (asAsgRuleCalc(yyAsgRule,yyvsp[-1].Str))
+            yyerror("");
+        free((void *)yyvsp[-1].Str);
+    }
+break;
+case 91:
+#line 384 "../as/asLib.y"
+{
+        yywarn("Ignoring RULE containing unsupported PREDICATE", yyvsp[0].Str);
+        free((void *)yyvsp[0].Str);
+        if (asAsgRuleDisable(yyAsgRule))
+            yyerror("");
+    }
+break;
+case 94:
+#line 397 "../as/asLib.y"
+{
+        if (asAsgRuleUagAdd(yyAsgRule,yyvsp[0].Str))
+            yyerror("");
+        free((void *)yyvsp[0].Str);
+    }
+break;
+case 97:
+#line 409 "../as/asLib.y"
+{
+        if (asAsgRuleHagAdd(yyAsgRule,yyvsp[0].Str))
+            yyerror("");
+        free((void *)yyvsp[0].Str);
+    }
+break;
+case 100:
+#line 421 "../as/asLib.y"
+{
+        if (asAsgRuleMethodAdd(yyAsgRule, yyvsp[0].Str))
+            yyerror("");
+        free((void *)yyvsp[0].Str);
+    }
+break;
+case 103:
+#line 433 "../as/asLib.y"
+{
+        if (asAsgRuleAuthorityAdd(yyAsgRule, yyvsp[0].Str))
+            yyerror("");
+        free((void *)yyvsp[0].Str);
+    }
+break;
+#line 967 "asLib.tab.c"
+    }
+    yyssp -= yym;
+    yystate = *yyssp;
+    yyvsp -= yym;
+    yym = yylhs[yyn];
+    if (yystate == 0 && yym == 0)
+    {
+#if YYDEBUG
+        if (yydebug)
+            printf("%sdebug: after reduction, shifting from state 0 to\
+ state %d\n", YYPREFIX, YYFINAL);
+#endif
+        yystate = YYFINAL;
+        *++yyssp = YYFINAL;
+        *++yyvsp = yyval;
+        if (yychar < 0)
+        {
+            if ((yychar = yylex()) < 0) yychar = 0;
+#if YYDEBUG
+            if (yydebug)
+            {
+                yys = 0;
+                if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+                if (!yys) yys = "illegal-symbol";
+                printf("%sdebug: state %d, reading %d (%s)\n",
+                        YYPREFIX, YYFINAL, yychar, yys);
+            }
+#endif
+        }
+        if (yychar == 0) goto yyaccept;
+        goto yyloop;
+    }
+    if ((yyn = yygindex[yym]) && (yyn += yystate) >= 0 &&
+            yyn <= YYTABLESIZE && yycheck[yyn] == yystate)
+        yystate = yytable[yyn];
+    else
+        yystate = yydgoto[yym];
+#if YYDEBUG
+    if (yydebug)
+        printf("%sdebug: after reduction, shifting from state %d \
+to state %d\n", YYPREFIX, *yyssp, yystate);
+#endif
+    if (yyssp >= yyss + yystacksize - 1)
+    {
+        goto yyoverflow;
+    }
+    *++yyssp = yystate;
+    *++yyvsp = yyval;
+    goto yyloop;
+yyoverflow:
+    yyerror("yacc stack overflow");
+yyabort:
+    return (1);
+yyaccept:
+    return (0);
+}
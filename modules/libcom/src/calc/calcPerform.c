@@ -403,10 +403,889 @@ LIBCOM_API long
     return 0;
 }
 
+/* Compiled programs
+ *
+ * calcCompile() turns a postfix expression into instructions for a small
+ * register machine whose registers are the slots of a frame of doubles:
+ * the arguments A-L, VAL, one temporary for each level of the postfix
+ * stack, and the constants.  Operands are tracked on a virtual stack while
+ * compiling, so fetches and literals become direct references to slots
+ * and only the operators generate instructions.  Operators whose inputs
+ * are all constant are evaluated by the compiler.
+ */
+
+/* Opcodes used only by programs, the others keep their RPN meanings */
+enum {
+    PROG_END = NOT_GENERATED + 1,
+    PROG_MOVE,          /* R = X */
+    PROG_JUMP,          /* continue at dst */
+    PROG_JUMP_IF_ZERO,  /* continue at dst if X is zero */
+    PROG_FINITE2,       /* R = Y && finite(X) */
+    PROG_ISNAN2         /* R = Y || isnan(X) */
+};
+
+#define PROG_VAL        CALCPERFORM_NARGS
+#define PROG_TEMP(d)    (PROG_VAL + (d))
+#define PROG_CONST      PROG_TEMP(CALCPERFORM_STACK + 1)
+#define PROG_MAX_CONSTS 64
+#define PROG_SLOTS      (PROG_CONST + PROG_MAX_CONSTS)
+#define PROG_NONE       0xffff
+
+typedef struct calcInst {
+    epicsUInt16 op;
+    epicsUInt16 dst;    /* Slot written, or jump target */
+    epicsUInt16 a, b;   /* Slots read */
+} calcInst;
+
+struct calcProgram {
+    unsigned long inputs;   /* Arguments read */
+    unsigned long stores;   /* Arguments to copy back */
+    unsigned result;        /* Slot holding the result */
+    unsigned nslots;        /* Size of the frame */
+    unsigned nconsts;       /* Constants, in the last slots of the frame */
+    double *consts;
+    unsigned ninst;
+    int jumps;              /* Has conditional code */
+    calcInst inst[1];
+};
+
+/* The operators of programs as expressions of their operands x and y,
+ * shared by the scalar and the array executors.
+ */
+#define PROG_UNARY_OPS(OP) \
+    OP(PROG_MOVE,       x) \
+    OP(UNARY_NEG,       - x) \
+    OP(ABS_VAL,         fabs(x)) \
+    OP(EXP,             exp(x)) \
+    OP(LOG_10,          log10(x)) \
+    OP(LOG_E,           log(x)) \
+    OP(SQU_RT,          sqrt(x)) \
+    OP(ACOS,            acos(x)) \
+    OP(ASIN,            asin(x)) \
+    OP(ATAN,            atan(x)) \
+    OP(COS,             cos(x)) \
+    OP(SIN,             sin(x)) \
+    OP(TAN,             tan(x)) \
+    OP(COSH,            cosh(x)) \
+    OP(SINH,            sinh(x)) \
+    OP(TANH,            tanh(x)) \
+    OP(CEIL,            ceil(x)) \
+    OP(FLOOR,           floor(x)) \
+    OP(FINITE,          finite(x)) \
+    OP(ISINF,           isinf(x)) \
+    OP(ISNAN,           isnan(x)) \
+    OP(NINT,            (epicsInt32) (x >= 0 ? x + 0.5 : x - 0.5)) \
+    OP(REL_NOT,         ! x) \
+    OP(BIT_NOT,         (double)~d2i(x))
+
+#define PROG_BINARY_OPS(OP) \
+    OP(ADD,             x + y) \
+    OP(SUB,             x - y) \
+    OP(MULT,            x * y) \
+    OP(DIV,             x / y) \
+    OP(MODULO,          (epicsInt32) y ?  \
+        (double) ((epicsInt32) x % (epicsInt32) y) : epicsNAN) \
+    OP(POWER,           pow(x, y)) \
+    OP(MAX,             (x < y || isnan(y)) ? y : x) \
+    OP(MIN,             (x > y || isnan(y)) ? y : x) \
+    OP(ATAN2,           atan2(y, x)) \
+    OP(FMOD,            fmod(x, y)) \
+    OP(PROG_FINITE2,    y && finite(x)) \
+    OP(PROG_ISNAN2,     y || isnan(x)) \
+    OP(REL_OR,          x || y) \
+    OP(REL_AND,         x && y) \
+    OP(BIT_OR,          (double)(d2i(x) | d2i(y))) \
+    OP(BIT_AND,         (double)(d2i(x) & d2i(y))) \
+    OP(BIT_EXCL_OR,     (double)(d2i(x) ^ d2i(y))) \
+    OP(RIGHT_SHIFT_ARITH, (double)(d2i(x) >> (d2i(y) & 31))) \
+    OP(LEFT_SHIFT_ARITH, (double)(d2i(x) << (d2i(y) & 31))) \
+    OP(RIGHT_SHIFT_LOGIC, (double)(d2ui(x) >> (d2ui(y) & 31u))) \
+    OP(NOT_EQ,          x != y) \
+    OP(LESS_THAN,       x < y) \
+    OP(LESS_OR_EQ,      x <= y) \
+    OP(EQUAL,           x == y) \
+    OP(GR_OR_EQ,        x >= y) \
+    OP(GR_THAN,         x > y)
+
+static void calcExecute(const calcInst *prog, double *frame)
+{
+    const calcInst *pinst = prog;
+
+    #define UNARY(code, expr) \
+        case code: { double x = frame[pinst->a]; \
+            frame[pinst->dst] = (expr); } break;
+    #define BINARY(code, expr) \
+        case code: { double x = frame[pinst->a], y = frame[pinst->b]; \
+            frame[pinst->dst] = (expr); } break;
+
+    for (;; pinst++) {
+        switch (pinst->op) {
+        case PROG_END:
+            return;
+        case PROG_JUMP:
+            pinst = prog + pinst->dst - 1;
+            break;
+        case PROG_JUMP_IF_ZERO:
+            if (frame[pinst->a] == 0.0)
+                pinst = prog + pinst->dst - 1;
+            break;
+        case RANDOM:
+            frame[pinst->dst] = calcRandom();
+            break;
+        PROG_UNARY_OPS(UNARY)
+        PROG_BINARY_OPS(BINARY)
+        }
+    }
+
+    #undef UNARY
+    #undef BINARY
+}
+
+LIBCOM_API long
+    calcProgramPerform(const calcProgram *pprog, double *parg, double *presult)
+{
+    double frame[PROG_SLOTS];
+    unsigned long stores = pprog->stores;
+    unsigned i;
+
+    memcpy(frame, parg, CALCPERFORM_NARGS * sizeof(double));
+    frame[PROG_VAL] = *presult;
+    for (i = 0; i < pprog->nconsts; i++)
+        frame[pprog->nslots - pprog->nconsts + i] = pprog->consts[i];
+
+    calcExecute(pprog->inst, frame);
+
+    for (i = 0; stores; i++, stores >>= 1) {
+        if (stores & 1)
+            parg[i] = frame[i];
+    }
+    *presult = frame[pprog->result];
+    return 0;
+}
+
+/* Array evaluation
+ *
+ * Programs are run over blocks of PROG_LANES elements at a time, with
+ * each frame slot holding a row of values, one per lane. Every
+ * instruction is a loop over the lanes, which the compiler can vectorize.
+ * Conditional code tracks which lanes are active: as jumps only go
+ * forwards, lanes that take one wait at its target until execution gets
+ * there, and instructions only update the rows of the active lanes.
+ */
+#define PROG_LANES 64
+
+typedef epicsUInt64 laneMask;
+
+static void laneExecute(const calcInst *pinst, double *r, const double *px,
+    const double *py, int n)
+{
+    int k;
+
+    #define UNARY(code, expr) \
+        case code: for (k = 0; k < n; k++) { double x = px[k]; \
+            r[k] = (expr); } break;
+    #define BINARY(code, expr) \
+        case code: for (k = 0; k < n; k++) { double x = px[k], y = py[k]; \
+            r[k] = (expr); } break;
+
+    switch (pinst->op) {
+    PROG_UNARY_OPS(UNARY)
+    PROG_BINARY_OPS(BINARY)
+    }
+
+    #undef UNARY
+    #undef BINARY
+}
+
+static void calcExecuteLanes(const calcProgram *pprog, double *rows,
+    laneMask *pwaiting, int n)
+{
+    laneMask all = n == PROG_LANES ? ~(laneMask) 0 :
+        ((laneMask) 1 << n) - 1;
+    laneMask active = all;
+    double *scratch = rows + pprog->nslots * PROG_LANES;
+    unsigned i;
+    int k;
+
+    #define ROW(slot) (rows + (slot) * PROG_LANES)
+
+    if (pprog->jumps)
+        memset(pwaiting, 0, pprog->ninst * sizeof(laneMask));
+    for (i = 0; i < pprog->ninst; i++) {
+        const calcInst *pinst = &pprog->inst[i];
+        double *r;
+
+        if (pprog->jumps)
+            active |= pwaiting[i];
+        if (!active)
+            continue;
+
+        switch (pinst->op) {
+        case PROG_END:
+            return;
+
+        case PROG_JUMP:
+            pwaiting[pinst->dst] |= active;
+            active = 0;
+            break;
+
+        case PROG_JUMP_IF_ZERO: {
+            const double *px = ROW(pinst->a);
+            laneMask zero = 0;
+
+            for (k = 0; k < n; k++) {
+                if (px[k] == 0.0)
+                    zero |= (laneMask) 1 << k;
+            }
+            zero &= active;
+            pwaiting[pinst->dst] |= zero;
+            active &= ~zero;
+            break;
+        }
+
+        case RANDOM:
+            r = ROW(pinst->dst);
+            for (k = 0; k < n; k++) {
+                if (active & ((laneMask) 1 << k))
+                    r[k] = calcRandom();
+            }
+            break;
+
+        default:
+            r = ROW(pinst->dst);
+            if (active == all) {
+                laneExecute(pinst, r, ROW(pinst->a),
+                    pinst->b == PROG_NONE ? NULL : ROW(pinst->b), n);
+                break;
+            }
+            laneExecute(pinst, scratch, ROW(pinst->a),
+                pinst->b == PROG_NONE ? NULL : ROW(pinst->b), n);
+            for (k = 0; k < n; k++) {
+                if (active & ((laneMask) 1 << k))
+                    r[k] = scratch[k];
+            }
+        }
+    }
+
+    #undef ROW
+}
+
+LIBCOM_API long
+    calcProgramPerformArray(const calcProgram *pprog, const double **parg,
+        unsigned long arrays, double *presult, unsigned long nelem)
+{
+    unsigned long used = pprog->inputs | pprog->stores;
+    unsigned long base;
+    unsigned constBase = pprog->nslots - pprog->nconsts;
+    laneMask *pwaiting;
+    double *rows;
+    unsigned i;
+    int k;
+
+    /* The rows of the frame, one more for results to be merged, and the
+     * lanes waiting at each instruction
+     */
+    rows = malloc((pprog->nslots + 1) * PROG_LANES * sizeof(double) +
+        pprog->ninst * sizeof(laneMask));
+    if (!rows)
+        return -1;
+    pwaiting = (laneMask *) (rows + (pprog->nslots + 1) * PROG_LANES);
+
+    for (i = 0; i < pprog->nconsts; i++) {
+        for (k = 0; k < PROG_LANES; k++)
+            rows[(constBase + i) * PROG_LANES + k] = pprog->consts[i];
+    }
+
+    for (base = 0; base < nelem; base += PROG_LANES) {
+        int n = nelem - base < PROG_LANES ? nelem - base : PROG_LANES;
+
+        for (i = 0; i < CALCPERFORM_NARGS; i++) {
+            double *r = rows + i * PROG_LANES;
+
+            if (!(used & (1ul << i)))
+                continue;
+            if (!parg[i])
+                memset(r, 0, n * sizeof(double));
+            else if (arrays & (1ul << i))
+                memcpy(r, parg[i] + base, n * sizeof(double));
+            else for (k = 0; k < n; k++)
+                r[k] = *parg[i];
+        }
+        memcpy(rows + PROG_VAL * PROG_LANES, presult + base,
+            n * sizeof(double));
+
+        calcExecuteLanes(pprog, rows, pwaiting, n);
+
+        memcpy(presult + base, rows + pprog->result * PROG_LANES,
+            n * sizeof(double));
+    }
+    free(rows);
+    return 0;
+}
+
 #if defined(_WIN32) && defined(_M_X64) && !defined(_MINGW)
 #  pragma optimize("", on)
 #endif
 
+/* Operand on the virtual stack */
+typedef struct calcOperand {
+    int isConst;
+    unsigned slot;      /* Unless isConst */
+    double value;       /* If isConst */
+} calcOperand;
+
+typedef struct calcCompiler {
+    calcInst *inst;
+    unsigned ninst;
+    unsigned label;     /* Index of the last jump target */
+    double consts[PROG_MAX_CONSTS];
+    unsigned nconsts;
+    calcOperand stack[CALCPERFORM_STACK + 1];
+    int depth;
+    int maxDepth;
+    int reachable;      /* Not following an unconditional jump */
+    short *labelDepth;  /* Stack depth at each jump target, or -1 */
+    unsigned *jumpFrom; /* Jumps still to be patched */
+    unsigned *jumpTo;   /* with their target offsets in the postfix */
+    unsigned njumps;
+} calcCompiler;
+
+/* Walk a postfix expression, returning its length or -1 if it's bad */
+static long postfixLength(const char *ppostfix)
+{
+    const char *pinst = ppostfix;
+    int op;
+
+    while ((op = *pinst++) != END_EXPRESSION) {
+        switch (op) {
+        case LITERAL_DOUBLE:
+            pinst += sizeof(double);
+            break;
+        case LITERAL_INT:
+            pinst += sizeof(epicsInt32);
+            break;
+        case MIN:
+        case MAX:
+        case FINITE:
+        case ISNAN:
+            pinst++;
+            break;
+        default:
+            if (op < 0 || op >= NOT_GENERATED)
+                return -1;
+        }
+    }
+    return pinst - ppostfix;
+}
+
+static void emit(calcCompiler *pc, int op, unsigned dst, unsigned a,
+    unsigned b)
+{
+    calcInst *pinst = &pc->inst[pc->ninst++];
+
+    pinst->op = op;
+    pinst->dst = dst;
+    pinst->a = a;
+    pinst->b = b;
+}
+
+/* The slot of an operand, adding constants to the table. Returns -1 when
+ * the table is full.
+ */
+static int slotOf(calcCompiler *pc, const calcOperand *po)
+{
+    unsigned i;
+
+    if (!po->isConst)
+        return po->slot;
+    for (i = 0; i < pc->nconsts; i++) {
+        if (memcmp(&pc->consts[i], &po->value, sizeof(double)) == 0)
+            return PROG_CONST + i;
+    }
+    if (pc->nconsts == PROG_MAX_CONSTS)
+        return -1;
+    pc->consts[pc->nconsts] = po->value;
+    return PROG_CONST + pc->nconsts++;
+}
+
+static int pushConst(calcCompiler *pc, double value)
+{
+    calcOperand *po;
+
+    if (pc->depth == CALCPERFORM_STACK)
+        return -1;
+    po = &pc->stack[++pc->depth];
+    if (pc->depth > pc->maxDepth)
+        pc->maxDepth = pc->depth;
+    po->isConst = 1;
+    po->value = value;
+    return 0;
+}
+
+static int pushSlot(calcCompiler *pc, unsigned slot)
+{
+    calcOperand *po;
+
+    if (pc->depth == CALCPERFORM_STACK)
+        return -1;
+    po = &pc->stack[++pc->depth];
+    if (pc->depth > pc->maxDepth)
+        pc->maxDepth = pc->depth;
+    po->isConst = 0;
+    po->slot = slot;
+    return 0;
+}
+
+/* Evaluate an operator on constants the same way a program would */
+static double fold(int op, double x, double y)
+{
+    calcInst prog[2];
+    double frame[3];
+
+    prog[0].op = op;
+    prog[0].dst = 0;
+    prog[0].a = 1;
+    prog[0].b = 2;
+    prog[1].op = PROG_END;
+    frame[1] = x;
+    frame[2] = y;
+    calcExecute(prog, frame);
+    return frame[0];
+}
+
+/* Replace the top nargs operands with the result of op on them */
+static int compileOp(calcCompiler *pc, int op, int nargs)
+{
+    int d = pc->depth - nargs + 1;
+    calcOperand *px = &pc->stack[d];
+    calcOperand *py = &pc->stack[pc->depth];
+    int a, b = PROG_NONE;
+
+    if (d < 1)
+        return -1;
+    if (px->isConst && py->isConst) {
+        px->value = fold(op, px->value, py->value);
+        pc->depth = d;
+        return 0;
+    }
+    a = slotOf(pc, px);
+    if (nargs == 2)
+        b = slotOf(pc, py);
+    if (a < 0 || b < 0)
+        return -1;
+    emit(pc, op, PROG_TEMP(d), a, b);
+    px->isConst = 0;
+    px->slot = PROG_TEMP(d);
+    pc->depth = d;
+    return 0;
+}
+
+/* Make sure an operand is in the temporary for its level */
+static int materialize(calcCompiler *pc, int i)
+{
+    calcOperand *po = &pc->stack[i];
+    int slot = slotOf(pc, po);
+
+    if (slot < 0)
+        return -1;
+    if (slot != PROG_TEMP(i))
+        emit(pc, PROG_MOVE, PROG_TEMP(i), slot, PROG_NONE);
+    po->isConst = 0;
+    po->slot = PROG_TEMP(i);
+    return 0;
+}
+
+/* Where control meets, every operand must be in its temporary */
+static int materializeAll(calcCompiler *pc)
+{
+    int i;
+
+    for (i = 1; i <= pc->depth; i++) {
+        if (materialize(pc, i))
+            return -1;
+    }
+    return 0;
+}
+
+static int compileStore(calcCompiler *pc, unsigned arg)
+{
+    calcOperand *po = &pc->stack[pc->depth];
+    calcInst *plast;
+    int i, slot;
+
+    if (pc->depth < 1)
+        return -1;
+    /* Operands below still referring to the argument keep its old value */
+    for (i = 1; i < pc->depth; i++) {
+        if (!pc->stack[i].isConst && pc->stack[i].slot == arg) {
+            emit(pc, PROG_MOVE, PROG_TEMP(i), arg, PROG_NONE);
+            pc->stack[i].slot = PROG_TEMP(i);
+        }
+    }
+    slot = slotOf(pc, po);
+    if (slot < 0)
+        return -1;
+    /* Have the instruction that computed the value store it directly */
+    plast = pc->ninst ? &pc->inst[pc->ninst - 1] : NULL;
+    if (slot == PROG_TEMP(pc->depth) && plast && pc->ninst > pc->label &&
+            plast->op != PROG_JUMP && plast->op != PROG_JUMP_IF_ZERO &&
+            plast->dst == slot)
+        plast->dst = arg;
+    else
+        emit(pc, PROG_MOVE, arg, slot, PROG_NONE);
+    pc->depth--;
+    return 0;
+}
+
+/* Find where calcPerform would continue after a conditional jump, as
+ * cond_search() does, returning the offset in the postfix or -1.
+ */
+static long condTarget(const char *ppostfix, long pos, int match)
+{
+    const char *pinst = ppostfix + pos;
+
+    if (cond_search(&pinst, match))
+        return -1;
+    return pinst - ppostfix;
+}
+
+static int addJump(calcCompiler *pc, int op, unsigned a, long target)
+{
+    if (target < 0)
+        return -1;
+    if (pc->labelDepth[target] < 0)
+        pc->labelDepth[target] = pc->depth;
+    else if (pc->labelDepth[target] != pc->depth)
+        return -1;
+    pc->jumpFrom[pc->njumps] = pc->ninst;
+    pc->jumpTo[pc->njumps++] = target;
+    emit(pc, op, 0, a, PROG_NONE);
+    return 0;
+}
+
+/* Patch the jumps to a postfix offset, and merge with the code before */
+static int compileLabel(calcCompiler *pc, long pos)
+{
+    unsigned i;
+    int d;
+
+    if (pc->labelDepth[pos] < 0)
+        return 0;
+    if (pc->reachable) {
+        if (pc->depth != pc->labelDepth[pos] || materializeAll(pc))
+            return -1;
+    } else {
+        pc->depth = pc->labelDepth[pos];
+        for (d = 1; d <= pc->depth; d++) {
+            pc->stack[d].isConst = 0;
+            pc->stack[d].slot = PROG_TEMP(d);
+        }
+        pc->reachable = 1;
+    }
+    for (i = 0; i < pc->njumps; i++) {
+        if (pc->jumpTo[i] == pos)
+            pc->inst[pc->jumpFrom[i]].dst = pc->ninst;
+    }
+    pc->label = pc->ninst;
+    return 0;
+}
+
+static int compileCond(calcCompiler *pc, const char *ppostfix, long pos,
+    int op)
+{
+    int slot;
+
+    switch (op) {
+    case COND_IF:
+        if (pc->depth < 1)
+            return -1;
+        slot = slotOf(pc, &pc->stack[pc->depth--]);
+        if (slot < 0 || materializeAll(pc))
+            return -1;
+        return addJump(pc, PROG_JUMP_IF_ZERO, slot,
+            condTarget(ppostfix, pos, COND_ELSE));
+
+    case COND_ELSE:
+        if (materializeAll(pc) || addJump(pc, PROG_JUMP, PROG_NONE,
+                condTarget(ppostfix, pos, COND_END)))
+            return -1;
+        pc->reachable = 0;
+        return 0;
+
+    case COND_END:
+        return 0;
+    }
+    return -1;
+}
+
+/* Drop stores to arguments that are overwritten before being read, only
+ * looking at code without jumps or jump targets.
+ */
+static void removeDeadStores(calcCompiler *pc, unsigned result)
+{
+    unsigned i, j, n = 0;
+    unsigned *newIndex = malloc((pc->ninst + 1) * sizeof(unsigned));
+
+    if (!newIndex)
+        return;
+    for (i = 0; i < pc->ninst; i++) {
+        const calcInst *pinst = &pc->inst[i];
+        int dead = 0;
+
+        if (pinst->dst < CALCPERFORM_NARGS && pinst->dst != result &&
+                pinst->op != PROG_JUMP && pinst->op != PROG_JUMP_IF_ZERO &&
+                pinst->op != RANDOM) {
+            for (j = i + 1; j < pc->ninst; j++) {
+                const calcInst *pnext = &pc->inst[j];
+
+                if (pnext->op == PROG_JUMP ||
+                        pnext->op == PROG_JUMP_IF_ZERO ||
+                        pnext->a == pinst->dst || pnext->b == pinst->dst)
+                    break;
+                if (pnext->dst == pinst->dst) {
+                    dead = 1;
+                    break;
+                }
+            }
+        }
+        newIndex[i] = n;
+        if (!dead)
+            pc->inst[n++] = *pinst;
+    }
+    newIndex[pc->ninst] = n;
+    for (i = 0; i < n; i++) {
+        calcInst *pinst = &pc->inst[i];
+
+        if (pinst->op == PROG_JUMP || pinst->op == PROG_JUMP_IF_ZERO)
+            pinst->dst = newIndex[pinst->dst];
+    }
+    pc->ninst = n;
+    free(newIndex);
+}
+
+LIBCOM_API calcProgram *
+    calcCompile(const char *ppostfix)
+{
+    long length = postfixLength(ppostfix);
+    const char *pinst = ppostfix;
+    calcCompiler *pc;
+    calcProgram *pprog = NULL;
+    unsigned long inputs, stores;
+    epicsInt32 itop;
+    double value;
+    int op, nargs, result, jumps = 0;
+    unsigned i, constBase;
+
+    if (length < 0 || calcArgUsage(ppostfix, &inputs, &stores))
+        return NULL;
+    pc = calloc(1, sizeof(calcCompiler));
+    if (!pc)
+        return NULL;
+    /* Each postfix byte gives at most an instruction, a move to put its
+     * result in a temporary, and a move or jump.
+     */
+    pc->inst = malloc((3 * length + 1) * sizeof(calcInst));
+    pc->labelDepth = malloc((length + 1) * sizeof(short));
+    pc->jumpFrom = malloc(length * sizeof(unsigned));
+    pc->jumpTo = malloc(length * sizeof(unsigned));
+    if (!pc->inst || !pc->labelDepth || !pc->jumpFrom || !pc->jumpTo ||
+            3 * length + 1 >= PROG_NONE)
+        goto done;
+    memset(pc->labelDepth, -1, (length + 1) * sizeof(short));
+    pc->reachable = 1;
+
+    for (;;) {
+        if (compileLabel(pc, pinst - ppostfix))
+            goto done;
+        op = *pinst++;
+        if (op == END_EXPRESSION)
+            break;
+        if (!pc->reachable)
+            goto done;
+
+        switch (op) {
+        case LITERAL_DOUBLE:
+            memcpy(&value, pinst, sizeof(double));
+            pinst += sizeof(double);
+            if (pushConst(pc, value))
+                goto done;
+            break;
+
+        case LITERAL_INT:
+            memcpy(&itop, pinst, sizeof(epicsInt32));
+            pinst += sizeof(epicsInt32);
+            if (pushConst(pc, itop))
+                goto done;
+            break;
+
+        case CONST_PI:
+            if (pushConst(pc, PI))
+                goto done;
+            break;
+
+        case CONST_D2R:
+            if (pushConst(pc, PI/180.))
+                goto done;
+            break;
+
+        case CONST_R2D:
+            if (pushConst(pc, 180./PI))
+                goto done;
+            break;
+
+        case FETCH_VAL:
+            if (pushSlot(pc, PROG_VAL))
+                goto done;
+            break;
+
+        case FETCH_A:
+        case FETCH_B:
+        case FETCH_C:
+        case FETCH_D:
+        case FETCH_E:
+        case FETCH_F:
+        case FETCH_G:
+        case FETCH_H:
+        case FETCH_I:
+        case FETCH_J:
+        case FETCH_K:
+        case FETCH_L:
+            if (pushSlot(pc, op - FETCH_A))
+                goto done;
+            break;
+
+        case STORE_A:
+        case STORE_B:
+        case STORE_C:
+        case STORE_D:
+        case STORE_E:
+        case STORE_F:
+        case STORE_G:
+        case STORE_H:
+        case STORE_I:
+        case STORE_J:
+        case STORE_K:
+        case STORE_L:
+            if (compileStore(pc, op - STORE_A))
+                goto done;
+            break;
+
+        case RANDOM:
+            if (pushSlot(pc, PROG_TEMP(pc->depth + 1)))
+                goto done;
+            emit(pc, RANDOM, PROG_TEMP(pc->depth), PROG_NONE, PROG_NONE);
+            break;
+
+        case MAX:
+        case MIN:
+        case FINITE:
+        case ISNAN:
+            nargs = *pinst++;
+            if (nargs < 1 || nargs > pc->depth)
+                goto done;
+            if (op == FINITE || op == ISNAN) {
+                if (compileOp(pc, op, 1))
+                    goto done;
+                op = op == FINITE ? PROG_FINITE2 : PROG_ISNAN2;
+            }
+            while (--nargs) {
+                if (compileOp(pc, op, 2))
+                    goto done;
+            }
+            break;
+
+        case ADD:
+        case SUB:
+        case MULT:
+        case DIV:
+        case MODULO:
+        case POWER:
+        case ATAN2:
+        case FMOD:
+        case REL_OR:
+        case REL_AND:
+        case BIT_OR:
+        case BIT_AND:
+        case BIT_EXCL_OR:
+        case RIGHT_SHIFT_ARITH:
+        case LEFT_SHIFT_ARITH:
+        case RIGHT_SHIFT_LOGIC:
+        case NOT_EQ:
+        case LESS_THAN:
+        case LESS_OR_EQ:
+        case EQUAL:
+        case GR_OR_EQ:
+        case GR_THAN:
+            if (compileOp(pc, op, 2))
+                goto done;
+            break;
+
+        case COND_IF:
+        case COND_ELSE:
+        case COND_END:
+            if (compileCond(pc, ppostfix, pinst - ppostfix, op))
+                goto done;
+            break;
+
+        default:
+            if (compileOp(pc, op, 1))
+                goto done;
+        }
+    }
+
+    if (pc->depth != 1)
+        goto done;
+    result = slotOf(pc, &pc->stack[1]);
+    if (result < 0)
+        goto done;
+    removeDeadStores(pc, result);
+    emit(pc, PROG_END, PROG_NONE, PROG_NONE, PROG_NONE);
+
+    /* Move the constants down to follow the temporaries used */
+    constBase = PROG_TEMP(pc->maxDepth + 1);
+    if (result >= PROG_CONST)
+        result -= PROG_CONST - constBase;
+    for (i = 0; i < pc->ninst; i++) {
+        calcInst *pcode = &pc->inst[i];
+
+        if (pcode->a != PROG_NONE && pcode->a >= PROG_CONST)
+            pcode->a -= PROG_CONST - constBase;
+        if (pcode->b != PROG_NONE && pcode->b >= PROG_CONST)
+            pcode->b -= PROG_CONST - constBase;
+        if (pcode->op == PROG_JUMP || pcode->op == PROG_JUMP_IF_ZERO)
+            jumps = 1;
+    }
+
+    pprog = malloc(sizeof(calcProgram) + (pc->ninst - 1) * sizeof(calcInst) +
+        pc->nconsts * sizeof(double));
+    if (!pprog)
+        goto done;
+    pprog->inputs = inputs;
+    pprog->stores = stores;
+    pprog->result = result;
+    pprog->nslots = constBase + pc->nconsts;
+    pprog->nconsts = pc->nconsts;
+    pprog->ninst = pc->ninst;
+    pprog->jumps = jumps;
+    pprog->consts = (double *) &pprog->inst[pc->ninst];
+    memcpy(pprog->inst, pc->inst, pc->ninst * sizeof(calcInst));
+    memcpy(pprog->consts, pc->consts, pc->nconsts * sizeof(double));
+
+done:
+    free(pc->inst);
+    free(pc->labelDepth);
+    free(pc->jumpFrom);
+    free(pc->jumpTo);
+    free(pc);
+    return pprog;
+}
+
+LIBCOM_API void
+    calcProgramFree(calcProgram *pprog)
+{
+    free(pprog);
+}
+
 LIBCOM_API long
 calcArgUsage(const char *pinst, unsigned long *pinputs, unsigned long *pstores)
 {
@@ -321,6 +321,69 @@ LIBCOM_API long
 LIBCOM_API long
     calcPerform(double *parg, double *presult, const char *ppostfix);
 
+/** \brief A compiled expression, see calcCompile() */
+typedef struct calcProgram calcProgram;
+
+/** \brief Compile a postfix expression for faster evaluation
+ *
+ * Translates the postfix byte-code into a program for a register machine,
+ * evaluating the parts of the expression that only involve constants and
+ * removing the stack traffic of the byte-code. The postfix expression is
+ * not needed after this, but remains the form to keep and pass around.
+ *
+ * \param ppostfix A postfix expression created by postfix().
+ * \return The program, or NULL if the expression couldn't be compiled or
+ * there was no memory, in which case use calcPerform() instead.
+ */
+LIBCOM_API calcProgram *
+    calcCompile(const char *ppostfix);
+
+/** \brief Run a compiled expression
+ *
+ * Gives the same results as calling calcPerform() with the postfix
+ * expression the program was compiled from, including any assignments
+ * to the arguments.
+ *
+ * \param pprog The program returned by calcCompile().
+ * \param parg Pointer to an array of double values for the arguments A-L.
+ * \param presult Where to put the calculated result.
+ * \return Status value 0 for OK.
+ */
+LIBCOM_API long
+    calcProgramPerform(const calcProgram *pprog, double *parg, double *presult);
+
+/** \brief Run a compiled expression over arrays of inputs
+ *
+ * Evaluates the expression once for each of \c nelem elements, processing
+ * several elements together so the arithmetic can use SIMD instructions.
+ * Element \c i takes the argument A from \c parg[0][i] if bit 0 of
+ * \c arrays is set, or from \c parg[0][0] if not, and so on through bit
+ * 11 for L. A NULL \c parg entry gives zero. VAL for element \c i is read
+ * from \c presult[i], which gets its result.
+ *
+ * Assignments to the arguments only last for the evaluation of one element,
+ * the input arrays are not modified. Expressions that use RNDM may assign
+ * the random numbers to the elements in a different order than evaluating
+ * them one at a time would.
+ *
+ * \param pprog The program returned by calcCompile().
+ * \param parg Pointer to an array of pointers to the values of the
+ * arguments A-L.
+ * \param arrays Bitmap of the arguments that have a value per element.
+ * \param presult Array of \c nelem results.
+ * \param nelem Number of elements to evaluate.
+ * \return Status value 0 for OK, or non-zero if out of memory.
+ */
+LIBCOM_API long
+    calcProgramPerformArray(const calcProgram *pprog, const double **parg,
+        unsigned long arrays, double *presult, unsigned long nelem);
+
+/** \brief Free a compiled expression
+ * \param pprog The program returned by calcCompile(), may be NULL.
+ */
+LIBCOM_API void
+    calcProgramFree(calcProgram *pprog);
+
 /** \brief Find the inputs and outputs of an expression
  *
  * Software using the calc subsystem may need to know what expression
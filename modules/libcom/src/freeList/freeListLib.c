@@ -23,7 +23,11 @@
 #endif
 
 #include "cantProceed.h"
+#include "ellLib.h"
 #include "epicsMutex.h"
+#include "epicsThread.h"
+#include "epicsExit.h"
+#include "epicsStdio.h"
 #include "freeList.h"
 #include "adjustment.h"
 #include "errlog.h"
@@ -41,10 +45,53 @@ int freeListBypass
 
 epicsExportAddress(int, freeListBypass);
 
+/* Elements in each per-thread magazine of lists created with
+ * freeListInitCachedPvt(), 0 disables the per-thread caches
+ */
+int freeListMagazineSize = 16;
+
+epicsExportAddress(int, freeListMagazineSize);
+
 typedef struct allocMem {
     struct allocMem     *next;
     void                *memory;
 }allocMem;
+
+/* Per-thread caches
+ *
+ * Each thread which allocates or frees elements of a cached list keeps
+ * two magazines of up to magazineSize free elements for it, and only
+ * takes the list's lock when both are empty (allocating) or both are
+ * full (freeing).  Then it exchanges a whole magazine with the list's
+ * depot, or refills one from the list's free elements.  Full magazines
+ * freed by one thread can so be reused by another which allocates.
+ *
+ * Threads find their magazines by the list's slot in the cacheLists
+ * registry.  A slot may be reused after its list has been cleaned up,
+ * which the thread notices from the list's unique id.  The magazines of
+ * an EPICS thread are returned to the list when the thread exits.
+ * Thread caches are only created, resized or destroyed holding
+ * cacheLock, so that freeListItemsAvail() can count their elements.
+ */
+typedef struct magazine {
+    struct magazine     *next;
+    int                 count;
+    void                *items[1];
+}magazine;
+
+typedef struct {
+    unsigned long       id;         /* of the list, 0 if unused */
+    magazine            *loaded;
+    magazine            *previous;
+    unsigned long       hits;       /* not yet added to the list */
+}cacheEntry;
+
+typedef struct {
+    ELLNODE             node;
+    unsigned            nentries;
+    cacheEntry          *entries;   /* indexed by list slot */
+}threadCache;
+
 typedef struct {
     int         size;
     int         nmalloc;
@@ -52,10 +99,35 @@ typedef struct {
     allocMem    *mallochead;
     size_t      nBlocksAvailable;
     epicsMutexId lock;
+    /* the rest is only used by cached lists */
+    const char  *name;
+    int         magazineSize;
+    unsigned    slot;
+    unsigned long id;
+    magazine    *depotFull;
+    magazine    *depotEmpty;
+    size_t      nDepotFull;
+    unsigned long cacheHits;
+    unsigned long cacheMisses;
+    unsigned long depotRefills;
+    unsigned long depotReturns;
 }FREELISTPVT;
 
-LIBCOM_API void epicsStdCall 
-    freeListInitPvt(void **ppvt,int size,int nmalloc)
+static epicsThreadOnceId cacheOnce = EPICS_THREAD_ONCE_INIT;
+static epicsThreadPrivateId cacheKey;
+static epicsMutexId cacheLock;      /* protects the registry */
+static FREELISTPVT **cacheLists;
+static unsigned nCacheSlots;
+static unsigned long cacheNextId = 1;
+static ELLLIST threadCaches = ELLLIST_INIT;
+
+static void cacheInit(void *unused)
+{
+    cacheKey = epicsThreadPrivateCreate();
+    cacheLock = epicsMutexMustCreate();
+}
+
+static int freeListInitCommon(void **ppvt,int size,int nmalloc)
 {
     FREELISTPVT *pfl;
     int bypass = epicsAtomicGetIntT(&freeListBypass);
@@ -83,32 +155,72 @@ LIBCOM_API void epicsStdCall
     pfl->lock = epicsMutexMustCreate();
     *ppvt = (void *)pfl;
     VALGRIND_CREATE_MEMPOOL(pfl, REDZONE, 0);
+    return !bypass;
 }
 
-LIBCOM_API void * epicsStdCall freeListCalloc(void *pvt)
+LIBCOM_API void epicsStdCall 
+    freeListInitPvt(void **ppvt,int size,int nmalloc)
 {
-    FREELISTPVT *pfl = pvt;
-    void        *ptemp;
+    freeListInitCommon(ppvt, size, nmalloc);
+}
 
-    if(!pfl->nmalloc)
-        ptemp = calloc(1u, pfl->size);
-    else if(!!(ptemp = freeListMalloc(pvt)))
-        memset((char *)ptemp,0,pfl->size);
-    return(ptemp);
+LIBCOM_API void epicsStdCall freeListInitCachedPvt(void **ppvt,
+    const char *name, int size, int nmalloc)
+{
+    FREELISTPVT *pfl;
+    int magazineSize = epicsAtomicGetIntT(&freeListMagazineSize);
+    unsigned slot;
+
+    if(!freeListInitCommon(ppvt, size, nmalloc) || nmalloc<=0 ||
+       magazineSize<=0)
+        return;
+
+    pfl = *ppvt;
+    pfl->name = name;
+    pfl->magazineSize = magazineSize;
+
+    epicsThreadOnce(&cacheOnce, cacheInit, NULL);
+    epicsMutexMustLock(cacheLock);
+    for(slot=0; slot<nCacheSlots && cacheLists[slot]; slot++) {}
+    if(slot==nCacheSlots) {
+        unsigned n = nCacheSlots ? 2*nCacheSlots : 16;
+        FREELISTPVT **plists = realloc(cacheLists, n*sizeof(*plists));
+
+        if(!plists) {
+            epicsMutexUnlock(cacheLock);
+            pfl->magazineSize = 0;
+            return;
+        }
+        memset(plists+nCacheSlots, 0, (n-nCacheSlots)*sizeof(*plists));
+        cacheLists = plists;
+        nCacheSlots = n;
+    }
+    pfl->slot = slot;
+    pfl->id = cacheNextId++;
+    cacheLists[slot] = pfl;
+    epicsMutexUnlock(cacheLock);
 }
-
-LIBCOM_API void * epicsStdCall freeListMalloc(void *pvt)
+
+static magazine *magazineCreate(FREELISTPVT *pfl)
+{
+    magazine *pmag = malloc(offsetof(magazine, items) +
+        pfl->magazineSize*sizeof(void *));
+
+    if(pmag) {
+        pmag->next = NULL;
+        pmag->count = 0;
+    }
+    return pmag;
+}
+
+/* Caller holds pfl->lock.  Returns a free element or NULL. */
+static void *listPop(FREELISTPVT *pfl)
 {
-    FREELISTPVT *pfl = pvt;
     void        *ptemp;
     void        **ppnext;
     allocMem    *pallocmem;
     int         i;
 
-    if(!pfl->nmalloc)
-        return malloc(pfl->size);
-
-    epicsMutexMustLock(pfl->lock);
     ptemp = pfl->head;
     if(ptemp==0) {
         /* layout of each block. nmalloc+1 REDZONEs for nmallocs.
@@ -119,13 +231,10 @@ LIBCOM_API void * epicsStdCall freeListMalloc(void *pvt)
          * |     | next | ----- |
          */
         ptemp = (void *)malloc(pfl->nmalloc*(pfl->size+REDZONE)+REDZONE);
-        if(ptemp==0) {
-            epicsMutexUnlock(pfl->lock);
+        if(ptemp==0)
             return(0);
-        }
         pallocmem = (allocMem *)calloc(1,sizeof(allocMem));
         if(pallocmem==0) {
-            epicsMutexUnlock(pfl->lock);
             free(ptemp);
             return(0);
         }
@@ -147,16 +256,240 @@ LIBCOM_API void * epicsStdCall freeListMalloc(void *pvt)
     ppnext = pfl->head;
     pfl->head = *ppnext;
     pfl->nBlocksAvailable--;
+    return(ptemp);
+}
+
+/* Caller holds pfl->lock */
+static void listPush(FREELISTPVT *pfl, void *pmem)
+{
+    void        **ppnext;
+
+    VALGRIND_MEMPOOL_ALLOC(pfl, pmem, sizeof(void*));
+    ppnext = pmem;
+    *ppnext = pfl->head;
+    pfl->head = pmem;
+    pfl->nBlocksAvailable++;
+}
+
+static void magazineDiscard(cacheEntry *pce)
+{
+    free(pce->loaded);
+    free(pce->previous);
+    memset(pce, 0, sizeof(*pce));
+}
+
+/* Return this thread's magazines to their lists */
+static void cacheThreadExit(void *arg)
+{
+    threadCache *ptc = arg;
+    unsigned    slot;
+
+    epicsMutexMustLock(cacheLock);
+    for(slot=0; slot<ptc->nentries; slot++) {
+        cacheEntry  *pce = &ptc->entries[slot];
+        FREELISTPVT *pfl = slot<nCacheSlots ? cacheLists[slot] : NULL;
+
+        if(!pce->id)
+            continue;
+        if(pfl && pfl->id==pce->id) {
+            magazine *mags[2];
+            int i;
+
+            mags[0] = pce->loaded;
+            mags[1] = pce->previous;
+            epicsMutexMustLock(pfl->lock);
+            for(i=0; i<2; i++) {
+                while(mags[i]->count > 0)
+                    listPush(pfl, mags[i]->items[--mags[i]->count]);
+            }
+            pfl->cacheHits += pce->hits;
+            epicsMutexUnlock(pfl->lock);
+        }
+        magazineDiscard(pce);
+    }
+    ellDelete(&threadCaches, &ptc->node);
+    epicsMutexUnlock(cacheLock);
+    epicsThreadPrivateSet(cacheKey, NULL);
+    free(ptc->entries);
+    free(ptc);
+}
+
+/* Returns the calling thread's magazines for this list, creating them
+ * if necessary, or NULL if out of memory.
+ */
+static cacheEntry *cacheLookup(FREELISTPVT *pfl)
+{
+    threadCache *ptc = epicsThreadPrivateGet(cacheKey);
+    cacheEntry  *pce = NULL;
+
+    if(ptc && pfl->slot<ptc->nentries &&
+       ptc->entries[pfl->slot].id==pfl->id)
+        return &ptc->entries[pfl->slot];
+
+    epicsMutexMustLock(cacheLock);
+    if(!ptc) {
+        ptc = calloc(1, sizeof(*ptc));
+        if(!ptc)
+            goto done;
+        ellAdd(&threadCaches, &ptc->node);
+        epicsThreadPrivateSet(cacheKey, ptc);
+        epicsAtThreadExit(cacheThreadExit, ptc);
+    }
+    if(pfl->slot>=ptc->nentries) {
+        unsigned n = pfl->slot+16u;
+        cacheEntry *pentries = realloc(ptc->entries, n*sizeof(*pentries));
+
+        if(!pentries)
+            goto done;
+        memset(pentries+ptc->nentries, 0,
+            (n-ptc->nentries)*sizeof(*pentries));
+        ptc->entries = pentries;
+        ptc->nentries = n;
+    }
+    pce = &ptc->entries[pfl->slot];
+    /* the slot's previous list has been cleaned up, its elements freed */
+    if(pce->id)
+        magazineDiscard(pce);
+
+    pce->loaded = magazineCreate(pfl);
+    pce->previous = magazineCreate(pfl);
+    if(!pce->loaded || !pce->previous) {
+        magazineDiscard(pce);
+        pce = NULL;
+        goto done;
+    }
+    pce->id = pfl->id;
+done:
+    epicsMutexUnlock(cacheLock);
+    return pce;
+}
+
+static void *cacheMalloc(FREELISTPVT *pfl, cacheEntry *pce)
+{
+    magazine    *pmag = pce->loaded;
+    void        *ptemp;
+
+    if(pmag->count==0 && pce->previous->count>0) {
+        pce->loaded = pce->previous;
+        pce->previous = pmag;
+        pmag = pce->loaded;
+    }
+    if(pmag->count>0) {
+        pce->hits++;
+        return pmag->items[--pmag->count];
+    }
+
+    /* both magazines are empty */
+    epicsMutexMustLock(pfl->lock);
+    pfl->cacheHits += pce->hits;
+    pce->hits = 0;
+    pfl->cacheMisses++;
+    if(pfl->depotFull) {
+        magazine *pfull = pfl->depotFull;
+
+        pfl->depotFull = pfull->next;
+        pfl->nDepotFull--;
+        pfl->depotRefills++;
+        pce->previous->next = pfl->depotEmpty;
+        pfl->depotEmpty = pce->previous;
+        pce->previous = pmag;
+        pce->loaded = pmag = pfull;
+    }
+    else {
+        while(pmag->count<pfl->magazineSize &&
+              (ptemp = listPop(pfl))) {
+            VALGRIND_MEMPOOL_FREE(pfl, ptemp);
+            pmag->items[pmag->count++] = ptemp;
+        }
+    }
+    ptemp = pmag->count>0 ? pmag->items[--pmag->count] : NULL;
+    epicsMutexUnlock(pfl->lock);
+    return ptemp;
+}
+
+static void cacheFree(FREELISTPVT *pfl, cacheEntry *pce, void *pmem)
+{
+    magazine    *pmag = pce->loaded;
+
+    if(pmag->count==pfl->magazineSize &&
+       pce->previous->count<pfl->magazineSize) {
+        pce->loaded = pce->previous;
+        pce->previous = pmag;
+        pmag = pce->loaded;
+    }
+    if(pmag->count<pfl->magazineSize) {
+        pce->hits++;
+        pmag->items[pmag->count++] = pmem;
+        return;
+    }
+
+    /* both magazines are full */
+    epicsMutexMustLock(pfl->lock);
+    pfl->cacheHits += pce->hits;
+    pce->hits = 0;
+    pfl->cacheMisses++;
+    pmag = pfl->depotEmpty;
+    if(pmag)
+        pfl->depotEmpty = pmag->next;
+    else
+        pmag = magazineCreate(pfl);
+    if(pmag) {
+        pce->previous->next = pfl->depotFull;
+        pfl->depotFull = pce->previous;
+        pfl->nDepotFull++;
+        pfl->depotReturns++;
+        pce->previous = pce->loaded;
+        pce->loaded = pmag;
+        pmag->items[pmag->count++] = pmem;
+    }
+    else {
+        listPush(pfl, pmem);
+    }
+    epicsMutexUnlock(pfl->lock);
+}
+
+LIBCOM_API void * epicsStdCall freeListCalloc(void *pvt)
+{
+    FREELISTPVT *pfl = pvt;
+    void        *ptemp;
+
+    if(!pfl->nmalloc)
+        ptemp = calloc(1u, pfl->size);
+    else if(!!(ptemp = freeListMalloc(pvt)))
+        memset((char *)ptemp,0,pfl->size);
+    return(ptemp);
+}
+
+LIBCOM_API void * epicsStdCall freeListMalloc(void *pvt)
+{
+    FREELISTPVT *pfl = pvt;
+    cacheEntry  *pce;
+    void        *ptemp;
+
+    if(!pfl->nmalloc)
+        return malloc(pfl->size);
+
+    if(pfl->magazineSize && (pce = cacheLookup(pfl))) {
+        ptemp = cacheMalloc(pfl, pce);
+        if(ptemp)
+            VALGRIND_MEMPOOL_ALLOC(pfl, ptemp, pfl->size);
+        return(ptemp);
+    }
+
+    epicsMutexMustLock(pfl->lock);
+    ptemp = listPop(pfl);
     epicsMutexUnlock(pfl->lock);
-    VALGRIND_MEMPOOL_FREE(pfl, ptemp);
-    VALGRIND_MEMPOOL_ALLOC(pfl, ptemp, pfl->size);
+    if(ptemp) {
+        VALGRIND_MEMPOOL_FREE(pfl, ptemp);
+        VALGRIND_MEMPOOL_ALLOC(pfl, ptemp, pfl->size);
+    }
     return(ptemp);
 }
 
 LIBCOM_API void epicsStdCall freeListFree(void *pvt,void*pmem)
 {
     FREELISTPVT *pfl = pvt;
-    void        **ppnext;
+    cacheEntry  *pce;
 
     if(!pfl->nmalloc) {
         free(pmem);
@@ -164,22 +497,40 @@ LIBCOM_API void epicsStdCall freeListFree(void *pvt,void*pmem)
     }
 
     VALGRIND_MEMPOOL_FREE(pvt, pmem);
-    VALGRIND_MEMPOOL_ALLOC(pvt, pmem, sizeof(void*));
+
+    if(pfl->magazineSize && (pce = cacheLookup(pfl))) {
+        cacheFree(pfl, pce, pmem);
+        return;
+    }
 
     epicsMutexMustLock(pfl->lock);
-    ppnext = pmem;
-    *ppnext = pfl->head;
-    pfl->head = pmem;
-    pfl->nBlocksAvailable++;
+    listPush(pfl, pmem);
     epicsMutexUnlock(pfl->lock);
 }
 
+static void freeMagazines(magazine *pmag)
+{
+    while(pmag) {
+        magazine *pnext = pmag->next;
+        free(pmag);
+        pmag = pnext;
+    }
+}
+
 LIBCOM_API void epicsStdCall freeListCleanup(void *pvt)
 {
     FREELISTPVT *pfl = pvt;
     allocMem    *phead;
     allocMem    *pnext;
 
+    if(pfl->magazineSize) {
+        epicsMutexMustLock(cacheLock);
+        cacheLists[pfl->slot] = NULL;
+        epicsMutexUnlock(cacheLock);
+        freeMagazines(pfl->depotFull);
+        freeMagazines(pfl->depotEmpty);
+    }
+
     VALGRIND_DESTROY_MEMPOOL(pvt);
 
     phead = pfl->mallochead;
@@ -196,10 +547,73 @@ LIBCOM_API void epicsStdCall freeListCleanup(void *pvt)
 LIBCOM_API size_t epicsStdCall freeListItemsAvail(void *pvt)
 {
     FREELISTPVT *pfl = pvt;
-    size_t nBlocksAvailable;
+    size_t nBlocksAvailable = 0;
+
+    if(pfl->magazineSize) {
+        threadCache *ptc;
+
+        /* the counts may change meanwhile, as for the list itself */
+        epicsMutexMustLock(cacheLock);
+        for(ptc = (threadCache *) ellFirst(&threadCaches); ptc;
+            ptc = (threadCache *) ellNext(&ptc->node)) {
+            cacheEntry *pce;
+
+            if(pfl->slot>=ptc->nentries)
+                continue;
+            pce = &ptc->entries[pfl->slot];
+            if(pce->id==pfl->id)
+                nBlocksAvailable += pce->loaded->count +
+                    pce->previous->count;
+        }
+        epicsMutexUnlock(cacheLock);
+    }
     epicsMutexMustLock(pfl->lock);
-    nBlocksAvailable = pfl->nBlocksAvailable;
+    nBlocksAvailable += pfl->nBlocksAvailable +
+        pfl->nDepotFull * pfl->magazineSize;
     epicsMutexUnlock(pfl->lock);
     return nBlocksAvailable;
 }
 
+LIBCOM_API void epicsStdCall freeListCacheStats(void *pvt,
+    freeListCacheStatistics *pstats)
+{
+    FREELISTPVT *pfl = pvt;
+
+    epicsMutexMustLock(pfl->lock);
+    pstats->magazineSize = pfl->magazineSize;
+    pstats->hits = pfl->cacheHits;
+    pstats->misses = pfl->cacheMisses;
+    pstats->depotRefills = pfl->depotRefills;
+    pstats->depotReturns = pfl->depotReturns;
+    pstats->depotFull = pfl->nDepotFull;
+    epicsMutexUnlock(pfl->lock);
+}
+
+LIBCOM_API void epicsStdCall freeListCacheReport(unsigned level)
+{
+    unsigned slot;
+
+    epicsThreadOnce(&cacheOnce, cacheInit, NULL);
+    epicsMutexMustLock(cacheLock);
+    for(slot=0; slot<nCacheSlots; slot++) {
+        FREELISTPVT *pfl = cacheLists[slot];
+        freeListCacheStatistics stats;
+        double total;
+
+        if(!pfl)
+            continue;
+        freeListCacheStats(pfl, &stats);
+        total = (double)stats.hits + stats.misses;
+        printf("%-24s %6d bytes, %lu available, %.1f%% cache hits\n",
+            pfl->name ? pfl->name : "?", pfl->size,
+            (unsigned long)freeListItemsAvail(pfl),
+            total>0 ? 100.0*stats.hits/total : 0.0);
+        if(level>0)
+            printf("    magazines of %d, %lu hits, %lu misses, "
+                "%lu depot refills, %lu returns, %lu full in depot\n",
+                stats.magazineSize, stats.hits, stats.misses,
+                stats.depotRefills, stats.depotReturns,
+                (unsigned long)stats.depotFull);
+    }
+    epicsMutexUnlock(cacheLock);
+}
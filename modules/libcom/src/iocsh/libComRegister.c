@@ -456,6 +456,17 @@ static void epicsThreadResumeCallFunc(const iocshArgBuf *args)
     }
 }
 
+/* freeListCacheReport */
+static const iocshArg freeListCacheReportArg0 = { "level", iocshArgInt};
+static const iocshArg * const freeListCacheReportArgs[1] = { &freeListCacheReportArg0 };
+static const iocshFuncDef freeListCacheReportFuncDef = {"freeListCacheReport",1,freeListCacheReportArgs,
+                                                        "Show the per-thread cache hit rate of free lists created with caches.\n"
+                                                        "level 1 also shows magazine and depot counts.\n"};
+static void freeListCacheReportCallFunc(const iocshArgBuf *args)
+{
+    freeListCacheReport(args[0].ival);
+}
+
 /* generalTimeReport */
 static const iocshArg generalTimeReportArg0 = { "interest_level", iocshArgInt};
 static const iocshArg * const generalTimeReportArgs[1] = { &generalTimeReportArg0 };
@@ -480,6 +491,7 @@ static void installLastResortEventProviderCallFunc(const iocshArgBuf *args)
 static iocshVarDef comDefs[] = {
     { "asCheckClientIP", iocshArgInt, 0 },
     { "freeListBypass", iocshArgInt, 0 },
+    { "freeListMagazineSize", iocshArgInt, 0 },
     { NULL, iocshArgInt, NULL }
 };
 
@@ -516,9 +528,11 @@ void epicsStdCall libComRegister(void)
     iocshRegister(&epicsThreadResumeFuncDef,epicsThreadResumeCallFunc);
 
     iocshRegister(&generalTimeReportFuncDef,generalTimeReportCallFunc);
+    iocshRegister(&freeListCacheReportFuncDef,freeListCacheReportCallFunc);
     iocshRegister(&installLastResortEventProviderFuncDef, installLastResortEventProviderCallFunc);
 
     comDefs[0].pval = &asCheckClientIP;
     comDefs[1].pval = &freeListBypass;
+    comDefs[2].pval = &freeListMagazineSize;
     iocshRegisterVariable(comDefs);
 }
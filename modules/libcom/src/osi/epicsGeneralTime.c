@@ -14,9 +14,11 @@
 #include <stdlib.h>
 
 #include "epicsTypes.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "epicsMessageQueue.h"
+#include "epicsSpin.h"
 #include "epicsString.h"
 #include "epicsStdioRedirect.h"
 #include "epicsThread.h"
@@ -59,11 +61,25 @@ typedef struct {
     } getInt;
 } gtProvider;
 
+/* The time providers in priority order, as seen by epicsTimeGetCurrent().
+ * A new table is published each time a provider is registered.  Readers
+ * take no lock, so replaced tables are kept; providers can't be removed,
+ * so there are never more tables than providers.
+ */
+typedef struct gtProviderTable {
+    struct gtProviderTable *retired;
+    int count;
+    gtProvider *providers[1];
+} gtProviderTable;
+
 static struct {
     epicsMutexId    timeListLock;
     ELLLIST         timeProviders;
-    gtProvider      *lastTimeProvider;
-    epicsTimeStamp  lastProvidedTime;
+    EpicsAtomicPtrT timeTable;      /* gtProviderTable */
+    EpicsAtomicPtrT lastTimeProvider;   /* gtProvider */
+    size_t          lastProvidedTime;   /* packed, if size_t has 64 bits */
+    epicsSpinId     lastTimeLock;       /* otherwise */
+    epicsTimeStamp  lastTime;
 
     epicsMutexId    eventListLock;
     ELLLIST         eventProviders;
@@ -89,6 +105,8 @@ static void generalTime_InitOnce(void *dummy)
 {
     ellInit(&gtPvt.timeProviders);
     gtPvt.timeListLock = epicsMutexMustCreate();
+    if (sizeof(size_t) < 8)
+        gtPvt.lastTimeLock = epicsSpinMustCreate();
 
     ellInit(&gtPvt.eventProviders);
     gtPvt.eventListLock = epicsMutexMustCreate();
@@ -105,8 +123,9 @@ void generalTime_Init(void)
 
 int generalTimeGetExceptPriority(epicsTimeStamp *pDest, int *pPrio, int ignore)
 {
+    gtProviderTable *ptable;
     gtProvider *ptp;
-    int status = S_time_noProvider;
+    int i, status = S_time_noProvider;
 
     if(useOsdGetCurrent)
         return osdTimeGetCurrent(pDest);
@@ -116,9 +135,10 @@ int generalTimeGetExceptPriority(epicsTimeStamp *pDest, int *pPrio, int ignore)
     IFDEBUG(2)
         printf("generalTimeGetExceptPriority(ignore=%d)\n", ignore);
 
-    epicsMutexMustLock(gtPvt.timeListLock);
-    for (ptp = (gtProvider *)ellFirst(&gtPvt.timeProviders);
-         ptp; ptp = (gtProvider *)ellNext(&ptp->node)) {
+    ptable = epicsAtomicGetPtrT(&gtPvt.timeTable);
+    epicsAtomicReadMemoryBarrier();
+    for (i = 0, ptp = NULL; ptable && i < ptable->count; i++) {
+        ptp = ptable->providers[i];
         if ((ignore > 0 && ptp->priority == ignore) ||
             (ignore < 0 && ptp->priority != -ignore))
             continue;
@@ -133,7 +153,6 @@ int generalTimeGetExceptPriority(epicsTimeStamp *pDest, int *pPrio, int ignore)
         else IFDEBUG(2)
             printf("gTGExP provider '%s' returned error\n", ptp->name);
     }
-    epicsMutexUnlock(gtPvt.timeListLock);
 
     IFDEBUG(2) {
         if (ptp && status == epicsTimeOK) {
@@ -150,10 +169,48 @@ int generalTimeGetExceptPriority(epicsTimeStamp *pDest, int *pPrio, int ignore)
     return status;
 }
 
+/* Returns 0 and sets *pLast if ts is older than the last time returned,
+ * otherwise makes ts the last time returned.
+ */
+static int ratchetTime(const epicsTimeStamp *ts, epicsTimeStamp *pLast)
+{
+    if (sizeof(size_t) >= 8) {
+        /* seconds in the upper half, so compares as a time */
+        size_t now = ((size_t) ts->secPastEpoch << 16 << 16) | ts->nsec;
+        size_t last = epicsAtomicGetSizeT(&gtPvt.lastProvidedTime);
+
+        while (now > last) {
+            size_t prev = epicsAtomicCmpAndSwapSizeT(&gtPvt.lastProvidedTime,
+                last, now);
+            if (prev == last)
+                return 1;
+            last = prev;
+        }
+        if (now == last)
+            return 1;
+        pLast->secPastEpoch = (epicsUInt32) (last >> 16 >> 16);
+        pLast->nsec = (epicsUInt32) last;
+        return 0;
+    }
+    else {
+        int ok;
+
+        epicsSpinLock(gtPvt.lastTimeLock);
+        ok = epicsTimeGreaterThanEqual(ts, &gtPvt.lastTime);
+        if (ok)
+            gtPvt.lastTime = *ts;
+        else
+            *pLast = gtPvt.lastTime;
+        epicsSpinUnlock(gtPvt.lastTimeLock);
+        return ok;
+    }
+}
+
 int epicsStdCall epicsTimeGetCurrent(epicsTimeStamp *pDest)
 {
-    gtProvider *ptp;
-    int status = S_time_noProvider;
+    gtProviderTable *ptable;
+    gtProvider *ptp = NULL;
+    int i, status = S_time_noProvider;
     epicsTimeStamp ts;
 
     if(useOsdGetCurrent)
@@ -164,21 +221,22 @@ int epicsStdCall epicsTimeGetCurrent(epicsTimeStamp *pDest)
     IFDEBUG(20)
         printf("epicsTimeGetCurrent()\n");
 
-    epicsMutexMustLock(gtPvt.timeListLock);
-    for (ptp = (gtProvider *)ellFirst(&gtPvt.timeProviders);
-         ptp; ptp = (gtProvider *)ellNext(&ptp->node)) {
+    /* No lock, providers may be registered while we look */
+    ptable = epicsAtomicGetPtrT(&gtPvt.timeTable);
+    epicsAtomicReadMemoryBarrier();
+    for (i = 0; ptable && i < ptable->count; i++) {
+        ptp = ptable->providers[i];
 
         status = ptp->get.Time(&ts);
         if (status == epicsTimeOK) {
             /* check time is monotonic */
-            if (epicsTimeGreaterThanEqual(&ts, &gtPvt.lastProvidedTime)) {
+            if (ratchetTime(&ts, pDest)) {
                 *pDest = ts;
-                gtPvt.lastProvidedTime = ts;
-                gtPvt.lastTimeProvider = ptp;
+                if (epicsAtomicGetPtrT(&gtPvt.lastTimeProvider) != ptp)
+                    epicsAtomicSetPtrT(&gtPvt.lastTimeProvider, ptp);
             } else {
                 int key;
 
-                *pDest = gtPvt.lastProvidedTime;
                 key = epicsInterruptLock();
                 gtPvt.ErrorCounts++;
                 epicsInterruptUnlock(key);
@@ -186,8 +244,7 @@ int epicsStdCall epicsTimeGetCurrent(epicsTimeStamp *pDest)
                 IFDEBUG(10) {
                     char last[40], buff[40];
 
-                    epicsTimeToStrftime(last, sizeof(last), tsfmt,
-                        &gtPvt.lastProvidedTime);
+                    epicsTimeToStrftime(last, sizeof(last), tsfmt, pDest);
                     epicsTimeToStrftime(buff, sizeof(buff), tsfmt, &ts);
                     printf("eTGC provider '%s' returned older time\n"
                         "    %s, using %s instead\n", ptp->name, buff, last);
@@ -197,8 +254,7 @@ int epicsStdCall epicsTimeGetCurrent(epicsTimeStamp *pDest)
         }
     }
     if (status)
-        gtPvt.lastTimeProvider = NULL;
-    epicsMutexUnlock(gtPvt.timeListLock);
+        epicsAtomicSetPtrT(&gtPvt.lastTimeProvider, NULL);
 
     IFDEBUG(20) {
         if (ptp && status == epicsTimeOK) {
@@ -225,7 +281,7 @@ int epicsTimeGetMonotonic ( epicsTimeStamp * pDest )
 
 int epicsTimeGetCurrentInt(epicsTimeStamp *pDest)
 {
-    gtProvider *ptp = gtPvt.lastTimeProvider;
+    gtProvider *ptp = epicsAtomicGetPtrT(&gtPvt.lastTimeProvider);
 
     if (ptp == NULL ||
         ptp->getInt.Time == NULL) {
@@ -369,6 +425,27 @@ int epicsTimeGetEventInt(epicsTimeStamp *pDest, int eventNumber)
 
 /* Provider Registration */
 
+/* Call with timeListLock held */
+static void publishTimeTable(void)
+{
+    gtProviderTable *ptable, *pold;
+    gtProvider *ptp;
+    int i = 0;
+
+    ptable = mallocMustSucceed(sizeof(gtProviderTable) +
+        ellCount(&gtPvt.timeProviders) * sizeof(gtProvider *),
+        "publishTimeTable");
+    for (ptp = (gtProvider *)ellFirst(&gtPvt.timeProviders);
+         ptp; ptp = (gtProvider *)ellNext(&ptp->node)) {
+        ptable->providers[i++] = ptp;
+    }
+    ptable->count = i;
+    pold = epicsAtomicGetPtrT(&gtPvt.timeTable);
+    ptable->retired = pold;
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetPtrT(&gtPvt.timeTable, ptable);
+}
+
 static void insertProvider(gtProvider *ptp, ELLLIST *plist, epicsMutexId lock)
 {
     gtProvider *ptpref;
@@ -389,9 +466,12 @@ static void insertProvider(gtProvider *ptp, ELLLIST *plist, epicsMutexId lock)
         ellAdd(plist, &ptp->node);
     }
 
-    /* Check to see if we have more than just the OS default time source */
-    if(plist==&gtPvt.timeProviders && (ellCount(plist)!=1 || ptp->get.Time!=&osdTimeGetCurrent)) {
-        useOsdGetCurrent = 0;
+    if (plist == &gtPvt.timeProviders) {
+        publishTimeTable();
+
+        /* Check to see if we have more than just the OS default time source */
+        if (ellCount(plist)!=1 || ptp->get.Time!=&osdTimeGetCurrent)
+            useOsdGetCurrent = 0;
     }
 
     epicsMutexUnlock(lock);
@@ -638,8 +718,10 @@ int generalTimeGetErrorCounts(void)
 
 const char * generalTimeCurrentProviderName(void)
 {
-    if (gtPvt.lastTimeProvider)
-        return gtPvt.lastTimeProvider->name;
+    gtProvider *ptp = epicsAtomicGetPtrT(&gtPvt.lastTimeProvider);
+
+    if (ptp)
+        return ptp->name;
     return NULL;
 }
 
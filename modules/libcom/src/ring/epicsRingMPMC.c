@@ -0,0 +1,198 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Slot i of the ring holds the element pushed at position pos when its
+ * seq is pos + 1, and is free for the push at position pos when its seq
+ * is pos.  Popping the element at pos frees the slot for the push at
+ * pos + size.  Pushers claim positions by advancing pushPos, poppers by
+ * advancing popPos, both with compare and swap.
+ *
+ * Publishing a slot and reading popPos in epicsRingMPMCPush(), and
+ * advancing popPos then reading the next slot in epicsRingMPMCPopBatch(),
+ * are each separated by a full barrier (compare and swap).  So either a
+ * popper sees the new element, or the pusher sees that popPos is at its
+ * element and returns 2 to have a sleeping reader woken.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "epicsAtomic.h"
+#include "epicsRingMPMC.h"
+
+/* keep the positions written by pushers and poppers apart */
+#define CACHE_LINE 64
+
+typedef struct ringSlot {
+    size_t seq;
+    void *data;
+} ringSlot;
+
+struct epicsRingMPMC {
+    size_t mask;
+    ringSlot *slots;
+    char pad0[CACHE_LINE];
+    size_t pushPos;
+    char pad1[CACHE_LINE - sizeof(size_t)];
+    size_t popPos;
+    int highWaterMark;
+    char pad2[CACHE_LINE];
+};
+
+LIBCOM_API epicsRingMPMCId epicsStdCall epicsRingMPMCCreate(int size)
+{
+    epicsRingMPMCId ring;
+    size_t n = 2, i;
+
+    if (size <= 0)
+        return NULL;
+    while (n < (size_t) size)
+        n <<= 1;
+
+    ring = calloc(1, sizeof(*ring));
+    if (!ring)
+        return NULL;
+    ring->slots = malloc(n * sizeof(ringSlot));
+    if (!ring->slots) {
+        free(ring);
+        return NULL;
+    }
+    for (i = 0; i < n; i++) {
+        ring->slots[i].seq = i;
+        ring->slots[i].data = NULL;
+    }
+    ring->mask = n - 1;
+    return ring;
+}
+
+LIBCOM_API void epicsStdCall epicsRingMPMCDelete(epicsRingMPMCId ring)
+{
+    free(ring->slots);
+    free(ring);
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCPush(epicsRingMPMCId ring, void *p)
+{
+    size_t pos = epicsAtomicGetSizeT(&ring->pushPos);
+    ringSlot *slot;
+
+    for (;;) {
+        size_t seq;
+
+        slot = &ring->slots[pos & ring->mask];
+        seq = epicsAtomicGetSizeT(&slot->seq);
+        epicsAtomicReadMemoryBarrier();
+        if (seq == pos) {
+            size_t prev = epicsAtomicCmpAndSwapSizeT(&ring->pushPos,
+                pos, pos + 1);
+            if (prev == pos)
+                break;
+            pos = prev;
+        }
+        else if ((ptrdiff_t) (seq - pos) < 0) {
+            return 0;   /* not yet popped since the last time around */
+        }
+        else {
+            pos = epicsAtomicGetSizeT(&ring->pushPos);
+        }
+    }
+
+    slot->data = p;
+    /* publish, with a full barrier before reading popPos */
+    epicsAtomicCmpAndSwapSizeT(&slot->seq, pos, pos + 1);
+    return epicsAtomicGetSizeT(&ring->popPos) == pos ? 2 : 1;
+}
+
+LIBCOM_API void* epicsStdCall epicsRingMPMCPop(epicsRingMPMCId ring)
+{
+    void *p;
+
+    return epicsRingMPMCPopBatch(ring, &p, 1) ? p : NULL;
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCPopBatch(epicsRingMPMCId ring,
+    void **items, int max)
+{
+    size_t pos = epicsAtomicGetSizeT(&ring->popPos);
+    size_t used;
+    int n, i;
+
+    used = epicsAtomicGetSizeT(&ring->pushPos) - pos;
+    if ((ptrdiff_t) used > epicsAtomicGetIntT(&ring->highWaterMark) &&
+        used <= ring->mask + 1)
+        epicsAtomicSetIntT(&ring->highWaterMark, (int) used);
+
+    for (;;) {
+        size_t prev;
+
+        /* count the published elements from pos */
+        for (n = 0; n < max; n++) {
+            ringSlot *slot = &ring->slots[(pos + n) & ring->mask];
+
+            if (epicsAtomicGetSizeT(&slot->seq) != pos + n + 1)
+                break;
+        }
+        if (n == 0) {
+            ringSlot *slot = &ring->slots[pos & ring->mask];
+
+            if ((ptrdiff_t) (epicsAtomicGetSizeT(&slot->seq) - (pos + 1)) < 0)
+                return 0;   /* empty, or the next push is incomplete */
+            pos = epicsAtomicGetSizeT(&ring->popPos);
+            continue;
+        }
+        prev = epicsAtomicCmpAndSwapSizeT(&ring->popPos, pos, pos + n);
+        if (prev == pos)
+            break;
+        pos = prev;
+    }
+
+    for (i = 0; i < n; i++) {
+        items[i] = ring->slots[(pos + i) & ring->mask].data;
+    }
+    /* the loads of data complete before the slots are reused */
+    epicsAtomicReadMemoryBarrier();
+    for (i = 0; i < n; i++) {
+        ringSlot *slot = &ring->slots[(pos + i) & ring->mask];
+
+        epicsAtomicSetSizeT(&slot->seq, pos + i + ring->mask + 1);
+    }
+    return n;
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCGetUsed(epicsRingMPMCId ring)
+{
+    size_t popPos = epicsAtomicGetSizeT(&ring->popPos);
+    ptrdiff_t used = epicsAtomicGetSizeT(&ring->pushPos) - popPos;
+
+    if (used < 0)
+        return 0;
+    if ((size_t) used > ring->mask + 1)
+        return (int) (ring->mask + 1);
+    return (int) used;
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCGetSize(epicsRingMPMCId ring)
+{
+    return (int) (ring->mask + 1);
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCIsEmpty(epicsRingMPMCId ring)
+{
+    return epicsRingMPMCGetUsed(ring) == 0;
+}
+
+LIBCOM_API int epicsStdCall epicsRingMPMCGetHighWaterMark(epicsRingMPMCId ring)
+{
+    return epicsAtomicGetIntT(&ring->highWaterMark);
+}
+
+LIBCOM_API void epicsStdCall epicsRingMPMCResetHighWaterMark(epicsRingMPMCId ring)
+{
+    epicsAtomicSetIntT(&ring->highWaterMark, epicsRingMPMCGetUsed(ring));
+}
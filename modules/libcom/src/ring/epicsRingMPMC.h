@@ -0,0 +1,110 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/**
+ * \file epicsRingMPMC.h
+ * \brief A bounded lock-free queue of pointers for many writers and readers
+ *
+ * \details
+ * EpicsRingMPMC is a first in first out ring buffer of pointers which any
+ * number of threads may push to and pop from at the same time without a
+ * lock, based on Dmitry Vyukov's bounded MPMC queue.  Each slot has a
+ * sequence number telling pushers and poppers whose turn it is, so a full
+ * or empty ring is detected without reading the other side's position.
+ * It is safe to push from interrupt context.
+ *
+ * epicsRingMPMCPopBatch() takes several elements with one atomic update.
+ * epicsRingMPMCPush() tells the caller when the element it pushed was the
+ * first one not yet taken, which is when a reader may have found the ring
+ * empty and gone to sleep; pushes onto a non-empty ring don't need to wake
+ * anyone.
+ */
+
+#ifndef INCepicsRingMPMCh
+#define INCepicsRingMPMCh
+
+#include "libComAPI.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief An identifier for a lock-free ring */
+typedef struct epicsRingMPMC *epicsRingMPMCId;
+
+/**
+ * \brief Create a new ring
+ * \param size Minimum number of elements, rounded up to a power of 2
+ * \return Ring identifier or NULL on failure
+ */
+LIBCOM_API epicsRingMPMCId epicsStdCall epicsRingMPMCCreate(int size);
+/**
+ * \brief Delete the ring and free its memory
+ * \param id Ring identifier
+ */
+LIBCOM_API void epicsStdCall epicsRingMPMCDelete(epicsRingMPMCId id);
+/**
+ * \brief Push a pointer onto the ring
+ * \param id Ring identifier
+ * \param p Pointer to be pushed, must not be NULL
+ * \return 0 if the ring was full, otherwise 1, or 2 if no earlier element
+ * remained to be popped so a reader may need waking.
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCPush(epicsRingMPMCId id, void *p);
+/**
+ * \brief Take the oldest element off the ring
+ * \param id Ring identifier
+ * \return The pointer, or NULL if the ring was empty
+ */
+LIBCOM_API void* epicsStdCall epicsRingMPMCPop(epicsRingMPMCId id);
+/**
+ * \brief Take up to max of the oldest elements off the ring
+ * \param id Ring identifier
+ * \param items Where to put the pointers, in order
+ * \param max Size of items
+ * \return The number of pointers taken, 0 if the ring was empty
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCPopBatch(epicsRingMPMCId id,
+    void **items, int max);
+/**
+ * \brief Return the number of elements stored in the ring
+ * \param id Ring identifier
+ * \return The number of elements, which may already have changed
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCGetUsed(epicsRingMPMCId id);
+/**
+ * \brief Return the size of the ring
+ * \param id Ring identifier
+ * \return The number of elements the ring can hold
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCGetSize(epicsRingMPMCId id);
+/**
+ * \brief Check if the ring is currently empty
+ * \param id Ring identifier
+ * \return 1 if the ring is empty, otherwise 0
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCIsEmpty(epicsRingMPMCId id);
+/**
+ * \brief Get the high water mark of the ring
+ *
+ * The largest number of elements seen in the ring by a pop since the mark
+ * was last reset.
+ * \param id Ring identifier
+ * \return The high water mark
+ */
+LIBCOM_API int epicsStdCall epicsRingMPMCGetHighWaterMark(epicsRingMPMCId id);
+/**
+ * \brief Reset the high water mark to the current number of elements
+ * \param id Ring identifier
+ */
+LIBCOM_API void epicsStdCall epicsRingMPMCResetHighWaterMark(epicsRingMPMCId id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCepicsRingMPMCh */
@@ -17,6 +17,7 @@
 #define epicsTimerPrivate_h
 
 #include <typeinfo>
+#include <vector>
 
 #include "tsFreeList.h"
 #include "epicsSingleton.h"
@@ -37,7 +38,7 @@
 
 template < class T > class epicsGuard;
 
-class timer : public epicsTimer, public tsDLNode < timer > {
+class timer : public epicsTimer {
 public:
     void destroy () override;
     void start ( class epicsTimerNotify &, const epicsTime & ) override final;
@@ -56,6 +57,8 @@ private:
     epicsTime exp; // expiration time
     state curState; // current state
     epicsTimerNotify * pNotify; // callback
+    unsigned heapIndex; // position in the queue's heap when pending
+    unsigned startSeq; // orders timers with the same expiration time
     void privateStart ( epicsTimerNotify & notify, const epicsTime & );
     timer & operator = ( const timer & );
     // Visual C++ .net appears to require operator delete if
@@ -104,7 +107,9 @@ private:
     tsFreeList < epicsTimerForC, 0x20 > timerForCFreeList;
     mutable epicsMutex mutex;
     epicsEvent cancelBlockingEvent;
-    tsDLList < timer > timerList;
+    // 4-ary min-heap of pending timers, ordered by expiration time
+    std :: vector < timer * > heap;
+    unsigned startCount;
     epicsTimerQueueNotify & notify;
     timer * pExpireTmr;
     epicsThreadId processThread;
@@ -113,6 +118,12 @@ private:
     static const double exceptMsgMinPeriod;
     void printExceptMsg ( const char * pName,
                 const type_info & type );
+    static bool before ( const timer &, const timer & );
+    timer * first () const;
+    void insert ( timer & );
+    void remove ( timer & );
+    void siftUp ( unsigned index, timer & );
+    void siftDown ( unsigned index, timer & );
     timerQueue ( const timerQueue & );
     timerQueue & operator = ( const timerQueue & );
     friend class timer;
@@ -231,6 +242,11 @@ private:
     epicsTimerQueueActiveForC & operator = ( const epicsTimerQueueActiveForC & );
 };
 
+inline timer * timerQueue::first () const
+{
+    return this->heap.empty () ? 0 : this->heap.front ();
+}
+
 inline bool timerQueueActive::sharingOK () const
 {
     return this->okToShare;
@@ -26,6 +26,7 @@ epicsTimerQueue::~epicsTimerQueue () {}
 
 timerQueue::timerQueue ( epicsTimerQueueNotify & notifyIn ) :
     mutex(__FILE__, __LINE__),
+    startCount ( 0u ),
     notify ( notifyIn ),
     pExpireTmr ( 0 ),
     processThread ( 0 ),
@@ -37,9 +38,89 @@ timerQueue::timerQueue ( epicsTimerQueueNotify & notifyIn ) :
 
 timerQueue::~timerQueue ()
 {
-    timer *pTmr;
-    while ( ( pTmr = this->timerList.get () ) ) {
-        pTmr->curState = timer::stateLimbo;
+    for ( unsigned i = 0u; i < this->heap.size (); i++ ) {
+        this->heap[i]->curState = timer::stateLimbo;
+    }
+}
+
+//
+// Pending timers are kept in a 4-ary min-heap so that starting and
+// canceling a timer costs O(log n) with many thousands pending. Each
+// timer records its position for removal from the middle of the heap.
+// Timers with the same expiration time expire in the order started.
+//
+bool timerQueue::before ( const timer & a, const timer & b )
+{
+    if ( a.exp < b.exp ) {
+        return true;
+    }
+    if ( b.exp < a.exp ) {
+        return false;
+    }
+    return static_cast < int > ( a.startSeq - b.startSeq ) < 0;
+}
+
+void timerQueue::siftUp ( unsigned index, timer & tmr )
+{
+    while ( index > 0u ) {
+        unsigned parent = ( index - 1u ) / 4u;
+        timer * pParent = this->heap[parent];
+        if ( ! before ( tmr, *pParent ) ) {
+            break;
+        }
+        this->heap[index] = pParent;
+        pParent->heapIndex = index;
+        index = parent;
+    }
+    this->heap[index] = & tmr;
+    tmr.heapIndex = index;
+}
+
+void timerQueue::siftDown ( unsigned index, timer & tmr )
+{
+    const unsigned n = static_cast < unsigned > ( this->heap.size () );
+    while ( true ) {
+        unsigned child = index * 4u + 1u;
+        if ( child >= n ) {
+            break;
+        }
+        unsigned last = child + 4u < n ? child + 4u : n;
+        unsigned least = child;
+        for ( unsigned i = child + 1u; i < last; i++ ) {
+            if ( before ( *this->heap[i], *this->heap[least] ) ) {
+                least = i;
+            }
+        }
+        if ( ! before ( *this->heap[least], tmr ) ) {
+            break;
+        }
+        this->heap[index] = this->heap[least];
+        this->heap[index]->heapIndex = index;
+        index = least;
+    }
+    this->heap[index] = & tmr;
+    tmr.heapIndex = index;
+}
+
+void timerQueue::insert ( timer & tmr )
+{
+    this->heap.push_back ( & tmr );
+    this->siftUp ( static_cast < unsigned > ( this->heap.size () - 1u ), tmr );
+}
+
+void timerQueue::remove ( timer & tmr )
+{
+    unsigned index = tmr.heapIndex;
+    timer * pLast = this->heap.back ();
+    this->heap.pop_back ();
+    if ( pLast != & tmr ) {
+        if ( index > 0u &&
+                before ( *pLast, *this->heap[( index - 1u ) / 4u] ) ) {
+            this->siftUp ( index, *pLast );
+        }
+        else {
+            this->siftDown ( index, *pLast );
+        }
     }
 }
 
@@ -83,7 +164,7 @@ double timerQueue::process ( const epicsTime & currentTime )
     if ( this->pExpireTmr ) {
         // if some other thread is processing the queue
         // (or if this is a recursive call)
-        timer * pTmr = this->timerList.first ();
+        timer * pTmr = this->first ();
         if ( pTmr ) {
             double delay = pTmr->exp - currentTime;
             if ( delay < 0.0 ) {
@@ -100,10 +181,10 @@ double timerQueue::process ( const epicsTime & currentTime )
     // Tag current expired tmr so that we can detect if call back
     // is in progress when canceling the timer.
     //
-    if ( this->timerList.first () ) {
-        if ( currentTime >= this->timerList.first ()->exp ) {
-            this->pExpireTmr = this->timerList.first ();
-            this->timerList.remove ( *this->pExpireTmr );
+    if ( this->first () ) {
+        if ( currentTime >= this->first ()->exp ) {
+            this->pExpireTmr = this->first ();
+            this->remove ( *this->pExpireTmr );
             this->pExpireTmr->curState = timer::stateActive;
             this->processThread = epicsThreadGetIdSelf ();
 #           ifdef DEBUG
@@ -111,7 +192,7 @@ double timerQueue::process ( const epicsTime & currentTime )
 #           endif
         }
         else {
-            double delay = this->timerList.first ()->exp - currentTime;
+            double delay = this->first ()->exp - currentTime;
             debugPrintf ( ( "no activity process %f to next\n", delay ) );
             return delay;
         }
@@ -178,17 +259,17 @@ double timerQueue::process ( const epicsTime & currentTime )
         }
         this->pExpireTmr = 0;
 
-        if ( this->timerList.first () ) {
-            if ( currentTime >= this->timerList.first ()->exp ) {
-                this->pExpireTmr = this->timerList.first ();
-                this->timerList.remove ( *this->pExpireTmr );
+        if ( this->first () ) {
+            if ( currentTime >= this->first ()->exp ) {
+                this->pExpireTmr = this->first ();
+                this->remove ( *this->pExpireTmr );
                 this->pExpireTmr->curState = timer::stateActive;
 #               ifdef DEBUG
                     this->pExpireTmr->show ( 0u );
 #               endif
             }
             else {
-                delay = this->timerList.first ()->exp - currentTime;
+                delay = this->first ()->exp - currentTime;
                 this->processThread = 0;
                 break;
             }
@@ -215,12 +296,11 @@ epicsTimerForC & timerQueue::createTimerForC ( epicsTimerCallback pCallback, voi
 void timerQueue::show ( unsigned level ) const
 {
     epicsGuard < epicsMutex > locker ( this->mutex );
-    printf ( "epicsTimerQueue with %u items pending\n", this->timerList.count () );
+    printf ( "epicsTimerQueue with %u items pending\n",
+        static_cast < unsigned > ( this->heap.size () ) );
     if ( level >= 1u ) {
-        tsDLIterConst < timer > iter = this->timerList.firstIter ();
-        while ( iter.valid () ) {
-            iter->show ( level - 1u );
-            ++iter;
+        for ( unsigned i = 0u; i < this->heap.size (); i++ ) {
+            this->heap[i]->show ( level - 1u );
         }
     }
 }
@@ -14,11 +14,47 @@
 #include "epicsTypes.h"
 #include "epicsMath.h"
 #include "epicsAlgorithm.h"
+#include "epicsTime.h"
 #include "postfix.h"
 #include "testMain.h"
 
 /* Infrastructure for running tests */
 
+static bool sameValue(double x, double y) {
+    return x == y || (isnan(x) && isnan(y));
+}
+
+bool testCompiled(const char *rpn, const double *argsIn, const double *args,
+    double result) {
+    /* Check the compiled program gives the same results as calcPerform */
+    double pargs[CALCPERFORM_NARGS];
+    double presult = 0.0;
+    calcProgram *prog = calcCompile(rpn);
+    bool pass = true;
+    int n;
+
+    presult /= presult;  /* Start as NaN */
+    if (!prog) {
+        testDiag("calcCompile: failed");
+        return false;
+    }
+    memcpy(pargs, argsIn, sizeof(pargs));
+    calcProgramPerform(prog, pargs, &presult);
+    if (!sameValue(presult, result)) {
+        testDiag("Program result is %g, calcPerform got %g", presult, result);
+        pass = false;
+    }
+    for (n = 0; n < CALCPERFORM_NARGS; n++) {
+        if (!sameValue(pargs[n], args[n])) {
+            testDiag("Program set %c to %g, calcPerform to %g",
+                'A' + n, pargs[n], args[n]);
+            pass = false;
+        }
+    }
+    calcProgramFree(prog);
+    return pass;
+}
+
 double doCalc(const char *expr) {
     /* Evaluate expression, return result */
     double args[CALCPERFORM_NARGS] = {
@@ -47,13 +83,16 @@ double doCalc(const char *expr) {
 void testCalc(const char *expr, double expected) {
     /* Evaluate expression, test against expected result */
     bool pass = false;
-    double args[CALCPERFORM_NARGS] = {
+    const double argsIn[CALCPERFORM_NARGS] = {
         1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
     };
+    double args[CALCPERFORM_NARGS];
     char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
     short err;
+    bool compiled = false;
     double result = 0.0;
     result /= result;  /* Start as NaN */
+    memcpy(args, argsIn, sizeof(args));
 
     if(!rpn) {
         testFail("postfix: %s no memory", expr);
@@ -62,10 +101,12 @@ void testCalc(const char *expr, double expected) {
 
     if (postfix(expr, rpn, &err)) {
         testDiag("postfix: %s in expression '%s'", calcErrorStr(err), expr);
+        compiled = true;
     } else
         if (calcPerform(args, &result, rpn) && finite(result)) {
             testDiag("calcPerform: error evaluating '%s'", expr);
-        }
+        } else
+            compiled = testCompiled(rpn, argsIn, args, result);
 
     if (finite(expected) && finite(result)) {
         pass = fabs(expected - result) < 1e-8;
@@ -74,6 +115,7 @@ void testCalc(const char *expr, double expected) {
     } else {
         pass = (result == expected);
     }
+    pass = pass && compiled;
     if (!testOk(pass, "%s", expr)) {
         testDiag("Expected result is %g, actually got %g", expected, result);
         calcExprDump(rpn);
@@ -84,14 +126,17 @@ void testCalc(const char *expr, double expected) {
 void testUInt32Calc(const char *expr, epicsUInt32 expected) {
     /* Evaluate expression, test against expected result */
     bool pass = false;
-    double args[CALCPERFORM_NARGS] = {
+    const double argsIn[CALCPERFORM_NARGS] = {
         1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
     };
+    double args[CALCPERFORM_NARGS];
     char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
     short err;
+    bool compiled = false;
     epicsUInt32 uresult;
     double result = 0.0;
     result /= result;  /* Start as NaN */
+    memcpy(args, argsIn, sizeof(args));
 
     if(!rpn) {
         testFail("postfix: %s no memory", expr);
@@ -100,13 +145,15 @@ void testUInt32Calc(const char *expr, epicsUInt32 expected) {
 
     if (postfix(expr, rpn, &err)) {
         testDiag("postfix: %s in expression '%s'", calcErrorStr(err), expr);
+        compiled = true;
     } else
         if (calcPerform(args, &result, rpn) && finite(result)) {
             testDiag("calcPerform: error evaluating '%s'", expr);
-        }
+        } else
+            compiled = testCompiled(rpn, argsIn, args, result);
 
     uresult = (result < 0.0 ? (epicsUInt32)(epicsInt32)result : (epicsUInt32)result);
-    pass = (uresult == expected);
+    pass = (uresult == expected) && compiled;
     if (!testOk(pass, "%s", expr)) {
         testDiag("Expected result is 0x%x (%u), actually got 0x%x (%u)",
                  expected, expected, uresult, uresult);
@@ -115,6 +162,52 @@ void testUInt32Calc(const char *expr, epicsUInt32 expected) {
     free(rpn);
 }
 
+void testArrayCalc(const char *expr) {
+    /* Check array evaluation against calcPerform on each element */
+    const int n = 150;  /* Not a whole number of blocks */
+    double *a = (double*)malloc(4 * n * sizeof(double));
+    double *b = a + n, *val = b + n, *expected = val + n;
+    const double *pargs[CALCPERFORM_NARGS] = {0};
+    double scalar[CALCPERFORM_NARGS];
+    char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
+    calcProgram *prog = NULL;
+    short err;
+    int i, bad = 0;
+
+    if (!a || !rpn || postfix(expr, rpn, &err) || !(prog = calcCompile(rpn))) {
+        testFail("Can't compile '%s'", expr);
+        free(a);
+        free(rpn);
+        return;
+    }
+    for (i = 0; i < CALCPERFORM_NARGS; i++) {
+        scalar[i] = i + 1.0;
+        pargs[i] = &scalar[i];
+    }
+    pargs[0] = a;
+    pargs[1] = b;
+    for (i = 0; i < n; i++) {
+        double args[CALCPERFORM_NARGS];
+
+        a[i] = i % 100 - 30;
+        b[i] = (i * 7) % 50 - 10;
+        val[i] = expected[i] = i;
+        memcpy(args, scalar, sizeof(args));
+        args[0] = a[i];
+        args[1] = b[i];
+        calcPerform(args, &expected[i], rpn);
+    }
+    calcProgramPerformArray(prog, pargs, 3, val, n);
+    for (i = 0; i < n; i++) {
+        if (!sameValue(val[i], expected[i]) && !bad++)
+            testDiag("Element %d is %g, expected %g", i, val[i], expected[i]);
+    }
+    testOk(!bad, "Array %s", expr);
+    calcProgramFree(prog);
+    free(a);
+    free(rpn);
+}
+
 void testArgs(const char *expr, unsigned long einp, unsigned long eout) {
     char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
     short err = 0;
@@ -284,6 +377,109 @@ static inline double MIN(double a, double b, double c, double d, double e,
     return MIN(MIN(a,b,c,d,e,f,g,h,i,j,k),l);
 }
 
+/* Time evaluating an expression with calcPerform and as a program */
+#define BENCH_EVALS 200000
+#define BENCH_RUNS 5
+
+static void benchCalc(const char *expr) {
+    const double argsIn[CALCPERFORM_NARGS] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    double args[CALCPERFORM_NARGS];
+    double result = 0.0, best[2] = {0.0, 0.0};
+    char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
+    calcProgram *prog = NULL;
+    short err;
+    int run, n;
+
+    if (!rpn || postfix(expr, rpn, &err) || !(prog = calcCompile(rpn))) {
+        testDiag("Can't compile '%s'", expr);
+        free(rpn);
+        return;
+    }
+    for (run = 0; run < 2 * BENCH_RUNS; run++) {
+        bool compiled = run & 1;
+        epicsUInt64 t0;
+        double dt;
+
+        memcpy(args, argsIn, sizeof(args));
+        t0 = epicsMonotonicGet();
+        for (n = 0; n < BENCH_EVALS; n++) {
+            if (compiled)
+                calcProgramPerform(prog, args, &result);
+            else
+                calcPerform(args, &result, rpn);
+        }
+        dt = (double) (epicsMonotonicGet() - t0) / BENCH_EVALS;
+        if (run < 2 || dt < best[compiled])
+            best[compiled] = dt;
+    }
+    testDiag("%-34s %7.1f %7.1f %5.2fx", expr, best[0], best[1],
+        best[0] / best[1]);
+    calcProgramFree(prog);
+    free(rpn);
+}
+
+/* Time evaluating an expression over arrays of inputs */
+#define BENCH_ELEMENTS 1000000
+
+static void benchCalcArray(const char *expr) {
+    const int n = BENCH_ELEMENTS;
+    double *a = (double*)malloc(3 * n * sizeof(double));
+    double *b = a + n, *val = b + n;
+    double scalar[CALCPERFORM_NARGS], best[3] = {0.0, 0.0, 0.0};
+    const double *pargs[CALCPERFORM_NARGS];
+    char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
+    calcProgram *prog = NULL;
+    short err;
+    int run, way, i;
+
+    if (!a || !rpn || postfix(expr, rpn, &err) || !(prog = calcCompile(rpn))) {
+        testDiag("Can't compile '%s'", expr);
+        free(a);
+        free(rpn);
+        return;
+    }
+    for (i = 0; i < CALCPERFORM_NARGS; i++) {
+        scalar[i] = i + 1.0;
+        pargs[i] = &scalar[i];
+    }
+    pargs[0] = a;
+    pargs[1] = b;
+    for (i = 0; i < n; i++) {
+        a[i] = i % 1000;
+        b[i] = i % 777;
+        val[i] = 0.0;
+    }
+    for (run = 0; run < BENCH_RUNS; run++) {
+        for (way = 0; way < 3; way++) {
+            epicsUInt64 t0 = epicsMonotonicGet();
+            double dt;
+
+            if (way == 2)
+                calcProgramPerformArray(prog, pargs, 3, val, n);
+            else for (i = 0; i < n; i++) {
+                double args[CALCPERFORM_NARGS];
+
+                memcpy(args, scalar, sizeof(args));
+                args[0] = a[i];
+                args[1] = b[i];
+                if (way)
+                    calcProgramPerform(prog, args, &val[i]);
+                else
+                    calcPerform(args, &val[i], rpn);
+            }
+            dt = (double) (epicsMonotonicGet() - t0) / n;
+            if (run == 0 || dt < best[way])
+                best[way] = dt;
+        }
+    }
+    testDiag("%-34s %7.2f %7.2f %7.2f", expr, best[0], best[1], best[2]);
+    calcProgramFree(prog);
+    free(a);
+    free(rpn);
+}
+
 /* The test code below generates lots of spurious warnings because
  * it's making sure that our operator priorities match those of C.
  * Disable them to quieten the compilation process where possible.
@@ -298,7 +494,7 @@ MAIN(epicsCalcTest)
     const double a=1.0, b=2.0, c=3.0, d=4.0, e=5.0, f=6.0,
                  g=7.0, h=8.0, i=9.0, j=10.0, k=11.0, l=12.0;
 
-    testPlan(637);
+    testPlan(651);
 
     /* LITERAL_OPERAND elements */
     testExpr(0);
@@ -846,6 +1042,12 @@ MAIN(epicsCalcTest)
     testCalc("k; k := 0", k);
     testCalc("l; l := 0", l);
 
+    testCalc("a; a := a + 1", a);
+    testCalc("b := 1; b := b + a; b := 5; b * 2", 10);
+    testCalc("c := a < b ? d : e; c + 1", d + 1);
+    testCalc("a ? b : c; a := 0", b);
+    testCalc("d := a ? b ? c : d : e; d + (0 ? 1 : a)", c + a);
+
     // Check relative precedences.
     testExpr(0 ? 1 : 2 | 4);                    // 0 1
     testExpr(1 ? 1 : 2 | 4);                    // 0 1
@@ -1012,5 +1214,34 @@ MAIN(epicsCalcTest)
     testUInt32Calc("-1431655766.1 << 0.1", 0xaaaaaaaau);
     testUInt32Calc("2863311530.1 << 0.1", 0xaaaaaaaau);
 
+    testArrayCalc("A+B*C");
+    testArrayCalc("A>B?A-B:B-A");
+    testArrayCalc("A<50?(B<10?1:B):A=B?VAL:3");
+    testArrayCalc("C:=A*2;C+B");
+    testArrayCalc("MAX(A,B,VAL)+MIN(A,C)");
+    testArrayCalc("A%7+FMOD(B,3)+FINITE(A,B)+ISNAN(A/B)");
+    testArrayCalc("A ? B : C; A := 0");
+    testArrayCalc("(A AND 0xf) << 2 | ~B");
+    testArrayCalc("D:=A;E:=B;D>E?D:E");
+
+    testDiag("Evaluation times in nsec, %-19s %7s %7s", "expression",
+        "postfix", "program");
+    benchCalc("A+B*C");
+    benchCalc("(A+B)/2*C-D");
+    benchCalc("A>B?A-B:B-A");
+    benchCalc("SIN(A)*COS(B)+SQRT(C*C+D*D)");
+    benchCalc("(A&0xff)|(B<<8)");
+    benchCalc("MAX(A,B,C,D)+MIN(E,F)");
+    benchCalc("A*D2R*180/PI+1/3");
+    benchCalc("E:=E+1;E>10?0:E");
+
+    testDiag("Times per element of %d in nsec, %-6s %7s %7s %7s",
+        BENCH_ELEMENTS, "", "postfix", "program", "array");
+    benchCalcArray("A*B+C");
+    benchCalcArray("(A-C)*D2R/B");
+    benchCalcArray("A>B?A-B:B-A");
+    benchCalcArray("SQRT(A*A+B*B)");
+    benchCalcArray("MAX(A,B,C)");
+
     return testDone();
 }
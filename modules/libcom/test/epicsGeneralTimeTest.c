@@ -0,0 +1,170 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Provider selection and the ratchet in epicsTimeGetCurrent(), and its
+ * throughput from several threads while providers are being registered.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "epicsAtomic.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "epicsGeneralTime.h"
+#include "generalTimeSup.h"
+#include "osiClockTime.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NTHREADS 4
+#define RUNTIME 0.5
+
+static int testFailing;
+static int testBackwards;
+
+#define TEST_PRIORITY 50
+
+/* The OS clock, unless told to fail or go back a second */
+static int testGetCurrent(epicsTimeStamp *pDest)
+{
+    int status;
+
+    if (epicsAtomicGetIntT(&testFailing))
+        return S_time_noProvider;
+    status = generalTimeGetExceptPriority(pDest, NULL, TEST_PRIORITY);
+    if (epicsAtomicGetIntT(&testBackwards))
+        pDest->secPastEpoch -= 1;
+    return status;
+}
+
+static int otherGetCurrent(epicsTimeStamp *pDest)
+{
+    return S_time_noProvider;
+}
+
+static void testProviders(void)
+{
+    epicsTimeStamp t1, t2;
+    int errors;
+
+    testDiag("Provider selection");
+
+    ClockTime_Init(CLOCKTIME_NOSYNC);
+    testOk1(generalTimeRegisterCurrentProvider("test", TEST_PRIORITY,
+        testGetCurrent) == epicsTimeOK);
+
+    testOk1(epicsTimeGetCurrent(&t1) == epicsTimeOK);
+    testOk(generalTimeCurrentProviderName() &&
+        strcmp(generalTimeCurrentProviderName(), "test") == 0,
+        "highest priority provider used");
+
+    errors = generalTimeGetErrorCounts();
+    epicsAtomicSetIntT(&testBackwards, 1);
+    epicsTimeGetCurrent(&t2);
+    epicsAtomicSetIntT(&testBackwards, 0);
+    testOk(epicsTimeGreaterThanEqual(&t2, &t1),
+        "time doesn't go backwards");
+    testOk(generalTimeGetErrorCounts() == errors + 1,
+        "backwards time counted");
+
+    epicsAtomicSetIntT(&testFailing, 1);
+    testOk1(epicsTimeGetCurrent(&t1) == epicsTimeOK);
+    testOk(generalTimeCurrentProviderName() &&
+        strcmp(generalTimeCurrentProviderName(), "OS Clock") == 0,
+        "next provider used when the first fails");
+    epicsAtomicSetIntT(&testFailing, 0);
+}
+
+typedef struct {
+    unsigned long calls;
+    int backwards;
+    int failed;
+} readerStats;
+
+static epicsUInt64 deadline;
+static int nregistered;
+
+/* Busy threads on a single CPU may not let the main thread run,
+ * so everybody stops at the deadline by themselves.
+ */
+static void reader(void *arg)
+{
+    readerStats *ps = arg;
+    epicsTimeStamp last, now;
+
+    epicsTimeGetCurrent(&last);
+    while (epicsMonotonicGet() < deadline) {
+        if (epicsTimeGetCurrent(&now) != epicsTimeOK)
+            ps->failed = 1;
+        if (epicsTimeLessThan(&now, &last))
+            ps->backwards = 1;
+        last = now;
+        ps->calls++;
+    }
+}
+
+/* Register providers ahead of "test" while the readers run */
+static void registrar(void *arg)
+{
+    while (epicsMonotonicGet() < deadline && nregistered < 20) {
+        char name[20];
+
+        sprintf(name, "other%d", nregistered);
+        if (generalTimeRegisterCurrentProvider(name, 10 + nregistered,
+                otherGetCurrent) == epicsTimeOK)
+            nregistered++;
+        epicsThreadSleep(0.01);
+    }
+}
+
+static void testThreads(void)
+{
+    readerStats stats[NTHREADS];
+    epicsThreadId tids[NTHREADS + 1];
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    unsigned long calls = 0;
+    int backwards = 0, failed = 0, i;
+    epicsUInt64 t0, t1;
+
+    testDiag("%d threads reading the time for %.1f sec", NTHREADS, RUNTIME);
+
+    memset(stats, 0, sizeof(stats));
+    opts.joinable = 1;
+    t0 = epicsMonotonicGet();
+    deadline = t0 + (epicsUInt64) (RUNTIME * 1e9);
+    opts.priority = epicsThreadPriorityHigh;
+    tids[NTHREADS] = epicsThreadCreateOpt("registrar", registrar, NULL, &opts);
+    opts.priority = epicsThreadPriorityLow;
+    for (i = 0; i < NTHREADS; i++) {
+        tids[i] = epicsThreadCreateOpt("reader", reader, &stats[i], &opts);
+    }
+    for (i = 0; i < NTHREADS; i++) {
+        epicsThreadMustJoin(tids[i]);
+        calls += stats[i].calls;
+        backwards |= stats[i].backwards;
+        failed |= stats[i].failed;
+    }
+    epicsThreadMustJoin(tids[NTHREADS]);
+    t1 = epicsMonotonicGet();
+
+    testOk(nregistered == 20, "%d providers registered meanwhile",
+        nregistered);
+    testOk(!failed, "every call returned a time");
+    testOk(!backwards, "no thread saw time go backwards");
+    testOk(calls > 0, "%lu calls", calls);
+    testDiag("%.0f calls/sec in total", calls * 1e9 / (t1 - t0));
+}
+
+MAIN(epicsGeneralTimeTest)
+{
+    testPlan(11);
+    testProviders();
+    testThreads();
+    return testDone();
+}
@@ -45,6 +45,7 @@ int epicsThreadPrivateTest(void);
 int epicsThreadTest(void);
 int epicsTimerTest(void);
 int epicsTimeTest(void);
+int epicsGeneralTimeTest(void);
 #ifdef __rtems__
 int epicsTimeZoneTest(void);
 #endif
@@ -56,7 +57,9 @@ int macDefExpandTest(void);
 int macLibTest(void);
 int osiSockTest(void);
 int ringBytesTest(void);
+int freeListTest(void);
 int ringPointerTest(void);
+int ringMPMCTest(void);
 int taskwdTest(void);
 
 void epicsRunLibComTests(void)
@@ -102,6 +105,7 @@ void epicsRunLibComTests(void)
     runTest(epicsThreadPriorityTest);
     runTest(epicsThreadPrivateTest);
     runTest(epicsTimeTest);
+    runTest(epicsGeneralTimeTest);
 #ifdef __rtems__
     runTest(epicsTimeZoneTest);
 #endif
@@ -112,7 +116,9 @@ void epicsRunLibComTests(void)
     runTest(macLibTest);
     runTest(osiSockTest);
     runTest(ringBytesTest);
+    runTest(freeListTest);
     runTest(ringPointerTest);
+    runTest(ringMPMCTest);
     runTest(taskwdTest);
 
     /*
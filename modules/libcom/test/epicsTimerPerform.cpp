@@ -0,0 +1,134 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Measure the cost of starting and canceling timers with 1k, 100k and
+ * 1M timers pending in the queue, and of expiring them.  The counts may
+ * be overridden with a comma separated list in $TIMER_BENCH_TIMERS.
+ */
+
+#include <cstdlib>
+#include <cstdio>
+#include <cfloat>
+
+#include "epicsTimer.h"
+#include "epicsTime.h"
+#include "dbDefs.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+static const unsigned nOps = 100000u;
+
+class benchNotify : public epicsTimerQueueNotify {
+public:
+    void reschedule () {}
+    double quantum () { return 0.0; }
+};
+
+class countNotify : public epicsTimerNotify {
+public:
+    countNotify () : count ( 0u ) {}
+    expireStatus expire ( const epicsTime & )
+    {
+        count++;
+        return expireStatus ( noRestart );
+    }
+    unsigned long count;
+};
+
+static double nsPer ( const epicsUInt64 & t0, unsigned n )
+{
+    return static_cast < double > ( epicsMonotonicGet () - t0 ) / n;
+}
+
+static void runBench ( unsigned nTimers )
+{
+    benchNotify queueNotify;
+    countNotify notify;
+    epicsTimerQueuePassive & queue =
+        epicsTimerQueuePassive::create ( queueNotify );
+    epicsTimer ** timers = new epicsTimer * [nTimers];
+    epicsTime base = epicsTime::getCurrent ();
+    epicsUInt32 seed = 12345u;
+    epicsUInt64 t0;
+    unsigned i;
+
+    testDiag ( "%u timers pending", nTimers );
+
+    for ( i = 0u; i < nTimers; i++ ) {
+        timers[i] = & queue.createTimer ();
+    }
+
+    // random expiration times up to an hour ahead
+    t0 = epicsMonotonicGet ();
+    for ( i = 0u; i < nTimers; i++ ) {
+        seed = seed * 1664525u + 1013904223u;
+        timers[i]->start ( notify, base + ( seed >> 8 ) % 3600000u * 1e-3 );
+    }
+    testDiag ( "  fill       %8.0f ns per start", nsPer ( t0, nTimers ) );
+
+    // restart pending timers, the usual case for watchdogs
+    t0 = epicsMonotonicGet ();
+    for ( i = 0u; i < nOps; i++ ) {
+        seed = seed * 1664525u + 1013904223u;
+        timers[( seed >> 8 ) % nTimers]->start ( notify,
+            base + ( seed >> 4 ) % 3600000u * 1e-3 );
+    }
+    testDiag ( "  restart    %8.0f ns per start", nsPer ( t0, nOps ) );
+
+    // cancel a timer then start it again
+    epicsUInt64 tCancel = 0u, tStart = 0u;
+    for ( i = 0u; i < nOps; i++ ) {
+        seed = seed * 1664525u + 1013904223u;
+        epicsTimer * pTmr = timers[( seed >> 8 ) % nTimers];
+        epicsUInt64 t1 = epicsMonotonicGet ();
+        pTmr->cancel ();
+        epicsUInt64 t2 = epicsMonotonicGet ();
+        pTmr->start ( notify, base + ( seed >> 4 ) % 3600000u * 1e-3 );
+        tCancel += t2 - t1;
+        tStart += epicsMonotonicGet () - t2;
+    }
+    testDiag ( "  cancel     %8.0f ns per cancel",
+        static_cast < double > ( tCancel ) / nOps );
+    testDiag ( "  start      %8.0f ns per start",
+        static_cast < double > ( tStart ) / nOps );
+
+    t0 = epicsMonotonicGet ();
+    double delay = queue.process ( base + 3600.0 );
+    testDiag ( "  expire     %8.0f ns per timer", nsPer ( t0, nTimers ) );
+    testOk ( notify.count == nTimers && delay == DBL_MAX,
+        "%u timers, %lu expired", nTimers, notify.count );
+
+    for ( i = 0u; i < nTimers; i++ ) {
+        timers[i]->destroy ();
+    }
+    delete [] timers;
+    delete & queue;
+}
+
+MAIN ( epicsTimerPerform )
+{
+    unsigned counts[16] = { 1000u, 100000u, 1000000u };
+    unsigned nCounts = 3u;
+    const char * env = getenv ( "TIMER_BENCH_TIMERS" );
+
+    if ( env ) {
+        char * end;
+        nCounts = 0u;
+        while ( *env && nCounts < NELEMENTS ( counts ) ) {
+            counts[nCounts++] = strtoul ( env, & end, 10 );
+            env = *end ? end + 1 : end;
+        }
+    }
+
+    testPlan ( 0 );
+    for ( unsigned i = 0u; i < nCounts; i++ ) {
+        runBench ( counts[i] );
+    }
+    return testDone ();
+}
@@ -452,13 +452,78 @@ void testPeriodic ()
     queue.release ();
 }
 
+class orderVerify : public epicsTimerNotify {
+public:
+    orderVerify ( unsigned idIn, unsigned & lastIn, bool & okIn ) :
+        id ( idIn ), pLast ( & lastIn ), pOk ( & okIn ) {}
+    expireStatus expire ( const epicsTime & )
+    {
+        // ids were given in the order the timers should expire
+        *pOk &= id > *pLast;
+        *pLast = id;
+        return expireStatus ( noRestart );
+    }
+    unsigned id;
+private:
+    unsigned * pLast;
+    bool * pOk;
+};
+
+class passiveNotify : public epicsTimerQueueNotify {
+public:
+    void reschedule () {}
+    double quantum () { return 0.0; }
+};
+
+void testOrder ()
+{
+    static const unsigned nTimers = 1000u;
+    static const unsigned nTimes = 100u;
+    passiveNotify queueNotify;
+    epicsTimerQueuePassive & queue =
+        epicsTimerQueuePassive::create ( queueNotify );
+    epicsTimer * pTimers[nTimers];
+    orderVerify * pNotify[nTimers];
+    epicsTime base = epicsTime::getCurrent ();
+    unsigned i, last = 0u, slot[nTimes] = { 0u };
+    bool ok = true;
+
+    testDiag ( "Testing expiration order" );
+
+    // timers with the same expire time must expire in the order started
+    for ( i = 0u; i < nTimers; i++ ) {
+        unsigned t = ( i * 37u ) % nTimes;
+        pNotify[i] = new orderVerify ( t * nTimers + slot[t]++ + 1u,
+            last, ok );
+        pTimers[i] = & queue.createTimer ();
+        pTimers[i]->start ( *pNotify[i], base + t + 1.0 );
+    }
+    // moving or canceling a timer keeps the others in order
+    for ( i = 0u; i < nTimers; i += 7u ) {
+        pNotify[i]->id = nTimes * nTimers + i + 1u;
+        pTimers[i]->start ( *pNotify[i], base + 1000.0 );
+    }
+    for ( i = 3u; i < nTimers; i += 7u ) {
+        pTimers[i]->cancel ();
+    }
+    testOk ( queue.process ( base + 500.0 ) > 0.0, "moved timers pending" );
+    queue.process ( base + 2000.0 );
+    testOk ( ok, "%u timers expired in order", nTimers );
+    for ( i = 0u; i < nTimers; i++ ) {
+        pTimers[i]->destroy ();
+        delete pNotify[i];
+    }
+    delete & queue;
+}
+
 MAIN(epicsTimerTest)
 {
-    testPlan(41);
+    testPlan(43);
     testRefCount();
     testAccuracy ();
     testCancel ();
     testExpireDestroy ();
     testPeriodic ();
+    testOrder ();
     return testDone();
 }
@@ -0,0 +1,177 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#include <string.h>
+
+#include "freeList.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NMALLOC 8
+#define NITEMS 20
+
+static void testUncached(void)
+{
+    void *pvt, *p1, *p2;
+    freeListCacheStatistics stats;
+
+    testDiag("Without per-thread caches");
+
+    freeListInitPvt(&pvt, 16, NMALLOC);
+    p1 = freeListMalloc(pvt);
+    p2 = freeListCalloc(pvt);
+    testOk(p1 && p2 && p1 != p2, "two elements allocated");
+    testOk1(freeListItemsAvail(pvt) == NMALLOC - 2);
+    freeListFree(pvt, p1);
+    freeListFree(pvt, p2);
+    testOk1(freeListItemsAvail(pvt) == NMALLOC);
+    freeListCacheStats(pvt, &stats);
+    testOk1(stats.magazineSize == 0);
+    freeListCleanup(pvt);
+}
+
+/* One thread allocates, another frees what it allocated */
+typedef struct {
+    void *pvt;
+    void *items[NITEMS];
+    int ndistinct;
+    epicsEventId go[2];
+    epicsEventId done;
+} transfer;
+
+static void allocator(void *arg)
+{
+    transfer *pt = arg;
+    int round, i, j;
+
+    for (round = 0; round < 2; round++) {
+        epicsEventMustWait(pt->go[0]);
+        for (i = 0; i < NITEMS; i++) {
+            pt->items[i] = freeListMalloc(pt->pvt);
+            for (j = 0; j < i; j++) {
+                if (pt->items[i] == pt->items[j])
+                    break;
+            }
+            pt->ndistinct += pt->items[i] && j == i;
+        }
+        epicsEventMustTrigger(pt->done);
+    }
+}
+
+static void releaser(void *arg)
+{
+    transfer *pt = arg;
+    int round, i;
+
+    for (round = 0; round < 2; round++) {
+        epicsEventMustWait(pt->go[1]);
+        for (i = 0; i < NITEMS; i++) {
+            freeListFree(pt->pvt, pt->items[i]);
+        }
+        epicsEventMustTrigger(pt->done);
+    }
+}
+
+static void testTransfer(void)
+{
+    transfer t;
+    freeListCacheStatistics stats;
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    epicsThreadId tids[2];
+    int round;
+
+    testDiag("Elements allocated in one thread and freed in another");
+
+    memset(&t, 0, sizeof(t));
+    freeListMagazineSize = 4;
+    freeListInitCachedPvt(&t.pvt, "testTransfer", 16, NMALLOC);
+    t.go[0] = epicsEventMustCreate(epicsEventEmpty);
+    t.go[1] = epicsEventMustCreate(epicsEventEmpty);
+    t.done = epicsEventMustCreate(epicsEventEmpty);
+
+    opts.joinable = 1;
+    tids[0] = epicsThreadCreateOpt("allocator", allocator, &t, &opts);
+    tids[1] = epicsThreadCreateOpt("releaser", releaser, &t, &opts);
+
+    for (round = 0; round < 2; round++) {
+        epicsEventMustTrigger(t.go[0]);
+        epicsEventMustWait(t.done);
+        testOk(t.ndistinct == NITEMS * (round + 1),
+            "round %d, %d distinct elements allocated", round, t.ndistinct);
+        epicsEventMustTrigger(t.go[1]);
+        epicsEventMustWait(t.done);
+    }
+    epicsThreadMustJoin(tids[0]);
+    epicsThreadMustJoin(tids[1]);
+
+    freeListCacheStats(t.pvt, &stats);
+    testOk(stats.magazineSize == 4, "magazines of %d", stats.magazineSize);
+    /* the releaser first fills its own two magazines and returns 3,
+     * then returns all 5 it fills in the second round */
+    testOk(stats.depotReturns == 8, "%lu full magazines returned",
+        stats.depotReturns);
+    testOk(stats.depotRefills == 3, "%lu full magazines reused",
+        stats.depotRefills);
+    testOk(stats.hits > stats.misses, "%lu hits, %lu misses",
+        stats.hits, stats.misses);
+    testOk(stats.hits + stats.misses == 4 * NITEMS,
+        "every call counted");
+    testOk(freeListItemsAvail(t.pvt) == 4 * NMALLOC,
+        "all %u elements available after the threads exit",
+        (unsigned) freeListItemsAvail(t.pvt));
+
+    freeListCleanup(t.pvt);
+    epicsEventDestroy(t.go[0]);
+    epicsEventDestroy(t.go[1]);
+    epicsEventDestroy(t.done);
+}
+
+static void testCleanup(void)
+{
+    void *pvt1, *pvt2, *p;
+    freeListCacheStatistics stats;
+
+    testDiag("A cleaned up list's magazines aren't reused");
+
+    freeListMagazineSize = 4;
+    freeListInitCachedPvt(&pvt1, "testCleanup1", 16, NMALLOC);
+    p = freeListMalloc(pvt1);
+    freeListFree(pvt1, p);
+    freeListCleanup(pvt1);
+
+    /* takes the same slot */
+    freeListInitCachedPvt(&pvt2, "testCleanup2", 16, NMALLOC);
+    p = freeListMalloc(pvt2);
+    testOk1(p != NULL);
+    freeListCacheStats(pvt2, &stats);
+    testOk(stats.misses == 1 && stats.hits == 0,
+        "first allocation refilled the magazine");
+    freeListFree(pvt2, p);
+    testOk(freeListItemsAvail(pvt2) == NMALLOC,
+        "elements in this thread's magazines are available");
+    freeListCacheReport(1);
+    freeListCleanup(pvt2);
+
+    freeListMagazineSize = 0;
+    freeListInitCachedPvt(&pvt1, "testCleanup3", 16, NMALLOC);
+    freeListCacheStats(pvt1, &stats);
+    testOk(stats.magazineSize == 0, "freeListMagazineSize 0 disables");
+    freeListCleanup(pvt1);
+}
+
+MAIN(freeListTest)
+{
+    testPlan(16);
+    freeListBypass = 0;
+    testUncached();
+    testTransfer();
+    testCleanup();
+    return testDone();
+}
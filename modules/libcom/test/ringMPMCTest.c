@@ -0,0 +1,225 @@
+/*************************************************************************\
+* Copyright (c) 2026 UChicago Argonne LLC, as Operator of Argonne
+*     National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "epicsRingMPMC.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#define NPRODUCERS 3
+#define NCONSUMERS 3
+#define NPERPRODUCER 100000
+
+/* element values start at 1 so none is NULL */
+static void *int2ptr(size_t i)
+{
+    return (char *) 0 + i;
+}
+
+static size_t ptr2int(void *p)
+{
+    return (char *) p - (char *) 0;
+}
+
+static void testSingle(void)
+{
+    epicsRingMPMCId ring = epicsRingMPMCCreate(5);
+    void *items[16];
+    int i, n, ok;
+
+    testDiag("Single thread");
+
+    testOk(ring != NULL, "ring created");
+    testOk(epicsRingMPMCGetSize(ring) == 8, "size 5 rounded up to %d",
+        epicsRingMPMCGetSize(ring));
+    testOk1(epicsRingMPMCIsEmpty(ring));
+    testOk1(epicsRingMPMCPop(ring) == NULL);
+    testOk1(epicsRingMPMCPopBatch(ring, items, 16) == 0);
+
+    testOk(epicsRingMPMCPush(ring, int2ptr(1)) == 2,
+        "push onto an empty ring returns 2");
+    testOk(epicsRingMPMCPush(ring, int2ptr(2)) == 1,
+        "push onto a non-empty ring returns 1");
+    testOk1(epicsRingMPMCGetUsed(ring) == 2);
+    testOk1(ptr2int(epicsRingMPMCPop(ring)) == 1);
+    testOk(epicsRingMPMCPush(ring, int2ptr(3)) == 1,
+        "push behind an element not yet popped returns 1");
+    testOk1(ptr2int(epicsRingMPMCPop(ring)) == 2);
+    testOk1(ptr2int(epicsRingMPMCPop(ring)) == 3);
+    testOk(epicsRingMPMCPush(ring, int2ptr(4)) == 2,
+        "push onto the emptied ring returns 2");
+    testOk1(ptr2int(epicsRingMPMCPop(ring)) == 4);
+
+    for (i = 1; i <= 8; i++) {
+        epicsRingMPMCPush(ring, int2ptr(i));
+    }
+    testOk1(epicsRingMPMCGetUsed(ring) == 8);
+    testOk(epicsRingMPMCPush(ring, int2ptr(9)) == 0, "push onto full ring");
+    testOk1(epicsRingMPMCGetHighWaterMark(ring) <= 8);
+
+    n = epicsRingMPMCPopBatch(ring, items, 3);
+    testOk(n == 3, "batch of %d", n);
+    ok = 1;
+    for (i = 0; i < n; i++) {
+        ok &= ptr2int(items[i]) == (size_t) i + 1;
+    }
+    testOk(ok, "batch in order");
+
+    /* wrap around */
+    for (i = 9; i <= 11; i++) {
+        epicsRingMPMCPush(ring, int2ptr(i));
+    }
+    n = epicsRingMPMCPopBatch(ring, items, 16);
+    testOk(n == 8, "batch of the remaining %d", n);
+    ok = 1;
+    for (i = 0; i < n; i++) {
+        ok &= ptr2int(items[i]) == (size_t) i + 4;
+    }
+    testOk(ok, "batch across the end of the ring in order");
+    testOk1(epicsRingMPMCIsEmpty(ring));
+    testOk(epicsRingMPMCGetHighWaterMark(ring) == 8, "high water mark %d",
+        epicsRingMPMCGetHighWaterMark(ring));
+    epicsRingMPMCResetHighWaterMark(ring);
+    testOk1(epicsRingMPMCGetHighWaterMark(ring) == 0);
+
+    epicsRingMPMCDelete(ring);
+}
+
+typedef struct {
+    epicsRingMPMCId ring;
+    epicsEventId wakeup;
+    int producersLeft;
+    size_t sum[NCONSUMERS];
+    size_t count[NCONSUMERS];
+    int outOfOrder;
+    size_t last[NCONSUMERS][NPRODUCERS];
+} shared;
+
+typedef struct {
+    shared *sh;
+    int id;
+} threadArg;
+
+static void producer(void *arg)
+{
+    threadArg *ta = arg;
+    shared *sh = ta->sh;
+    size_t i;
+
+    for (i = 1; i <= NPERPRODUCER; i++) {
+        /* id in the low bits, sequence number above */
+        void *p = int2ptr(i * NPRODUCERS + ta->id);
+        int ret;
+
+        while (!(ret = epicsRingMPMCPush(sh->ring, p)))
+            epicsThreadSleep(0.001);
+        if (ret == 2)
+            epicsEventMustTrigger(sh->wakeup);
+    }
+    epicsAtomicDecrIntT(&sh->producersLeft);
+    epicsEventMustTrigger(sh->wakeup);
+}
+
+static void consumer(void *arg)
+{
+    threadArg *ta = arg;
+    shared *sh = ta->sh;
+
+    for (;;) {
+        void *items[7];
+        int n = epicsRingMPMCPopBatch(sh->ring, items, 7), i;
+
+        if (!n) {
+            if (!epicsAtomicGetIntT(&sh->producersLeft) &&
+                epicsRingMPMCIsEmpty(sh->ring))
+                break;
+            epicsEventWaitWithTimeout(sh->wakeup, 0.1);
+            continue;
+        }
+        if (!epicsRingMPMCIsEmpty(sh->ring))
+            epicsEventMustTrigger(sh->wakeup);
+        for (i = 0; i < n; i++) {
+            size_t v = ptr2int(items[i]);
+            size_t seq = v / NPRODUCERS;
+            int from = v % NPRODUCERS;
+
+            /* each producer's elements are seen in order by any consumer */
+            if (seq <= sh->last[ta->id][from])
+                sh->outOfOrder = 1;
+            sh->last[ta->id][from] = seq;
+            sh->sum[ta->id] += v;
+            sh->count[ta->id]++;
+        }
+    }
+    /* let any other consumer see the end too */
+    epicsEventMustTrigger(sh->wakeup);
+}
+
+static void testThreads(void)
+{
+    shared sh;
+    threadArg pargs[NPRODUCERS], cargs[NCONSUMERS];
+    epicsThreadId tids[NPRODUCERS + NCONSUMERS];
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    size_t sum = 0, count = 0, expect = 0, i;
+    int j;
+
+    testDiag("%d producers, %d consumers", NPRODUCERS, NCONSUMERS);
+
+    memset(&sh, 0, sizeof(sh));
+    sh.ring = epicsRingMPMCCreate(256);
+    sh.wakeup = epicsEventMustCreate(epicsEventEmpty);
+    sh.producersLeft = NPRODUCERS;
+
+    opts.joinable = 1;
+    for (j = 0; j < NCONSUMERS; j++) {
+        cargs[j].sh = &sh;
+        cargs[j].id = j;
+        tids[j] = epicsThreadCreateOpt("consumer", consumer, &cargs[j], &opts);
+    }
+    for (j = 0; j < NPRODUCERS; j++) {
+        pargs[j].sh = &sh;
+        pargs[j].id = j;
+        tids[NCONSUMERS + j] = epicsThreadCreateOpt("producer", producer,
+            &pargs[j], &opts);
+    }
+    for (j = 0; j < NPRODUCERS + NCONSUMERS; j++) {
+        epicsThreadMustJoin(tids[j]);
+    }
+
+    for (i = 1; i <= NPERPRODUCER; i++) {
+        for (j = 0; j < NPRODUCERS; j++) {
+            expect += i * NPRODUCERS + j;
+        }
+    }
+    for (j = 0; j < NCONSUMERS; j++) {
+        sum += sh.sum[j];
+        count += sh.count[j];
+    }
+    testOk(count == NPRODUCERS * NPERPRODUCER, "%lu elements popped",
+        (unsigned long) count);
+    testOk(sum == expect, "every element popped once");
+    testOk(!sh.outOfOrder, "each producer's elements popped in order");
+    testOk1(epicsRingMPMCIsEmpty(sh.ring));
+
+    epicsEventDestroy(sh.wakeup);
+    epicsRingMPMCDelete(sh.ring);
+}
+
+MAIN(ringMPMCTest)
+{
+    testPlan(28);
+    testSingle();
+    testThreads();
+    return testDone();
+}